@@ -56,6 +56,12 @@
  * - Demo 8: Radiating Lines (center-out patterns)
  * - Demo 9: Nested Shapes (concentric patterns)
  * - Demo 10: Grid Pattern (spacing and alignment)
+ * - Demo 11: Flush Benchmark (immediate vs deferred rendering)
+ * - Demo 12: Background Refresh (timer ISR streams the frame)
+ * - Demo 13: Raster Benchmark (CPU cycles per pixel, old vs integer)
+ * - Demo 14: Sprite Blitter (RLE images, XOR and masked sprites)
+ * - Demo 15: Strip Chart (ADC plot scrolled by the display start line)
+ * - Demo 16: Text Speed (PROGMEM fonts, page-aligned fast path)
  *
  * HOW TO USE IN CLASS:
  * 1. Uncomment ONE demo in main() to focus lesson
@@ -75,10 +81,19 @@
  */
 
 #include <avr/io.h>
+#include <avr/interrupt.h>
 #include <util/delay.h>
 #include <avr/pgmspace.h>
+#include <stdlib.h>
 #include "../../shared_libs/_glcd.h"
+#include "../../shared_libs/_bitmap.h"
+#include "../../shared_libs/_chart.h"
+#include "../../shared_libs/_text.h"
+#include "../../shared_libs/_fonts.h"
+#include "../../shared_libs/_adc.h"
 #include "../../shared_libs/_init.h"
+#include "../../shared_libs/_capture.h"
+#include "../../shared_libs/_timer2.h"
 
 /* =============================================================================
  * HARDWARE CONFIGURATION
@@ -116,6 +131,36 @@ const char STR_DEMO7[] PROGMEM = "Demo 7: Text Pages";
 const char STR_DEMO8[] PROGMEM = "Demo 8: Radiating Lines";
 const char STR_DEMO9[] PROGMEM = "Demo 9: Nested Shapes";
 const char STR_DEMO10[] PROGMEM = "Demo 10: Grid Pattern";
+const char STR_DEMO11[] PROGMEM = "Demo 11: Flush Bench";
+const char STR_IMMEDIATE[] PROGMEM = "Immediate:";
+const char STR_DEFERRED[] PROGMEM = "Deferred:";
+const char STR_THROUGHPUT[] PROGMEM = "Bus (clear):";
+const char STR_DEMO12[] PROGMEM = "Demo 12: Background";
+const char STR_BLOCKING[] PROGMEM = "Blocking flush:";
+const char STR_BACKGROUND[] PROGMEM = "Background:";
+const char STR_DEMO13[] PROGMEM = "Demo 13: Cycles/pixel";
+const char STR_LINE_OLD[] PROGMEM = "Line mul/div";
+const char STR_LINE_NEW[] PROGMEM = "Line Bresenham";
+const char STR_FILL_OLD[] PROGMEM = "Fill dot x*x";
+const char STR_FILL_NEW[] PROGMEM = "Fill span";
+const char STR_DEMO14[] PROGMEM = "Demo 14: Blitter";
+const char STR_FLASH_RAW[] PROGMEM = "Flash raw";
+const char STR_FLASH_RLE[] PROGMEM = "Flash RLE";
+const char STR_SPLASH[] PROGMEM = "Splash cyc/B";
+const char STR_SPRITE_OLD[] PROGMEM = "Sprite dots";
+const char STR_SPRITE_NEW[] PROGMEM = "Sprite XOR";
+const char STR_DEMO15[] PROGMEM = "Demo 15: Strip Chart";
+const char STR_CHART_RATE[] PROGMEM = "Samples/s";
+const char STR_CHART_ROWS[] PROGMEM = "Rows drawn";
+const char STR_CHART_WRITES[] PROGMEM = "Writes/row";
+const char STR_DEMO16[] PROGMEM = "Demo 16: Chars/s";
+const char STR_TEXT_OLD[] PROGMEM = "lcd_string";
+const char STR_TEXT_FAST[] PROGMEM = "Text y=8";
+const char STR_TEXT_SHIFT[] PROGMEM = "Text y=11";
+const char STR_TEXT_PROP[] PROGMEM = "Prop 7";
+const char STR_TEXT_BIG[] PROGMEM = "Digits 16";
+const char STR_TEXT_LINE[] PROGMEM = "The quick brown fox j"; // 21 cells of 6 columns
+const char STR_TEXT_DIGITS[] PROGMEM = "12:34.5%";
 
 const char STR_LEFT_PANEL[] PROGMEM = "Left (CS1: y 0..63)";
 const char STR_RIGHT_PANEL[] PROGMEM = "Right (CS2: y 64..127)";
@@ -513,6 +558,620 @@ static void demo_10_grid(void)
     _delay_ms(100);
 }
 
+/* =============================================================================
+ * DEMO 11: FLUSH BENCHMARK - Immediate vs Deferred Rendering
+ * =============================================================================
+ * PURPOSE: Measure what per-pixel bus traffic costs
+ *
+ * CONCEPTS:
+ * - Immediate mode: GLCD_Dot() = page cmd + column cmd + data byte
+ * - Deferred mode: GLCD_Dot() only changes ScreenBuffer and marks the
+ *   column dirty; GLCD_Flush() sends each dirty span once, using the
+ *   controller's column auto-increment
+ * - GLCD_Get_bus_stats(): transactions and estimated bus time
+ * - Measured throughput: lcd_clear() timed with the Timer1 clock
+ *   (busy-flag polling vs -DGLCD_FIXED_DELAYS padding)
+ *
+ * TEACHING FOCUS:
+ * - Overlapping lines near the centre rewrite the same bytes many times
+ * - Batching turns thousands of transactions into about one per column
+ */
+static void bench_scene(void)
+{
+    const unsigned char cx = GLCD_ROWS / 2;
+    const unsigned char cy = GLCD_COLS / 2;
+
+    for (unsigned char y = 0; y < GLCD_COLS; y += 16) // demo 8 (every 2nd line)
+    {
+        GLCD_Line(cx, cy, 0, y);
+        GLCD_Line(cx, cy, GLCD_ROWS - 1, y);
+    }
+    for (unsigned char r = 5; r <= 25; r += 5) // demo 6
+    {
+        GLCD_Circle(cx, cy, r);
+    }
+}
+
+// "<label>" on one row, "<transactions> tx <time> ms" on the next
+static void bench_report(byte row, const char *label, const GLCD_bus_stats_t *stats)
+{
+    char num[11];
+
+    lcd_string_P(row, 0, label);
+    ultoa(stats->commands + stats->data_bytes, num, 10);
+    lcd_string(row + 1, 0, num);
+    lcd_string(row + 1, 7, "tx");
+    ultoa(stats->bus_time_us / 1000, num, 10);
+    lcd_string(row + 1, 11, num);
+    lcd_string(row + 1, 17, "ms");
+}
+
+static void demo_11_flush_benchmark(void)
+{
+    GLCD_bus_stats_t immediate, deferred, clear;
+    unsigned long start_us, clear_us;
+    char num[11];
+
+    // 1. Immediate mode: every pixel goes to the panel at once
+    lcd_clear();
+    GLCD_Set_render_mode(GLCD_RENDER_IMMEDIATE);
+    GLCD_Reset_bus_stats();
+    bench_scene();
+    GLCD_Get_bus_stats(&immediate);
+    _delay_ms(1000);
+
+    // 2. Deferred mode: draw into RAM, then one flush
+    lcd_clear();
+    GLCD_Set_render_mode(GLCD_RENDER_DEFERRED);
+    GLCD_Reset_bus_stats();
+    bench_scene();
+    GLCD_Flush();
+    GLCD_Get_bus_stats(&deferred);
+    GLCD_Set_render_mode(GLCD_RENDER_IMMEDIATE);
+    _delay_ms(1000);
+
+    // 3. Raw throughput: lcd_clear() = 16 commands + 512 data writes
+    Capture_clock_init();
+    GLCD_Reset_bus_stats();
+    start_us = Capture_get_micros();
+    lcd_clear();
+    clear_us = Capture_get_micros() - start_us;
+    GLCD_Get_bus_stats(&clear);
+
+    // 4. Results (text is written directly, so show it on a blank screen)
+    lcd_string_P(0, 0, STR_DEMO11);
+    bench_report(2, STR_IMMEDIATE, &immediate);
+    bench_report(4, STR_DEFERRED, &deferred);
+    lcd_string_P(6, 0, STR_THROUGHPUT);
+    ultoa((clear.commands + clear.data_bytes) * 1000000UL / (clear_us ? clear_us : 1), num, 10);
+    lcd_string(7, 0, num);
+    lcd_string(7, 9, "writes/s");
+
+    _delay_ms(100);
+}
+
+/* =============================================================================
+ * DEMO 12: BACKGROUND REFRESH - Display Updates Without Blocking
+ * =============================================================================
+ * PURPOSE: Keep the main loop (sensor polling) running at full rate while
+ *          an animation is on screen
+ *
+ * CONCEPTS:
+ * - Timer2 ISR calls GLCD_Refresh_tick(): at most 32 bytes per 1ms tick
+ * - GLCD_Refresh_ready() / GLCD_Present(): frame-swap handshake, the ISR
+ *   never shows a half-drawn frame
+ * - Same bouncing ball with a blocking GLCD_Flush() for comparison
+ *
+ * TEACHING FOCUS:
+ * - "Loops" = how often the main loop could poll its sensors per second
+ * - Frame rate drops a little, main loop rate goes up a lot
+ */
+ISR(TIMER2_OVF_vect)
+{
+    Timer2_ovf_handler();
+    GLCD_Refresh_tick();
+}
+
+static void ball_frame(unsigned char x, unsigned char y)
+{
+    ScreenBuffer_clear();
+    GLCD_Rectangle(0, 0, GLCD_ROWS - 1, GLCD_COLS - 1);
+    GLCD_Circle(x, y, 5);
+}
+
+// bounce for two seconds; background = 0 uses GLCD_Flush(), 1 the refresher
+static void ball_run(unsigned char background, unsigned int *frames, unsigned long *loops)
+{
+    unsigned char x = 20, y = 30;
+    signed char dx = 1, dy = 2;
+    unsigned long end = Timer2_get_milliseconds() + 2000;
+
+    *frames = 0;
+    *loops = 0;
+    while (Timer2_get_milliseconds() < end)
+    {
+        if (!background || GLCD_Refresh_ready())
+        {
+            x += dx;
+            y += dy;
+            if ((x <= 7) || (x >= GLCD_ROWS - 8))
+                dx = -dx;
+            if ((y <= 7) || (y >= GLCD_COLS - 8))
+                dy = -dy;
+
+            ball_frame(x, y);
+            if (background)
+                GLCD_Present();
+            else
+                GLCD_Flush();
+            (*frames)++;
+        }
+        (*loops)++; // stands in for one sensor poll
+    }
+}
+
+static void ball_report(byte row, const char *label, unsigned int frames, unsigned long loops)
+{
+    char num[11];
+
+    lcd_string_P(row, 0, label);
+    utoa(frames / 2, num, 10); // two second run
+    lcd_string(row + 1, 0, num);
+    lcd_string(row + 1, 4, "fps");
+    ultoa(loops / 2, num, 10);
+    lcd_string(row + 1, 9, num);
+    lcd_string(row + 1, 16, "lp/s");
+}
+
+static void demo_12_background_refresh(void)
+{
+    unsigned int frames_blocking, frames_background;
+    unsigned long loops_blocking, loops_background;
+
+    Timer2_init();
+    lcd_clear();
+
+    GLCD_Set_render_mode(GLCD_RENDER_DEFERRED);
+    ball_run(0, &frames_blocking, &loops_blocking);
+
+    GLCD_Refresh_start(GLCD_REFRESH_BYTES_PER_TICK);
+    ball_run(1, &frames_background, &loops_background);
+    GLCD_Refresh_stop(); // bus back to the main program for text
+
+    GLCD_Set_render_mode(GLCD_RENDER_IMMEDIATE);
+    lcd_clear();
+    lcd_string_P(0, 0, STR_DEMO12);
+    ball_report(2, STR_BLOCKING, frames_blocking, loops_blocking);
+    ball_report(5, STR_BACKGROUND, frames_background, loops_background);
+
+    _delay_ms(100);
+}
+
+/* =============================================================================
+ * DEMO 13: RASTER BENCHMARK - CPU Cycles per Pixel
+ * =============================================================================
+ * PURPOSE: Measure what the drawing algorithm itself costs, without the bus
+ *
+ * CONCEPTS:
+ * - Deferred mode: pixels only go to ScreenBuffer, so the time is pure CPU
+ * - Timer1 capture clock: 1 tick = 8 CPU cycles (prescaler 8)
+ * - Old line: one multiply and one divide per point (copy of the original
+ *   GLCD_Line); new line: Bresenham error term, additions only
+ * - Old fill: x*x + y*y test and GLCD_Dot() per pixel; new fill: one
+ *   masked byte per page and column (8 pixels per read-modify-write)
+ *
+ * TEACHING FOCUS:
+ * - AVR has no divide instruction: a 16-bit division is a ~200 cycle loop
+ * - Working in bytes instead of bits is the biggest win on page memory
+ */
+static unsigned int old_line(unsigned char x1, unsigned char y1, unsigned char x2, unsigned char y2)
+{
+    int x, y, step;
+    unsigned int dots = 0;
+
+    if (y1 != y2) // y is variable, x = f(y)
+    {
+        step = (y1 < y2) ? 1 : -1;
+        for (y = y1; y != y2 + step; y += step)
+        {
+            x = x1 + (y - y1) * (x2 - x1) / (y2 - y1);
+            GLCD_Dot(x, y);
+            dots++;
+        }
+    }
+    else // horizontal in y: x is variable
+    {
+        step = (x1 < x2) ? 1 : -1;
+        for (x = x1; x != x2 + step; x += step)
+        {
+            GLCD_Dot(x, y1);
+            dots++;
+        }
+    }
+    return dots;
+}
+
+static unsigned int old_fill_circle(unsigned char cx, unsigned char cy, unsigned char r)
+{
+    int dx, dy;
+    unsigned int dots = 0;
+
+    for (dx = -r; dx <= r; dx++)
+    {
+        for (dy = -r; dy <= r; dy++)
+        {
+            if (dx * dx + dy * dy <= r * r)
+            {
+                GLCD_Dot(cx + dx, cy + dy);
+                dots++;
+            }
+        }
+    }
+    return dots;
+}
+
+// Bresenham draws max(|dx|, |dy|) + 1 pixels
+static unsigned int line_pixels(unsigned char x1, unsigned char y1, unsigned char x2, unsigned char y2)
+{
+    unsigned char dx = (x1 > x2) ? (x1 - x2) : (x2 - x1);
+    unsigned char dy = (y1 > y2) ? (y1 - y2) : (y2 - y1);
+
+    return ((dx > dy) ? dx : dy) + 1;
+}
+
+static void raster_report(byte row, const char *label, unsigned long ticks, unsigned int pixels)
+{
+    char num[11];
+
+    lcd_string_P(row, 0, label);
+    ultoa(ticks * CAPTURE_PRESCALER / (pixels ? pixels : 1), num, 10);
+    lcd_string(row, 15, num);
+}
+
+static void demo_13_raster_benchmark(void)
+{
+    const unsigned char cx = GLCD_ROWS / 2;
+    const unsigned char cy = GLCD_COLS / 2;
+    unsigned long start, line_old, line_new, fill_old, fill_new;
+    unsigned int old_dots = 0, new_dots = 0, disk_dots;
+    unsigned char y;
+
+    Capture_clock_init();
+    lcd_clear();
+    GLCD_Set_render_mode(GLCD_RENDER_DEFERRED); // no bus traffic while timing
+
+    // 1. Lines: the radiating fan of demo 8
+    start = Capture_get_ticks();
+    for (y = 0; y < GLCD_COLS; y += 8)
+    {
+        old_dots += old_line(cx, cy, 0, y);
+        old_dots += old_line(cx, cy, GLCD_ROWS - 1, y);
+    }
+    line_old = Capture_get_ticks() - start;
+    GLCD_Flush();
+    _delay_ms(1000);
+
+    ScreenBuffer_clear();
+    start = Capture_get_ticks();
+    for (y = 0; y < GLCD_COLS; y += 8)
+    {
+        GLCD_Line(cx, cy, 0, y);
+        GLCD_Line(cx, cy, GLCD_ROWS - 1, y);
+    }
+    line_new = Capture_get_ticks() - start;
+    for (y = 0; y < GLCD_COLS; y += 8) // count outside the timed loop
+    {
+        new_dots += line_pixels(cx, cy, 0, y);
+        new_dots += line_pixels(cx, cy, GLCD_ROWS - 1, y);
+    }
+    GLCD_Flush();
+    _delay_ms(1000);
+
+    // 2. Filled disk, r = 28: per-pixel test vs page spans
+    ScreenBuffer_clear();
+    start = Capture_get_ticks();
+    disk_dots = old_fill_circle(cx, cy, 28);
+    fill_old = Capture_get_ticks() - start;
+    GLCD_Flush();
+    _delay_ms(1000);
+
+    ScreenBuffer_clear();
+    start = Capture_get_ticks();
+    GLCD_Fill_circle(cx, cy, 28, RASTER_SET);
+    fill_new = Capture_get_ticks() - start;
+    GLCD_Flush();
+    _delay_ms(1000);
+
+    // 3. Results in CPU cycles per pixel
+    GLCD_Set_render_mode(GLCD_RENDER_IMMEDIATE);
+    lcd_clear();
+    lcd_string_P(0, 0, STR_DEMO13);
+    raster_report(2, STR_LINE_OLD, line_old, old_dots);
+    raster_report(3, STR_LINE_NEW, line_new, new_dots);
+    raster_report(5, STR_FILL_OLD, fill_old, disk_dots);
+    raster_report(6, STR_FILL_NEW, fill_new, disk_dots);
+
+    _delay_ms(100);
+}
+
+/* =============================================================================
+ * DEMO 14: SPRITE BLITTER - Images and Moving Sprites from Flash
+ * =============================================================================
+ * PURPOSE: Draw whole images 8 pixels at a time instead of pixel by pixel
+ *
+ * CONCEPTS:
+ * - Bitmap = KS0108 page bytes in PROGMEM (bit 0 = top pixel of a byte)
+ * - RLE compression: runs of equal bytes stored once, decoded during the
+ *   blit, so the splash screen costs a third of its raw flash size
+ * - y not a multiple of 8: each byte is split over two pages by shifting
+ * - XOR sprite: drawing it a second time at the same place erases it
+ * - Masked sprite: copy only inside the mask, background stays visible
+ *
+ * TEACHING FOCUS:
+ * - Bitmap_draw() uses x = column, y = row (same as _raster.h),
+ *   GLCD_raster is the core's drawing target
+ * - Erase + redraw: 16x16 pixel loop vs two XOR blits (cycles per frame)
+ */
+const uint8_t IMG_SPLASH[] PROGMEM = {
+    BITMAP_HEADER(128, 64, BITMAP_RLE),
+    0x01, 0xFF, 0x01, 0xFA, 0xFD, 0x00, 0x01, 0x80, 0xFF, 0x00, 0x00, 0xFA, 0x3F, 0x00, 0x00, 0x80,
+    0xFF, 0x82, 0x00, 0x8A, 0xC0, 0x84, 0x00, 0x87, 0xC0, 0x87, 0x00, 0x8A, 0xC0, 0x81, 0x00, 0x8A,
+    0xC0, 0x87, 0x00, 0x87, 0xC0, 0x84, 0x00, 0x8D, 0xC0, 0x84, 0x00, 0x87, 0xC0, 0x83, 0x00, 0x80,
+    0xFF, 0x00, 0x00, 0x81, 0x7E, 0x87, 0x81, 0x81, 0x01, 0x81, 0x00, 0x81, 0xFE, 0x87, 0x01, 0x81,
+    0xFE, 0x81, 0x00, 0x81, 0xFE, 0x8A, 0x01, 0x81, 0x00, 0x81, 0x01, 0x87, 0x81, 0x81, 0x7E, 0x81,
+    0x00, 0x81, 0xFE, 0x81, 0x01, 0x81, 0xF1, 0x81, 0x0F, 0x81, 0xFE, 0x81, 0x00, 0x81, 0x7F, 0x87,
+    0x71, 0x81, 0x81, 0x81, 0x00, 0x81, 0xFE, 0x81, 0x01, 0x81, 0xF1, 0x81, 0x0F, 0x81, 0xFE, 0x80,
+    0x00, 0x80, 0xFF, 0x82, 0x00, 0x87, 0x03, 0x81, 0xFC, 0x81, 0x00, 0x81, 0xFF, 0x87, 0x00, 0x81,
+    0xFF, 0x81, 0x00, 0x81, 0xFF, 0x90, 0x00, 0x87, 0x03, 0x81, 0xFC, 0x81, 0x00, 0x81, 0xFF, 0x81,
+    0xE0, 0x81, 0x1F, 0x81, 0x00, 0x81, 0xFF, 0x81, 0x00, 0x81, 0xE0, 0x87, 0x00, 0x81, 0xFF, 0x81,
+    0x00, 0x81, 0xFF, 0x81, 0xE0, 0x81, 0x1F, 0x81, 0x00, 0x81, 0xFF, 0x80, 0x00, 0x80, 0xFF, 0x00,
+    0x00, 0x8A, 0x07, 0x87, 0x00, 0x87, 0x07, 0x87, 0x00, 0x8A, 0x07, 0x81, 0x00, 0x8A, 0x07, 0x87,
+    0x00, 0x87, 0x07, 0x87, 0x00, 0x87, 0x07, 0x87, 0x00, 0x87, 0x07, 0x83, 0x00, 0x80, 0xFF, 0x00,
+    0x00, 0x80, 0x04, 0x82, 0xC4, 0x82, 0x04, 0x82, 0xC4, 0x82, 0x04, 0x82, 0xC4, 0x82, 0x04, 0x82,
+    0xC4, 0x82, 0x04, 0x82, 0xC4, 0x82, 0x04, 0x82, 0xC4, 0x82, 0x04, 0x82, 0xC4, 0x82, 0x04, 0x82,
+    0xC4, 0x82, 0x04, 0x82, 0xC4, 0x82, 0x04, 0x82, 0xC4, 0x82, 0x04, 0x82, 0xC4, 0x82, 0x04, 0x82,
+    0xC4, 0x82, 0x04, 0x82, 0xC4, 0x82, 0x04, 0x82, 0xC4, 0x82, 0x04, 0x82, 0xC4, 0x82, 0x04, 0x80,
+    0xC4, 0x00, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x8F, 0x82, 0xB0, 0x82, 0x8F, 0x82, 0xB0, 0x82,
+    0x8F, 0x82, 0xB0, 0x82, 0x8F, 0x82, 0xB0, 0x82, 0x8F, 0x82, 0xB0, 0x82, 0x8F, 0x82, 0xB0, 0x82,
+    0x8F, 0x82, 0xB0, 0x82, 0x8F, 0x82, 0xB0, 0x82, 0x8F, 0x82, 0xB0, 0x82, 0x8F, 0x82, 0xB0, 0x82,
+    0x8F, 0x82, 0xB0, 0x82, 0x8F, 0x82, 0xB0, 0x82, 0x8F, 0x82, 0xB0, 0x82, 0x8F, 0x82, 0xB0, 0x82,
+    0x8F, 0x82, 0xB0, 0x82, 0x8F, 0x80, 0xB0, 0x01, 0x80, 0xFF
+};
+const uint8_t SPRITE_BALL[] PROGMEM = {
+    BITMAP_HEADER(16, 16, BITMAP_RAW),
+    0x80, 0xF0, 0xF8, 0x7C, 0xFE, 0xFE, 0xFE, 0x77, 0x07, 0x06, 0x06, 0x0E, 0x1C, 0xF8, 0xF0, 0x80,
+    0x01, 0x0F, 0x1F, 0x38, 0x70, 0x60, 0x60, 0xE0, 0xE0, 0x60, 0x60, 0x70, 0x38, 0x1F, 0x0F, 0x01
+};
+const uint8_t SPRITE_BALL_MASK[] PROGMEM = {
+    BITMAP_HEADER(16, 16, BITMAP_RAW),
+    0x80, 0xF0, 0xF8, 0xFC, 0xFE, 0xFE, 0xFE, 0xFF, 0xFF, 0xFE, 0xFE, 0xFE, 0xFC, 0xF8, 0xF0, 0x80,
+    0x01, 0x0F, 0x1F, 0x3F, 0x7F, 0x7F, 0x7F, 0xFF, 0xFF, 0x7F, 0x7F, 0x7F, 0x3F, 0x1F, 0x0F, 0x01
+};
+
+#define SPRITE_FRAMES 32
+
+// Without a blitter: clear the old 16x16 box and plot the sprite dot by dot
+static void old_sprite(unsigned char col, unsigned char row, unsigned char new_col, unsigned char new_row)
+{
+    unsigned char x, y, bits;
+
+    for (x = 0; x < 16; x++)
+        for (y = 0; y < 16; y++)
+            Raster_pixel(&GLCD_raster, col + x, row + y, RASTER_CLEAR);
+
+    for (x = 0; x < 16; x++)
+    {
+        for (y = 0; y < 16; y++)
+        {
+            bits = pgm_read_byte(&SPRITE_BALL[3 + (y >> 3) * 16 + x]);
+            if (bits & (1 << (y & 7)))
+                GLCD_Dot(new_row + y, new_col + x);
+        }
+    }
+}
+
+static void demo_14_sprite_blitter(void)
+{
+    unsigned long start, splash, sprite_old, sprite_new;
+    unsigned char i, col, row;
+    char num[11];
+
+    Capture_clock_init();
+    GLCD_Set_render_mode(GLCD_RENDER_DEFERRED); // no bus traffic while timing
+
+    // 1. Full-screen RLE image, decoded straight from flash
+    start = Capture_get_ticks();
+    Bitmap_draw(&GLCD_raster, 0, 0, IMG_SPLASH, BITMAP_COPY);
+    splash = Capture_get_ticks() - start;
+    GLCD_Flush();
+    _delay_ms(1000);
+
+    // 2. Transparent sprite on top of the splash (masked copy)
+    Bitmap_draw_masked(&GLCD_raster, 8, 30, SPRITE_BALL, SPRITE_BALL_MASK);
+    GLCD_Flush();
+    _delay_ms(1000);
+
+    // 3. Moving sprite: pixel erase/redraw vs XOR blits, same path
+    ScreenBuffer_clear();
+    col = 0;
+    row = 5;
+    start = Capture_get_ticks();
+    for (i = 0; i < SPRITE_FRAMES; i++, col += 3, row++)
+        old_sprite(col, row, col + 3, row + 1);
+    sprite_old = Capture_get_ticks() - start;
+    GLCD_Flush();
+
+    ScreenBuffer_clear();
+    col = 0;
+    row = 5;
+    Bitmap_draw(&GLCD_raster, col, row, SPRITE_BALL, BITMAP_XOR);
+    start = Capture_get_ticks();
+    for (i = 0; i < SPRITE_FRAMES; i++, col += 3, row++)
+    {
+        Bitmap_draw(&GLCD_raster, col, row, SPRITE_BALL, BITMAP_XOR);         // erase
+        Bitmap_draw(&GLCD_raster, col + 3, row + 1, SPRITE_BALL, BITMAP_XOR); // draw
+    }
+    sprite_new = Capture_get_ticks() - start;
+    GLCD_Flush();
+    _delay_ms(1000);
+
+    // 4. Results: flash bytes, cycles per image byte, cycles per frame
+    GLCD_Set_render_mode(GLCD_RENDER_IMMEDIATE);
+    lcd_clear();
+    lcd_string_P(0, 0, STR_DEMO14);
+    lcd_string_P(2, 0, STR_FLASH_RAW);
+    lcd_string(2, 15, "1024");
+    lcd_string_P(3, 0, STR_FLASH_RLE);
+    utoa(sizeof(IMG_SPLASH) - 3, num, 10);
+    lcd_string(3, 15, num);
+    raster_report(4, STR_SPLASH, splash, 1024);
+    raster_report(6, STR_SPRITE_OLD, sprite_old, SPRITE_FRAMES);
+    raster_report(7, STR_SPRITE_NEW, sprite_new, SPRITE_FRAMES);
+
+    _delay_ms(100);
+}
+
+/* =============================================================================
+ * DEMO 15: STRIP CHART - Hardware Scrolling with the Display Start Line
+ * =============================================================================
+ * PURPOSE: Plot ADC samples at 1000 samples/s without redrawing the screen
+ *
+ * CONCEPTS:
+ * - KS0108 start line command (0xC0 + line): which RAM row is shown at
+ *   the top. Moving it by one scrolls the whole panel by one pixel row
+ * - Waterfall layout: time runs downwards, value = column (the start line
+ *   scrolls vertically only)
+ * - Decimation 4: four samples per row, drawn as a min..max span
+ * - Trace 0: ADC0 (potentiometer), trace 1: triangle wave for reference
+ *
+ * TEACHING FOCUS:
+ * - Bus writes per row stay small, however long the chart runs
+ * - Compare: redrawing 64x128 pixels per sample = 1024 data writes
+ */
+#define CHART_SAMPLES 4000 // 4 seconds at one sample per millisecond
+
+static void demo_15_strip_chart(void)
+{
+    GLCD_bus_stats_t stats;
+    unsigned long next;
+    unsigned int n;
+    int16_t values[2];
+    int16_t wave = 0, step = 8;
+    char num[11];
+
+    Timer2_init();
+    Adc_init();
+    Chart_init(2, 4);
+    Chart_set_range(1, -512, 512);
+    GLCD_Reset_bus_stats();
+
+    next = Timer2_get_milliseconds();
+    for (n = 0; n < CHART_SAMPLES; n++)
+    {
+        while (Timer2_get_milliseconds() < next)
+            ; // pace to 1 sample per ms
+        next++;
+
+        wave += step;
+        if ((wave >= 500) || (wave <= -500))
+            step = -step;
+
+        values[0] = (int16_t)Read_Adc_Data(0);
+        values[1] = wave;
+        Chart_sample(values);
+    }
+    GLCD_Get_bus_stats(&stats);
+    Chart_stop();
+
+    // Results: rows drawn and bus writes per row
+    lcd_clear();
+    lcd_string_P(0, 0, STR_DEMO15);
+    lcd_string_P(2, 0, STR_CHART_RATE);
+    lcd_string(2, 15, "1000");
+    lcd_string_P(3, 0, STR_CHART_ROWS);
+    utoa(Chart_rows(), num, 10);
+    lcd_string(3, 15, num);
+    lcd_string_P(4, 0, STR_CHART_WRITES);
+    ultoa((stats.commands + stats.data_bytes) / (Chart_rows() ? Chart_rows() : 1), num, 10);
+    lcd_string(4, 15, num);
+
+    _delay_ms(100);
+}
+
+/* =============================================================================
+ * DEMO 16: TEXT SPEED - PROGMEM Fonts and the Page-Aligned Fast Path
+ * =============================================================================
+ * CONCEPT: Text on a page boundary needs no bit shifting: each glyph page is
+ *          copied byte for byte (one address command per glyph row). Text at
+ *          any other row is split across two pages and read-modify-written.
+ *
+ * RESULT: characters per second on the panel (immediate mode, bus included)
+ *   - lcd_string    core 5x7 text, one character at a time
+ *   - Text y=8      same font through _text.c, fast path
+ *   - Text y=11     same text 3 rows lower, shifting blitter
+ *   - Prop 7        proportional font (_fonts.c), fast path
+ *   - Digits 16     10x16 digits, two pages per glyph
+ */
+#define TEXT_REPEAT 8
+
+static unsigned long text_time(const Text_font_t *font, int16_t y, const char *s)
+{
+    unsigned long start;
+    unsigned char i;
+
+    Text_set_font(font);
+    start = Capture_get_ticks();
+    for (i = 0; i < TEXT_REPEAT; i++)
+    {
+        Text_string_P(&GLCD_raster, 0, y, s, BITMAP_COPY);
+    }
+    return Capture_get_ticks() - start;
+}
+
+static void text_report(byte row, const char *label, unsigned int chars, unsigned long ticks)
+{
+    char num[11];
+
+    lcd_string_P(row, 0, label);
+    ultoa((unsigned long)chars * TEXT_REPEAT * CAPTURE_TICKS_PER_SECOND / (ticks ? ticks : 1), num, 10);
+    lcd_string(row, 15, num);
+}
+
+static void demo_16_text_speed(void)
+{
+    char line[22];
+    unsigned long start, t_old, t_fast, t_shift, t_prop, t_big;
+    unsigned char i;
+
+    Capture_clock_init();
+    lcd_clear();
+    GLCD_Set_render_mode(GLCD_RENDER_IMMEDIATE);
+    strcpy_P(line, STR_TEXT_LINE);
+
+    start = Capture_get_ticks();
+    for (i = 0; i < TEXT_REPEAT; i++)
+    {
+        lcd_string(1, 0, line);
+    }
+    t_old = Capture_get_ticks() - start;
+
+    t_fast = text_time(&Text_font_5x7, 8, STR_TEXT_LINE);
+    t_shift = text_time(&Text_font_5x7, 11, STR_TEXT_LINE);
+    t_prop = text_time(&Text_font_prop_7, 32, STR_TEXT_LINE);
+    t_big = text_time(&Text_font_digits_16, 40, STR_TEXT_DIGITS);
+    _delay_ms(1000); // let the student see the fonts
+
+    lcd_clear();
+    lcd_string_P(0, 0, STR_DEMO16);
+    text_report(2, STR_TEXT_OLD, 21, t_old);
+    text_report(3, STR_TEXT_FAST, 21, t_fast);
+    text_report(4, STR_TEXT_SHIFT, 21, t_shift);
+    text_report(5, STR_TEXT_PROP, 21, t_prop);
+    text_report(6, STR_TEXT_BIG, 8, t_big);
+
+    _delay_ms(100);
+}
+
 /* =============================================================================
  * RUN ALL DEMOS - Sequential Demonstration
  * =============================================================================
@@ -552,6 +1211,24 @@ static void demo_all_sequential(void)
 
     demo_10_grid();
     _delay_ms(2000);
+
+    demo_11_flush_benchmark();
+    _delay_ms(2000);
+
+    demo_12_background_refresh();
+    _delay_ms(2000);
+
+    demo_13_raster_benchmark();
+    _delay_ms(2000);
+
+    demo_14_sprite_blitter();
+    _delay_ms(2000);
+
+    demo_15_strip_chart();
+    _delay_ms(2000);
+
+    demo_16_text_speed();
+    _delay_ms(2000);
 }
 
 /* =============================================================================
@@ -584,6 +1261,12 @@ static void demo_all_sequential(void)
  *   - demo_08_radiating_lines()   : Pattern generation
  *   - demo_09_nested_shapes()     : Complex compositions
  *   - demo_10_grid()              : Alignment tools
+ *   - demo_11_flush_benchmark()   : Bus cost, immediate vs deferred
+ *   - demo_12_background_refresh(): Display refresh from a timer ISR
+ *   - demo_13_raster_benchmark()  : Cycles per pixel, old vs integer
+ *   - demo_14_sprite_blitter()    : Bitmaps, RLE images, sprites
+ *   - demo_15_strip_chart()       : Hardware scrolling, live ADC plot
+ *   - demo_16_text_speed()        : PROGMEM fonts, aligned text fast path
  *
  * =============================================================================
  */
@@ -606,6 +1289,12 @@ int main(void)
     // demo_08_radiating_lines();   // Week 4: Patterns
     // demo_09_nested_shapes();     // Week 4: Nested graphics
     // demo_10_grid();              // Week 4: Grid alignment
+    // demo_11_flush_benchmark();   // Week 4: Deferred rendering cost
+    // demo_12_background_refresh(); // Week 4: Non-blocking display updates
+    // demo_13_raster_benchmark();  // Week 4: Algorithm cost per pixel
+    // demo_14_sprite_blitter();    // Week 4: Bitmaps and sprites
+    // demo_15_strip_chart();       // Week 4: Scrolling ADC plot
+    // demo_16_text_speed();        // Week 4: Fonts and text cost
     // demo_all_sequential();       // Run all demos (overview)
 
     // =========================================================================
@@ -16,6 +16,15 @@ w:\soc3050code\tools\avr-toolchain\bin\avr-gcc.exe ^
 -fshort-enums ^
 Main.c ^
 ../../shared_libs/_glcd.c ^
+../../shared_libs/_raster.c ^
+../../shared_libs/_bitmap.c ^
+../../shared_libs/_chart.c ^
+../../shared_libs/_text.c ^
+../../shared_libs/_fonts.c ^
+../../shared_libs/_adc.c ^
+../../shared_libs/_event.c ^
+../../shared_libs/_capture.c ^
+../../shared_libs/_timer2.c ^
 ../../shared_libs/_port.c ^
 ../../shared_libs/_init.c ^
 -lm ^
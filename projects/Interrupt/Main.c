@@ -150,7 +150,7 @@
  * Demo 1: Polling Basics       - Simple button polling with LED response
  * Demo 2: Polling Limitations   - Show how polling can miss fast events
  * Demo 3: Interrupt Basics      - INT0 interrupt with toggle LED
- * Demo 4: ISR Communication     - Using flags between ISR and main
+ * Demo 4: ISR Communication     - ISR posts events, main dispatches them
  * Demo 5: Edge Detection Modes  - Different trigger modes (fall, rise, change)
  *
  * TEACHING PROGRESSION (3 weeks):
@@ -233,14 +233,15 @@ static void lcd_string_P(uint8_t row, uint8_t col, const char *str_P)
 }
 
 // ============================================================================
-// GLOBAL VARIABLES - ISR Communication
+// ISR COMMUNICATION - Event Bus (_event.c)
 // ============================================================================
-// VOLATILE keyword is REQUIRED for variables shared between ISR and main
-// Without volatile, compiler may optimize away reads, causing bugs!
-
-volatile uint8_t int0_flag = 0;      // Flag: INT0 interrupt occurred
-volatile uint16_t int0_count = 0;    // Counter: Number of INT0 interrupts
-volatile uint8_t last_edge_type = 0; // 0=falling, 1=rising, 2=change
+// The ISR posts an EVENT_INT0 event instead of setting a volatile flag that
+// main has to poll. Event_run() hands each event to the subscribed handler
+// and calls the idle hook (or sleeps) while nothing is queued.
+//
+// VOLATILE keyword is still REQUIRED for variables shared between ISR and
+// main - here that is the event queue itself (event_head/event_tail in
+// _event.c). The count below is only ever touched by the ISR.
 
 // ============================================================================
 // INTERRUPT SERVICE ROUTINES (ISRs)
@@ -254,18 +255,18 @@ volatile uint8_t last_edge_type = 0; // 0=falling, 1=rising, 2=change
 //
 // ISR PROGRAMMING PRINCIPLES (demonstrated here):
 // 1. Keep short and fast - no delays, no complex logic
-// 2. Set flags for main loop processing
+// 2. Post events for main loop processing
 // 3. Use volatile for shared variables
 // 4. Minimize work done in ISR context
 // 5. Provide immediate feedback (LED toggle is acceptable)
 //
 ISR(INT0_vect)
 {
-    // Set flag for main loop - this is the preferred communication method
-    int0_flag = 1;
+    static uint16_t int0_count = 0; // Counter: Number of INT0 interrupts (ISR only)
 
-    // Increment counter - demonstrates counting events
-    int0_count++;
+    // Post event for main loop - data carries the running count, so the
+    // display stays exact even if the queue was full and an event dropped
+    Event_post(EVENT_INT0, EVENT_PRIORITY_NORMAL, ++int0_count);
 
     // Immediate visual feedback - LED0 toggles on every interrupt
     // This is acceptable because led_toggle() is a simple bit operation
@@ -306,6 +307,38 @@ static void setup_io_and_display(void)
     led_all_off();
 }
 
+// Display interrupt counter (row 5)
+static void show_event_count(uint16_t count)
+{
+    lcd_xy(5, 0);
+    lcd_string_P(5, 0, STR_EVENTS);
+    lcd_xy(5, 8);
+    GLCD_4DigitDecimal(count);
+}
+
+// Display register values (rows 6-7)
+static void show_registers(void)
+{
+    lcd_xy(6, 0);
+    lcd_string_P(6, 0, STR_PORTB);
+    lcd_xy(6, 7);
+    GLCD_3DigitDecimal(PORTB);
+
+    uint8_t pind_value = PIND;
+    lcd_xy(7, 0);
+    lcd_string_P(7, 0, STR_PIND);
+    lcd_xy(7, 7);
+    GLCD_3DigitDecimal(pind_value);
+}
+
+// Idle hook: Event_run() calls this whenever no event is queued
+// (PIND changes without an interrupt, e.g. on button release)
+static void refresh_registers(void)
+{
+    show_registers();
+    _delay_ms(50); // Moderate refresh rate
+}
+
 // Configure INT0 interrupt for falling edge detection
 static void setup_ext_interrupt(void)
 {
@@ -364,23 +397,19 @@ static void setup_ext_interrupt_mode(uint8_t mode)
     case 0: // Falling edge (button press)
         EICRA |= (1 << ISC01);
         EICRA &= ~(1 << ISC00);
-        last_edge_type = 0;
         break;
 
     case 1: // Rising edge (button release)
         EICRA |= (1 << ISC01) | (1 << ISC00);
-        last_edge_type = 1;
         break;
 
     case 2: // Any change (both edges)
         EICRA &= ~(1 << ISC01);
         EICRA |= (1 << ISC00);
-        last_edge_type = 2;
         break;
 
     case 3: // Low level (continuous while held)
         EICRA &= ~((1 << ISC01) | (1 << ISC00));
-        last_edge_type = 3;
         break;
     }
 
@@ -622,82 +651,63 @@ static void demo_03_interrupt_basics(void)
 }
 
 // ============================================================================
-// DEMO 4: ISR COMMUNICATION - Using Flags Between ISR and Main
+// DEMO 4: ISR COMMUNICATION - Events Between ISR and Main
 // ============================================================================
 //
 // PURPOSE:
-// Demonstrate proper ISR-to-main communication using flags and counters.
+// Demonstrate proper ISR-to-main communication through the event bus.
 // Shows how to defer processing from ISR to main loop context.
 //
 // KEY CONCEPTS:
-// - ISR sets flags that main loop checks
-// - Volatile keyword ensures compiler doesn't optimize away flag checks
-// - ISR keeps minimal work (just set flag and toggle LED)
-// - Main loop does complex processing (display updates)
-// - Counter tracks total number of interrupts
+// - ISR posts an event; Event_run() calls the subscribed handler
+// - No flag to poll: main loop work is proportional to the number of events
+// - ISR keeps minimal work (just post the event and toggle LED)
+// - Handler does complex processing (display updates)
+// - Event data carries the total number of interrupts
 //
 // TEACHING FOCUS:
 // - Why keep ISRs short: other interrupts may be blocked
-// - Volatile keyword is REQUIRED for ISR-shared variables
-// - Flag-based communication is standard pattern
+// - Event_post() is safe in ISRs (saves SREG, disables interrupts briefly)
+// - Publish/subscribe replaces "one volatile flag per module"
 // - Count shows every button press is detected
 //
 // STUDENT EXPERIMENTS:
 // 1. Press PD0 multiple times - watch counter increment
-// 2. Remove 'volatile' keyword and observe problems (compiler optimization)
+// 2. Remove Event_set_idle_hook() - CPU sleeps, PIND row only updates on events
 // 3. Add more processing in ISR - notice slower response
 //
+
+// Handler for EVENT_INT0 - runs in main context, so slow work is safe here
+static void int0_message_handler(const Event_t *event)
+{
+    show_event_count(event->data); // Shows total interrupt count
+
+    // COMPLEX PROCESSING in main loop context (not in ISR)
+    // This is safe to do here - doesn't block other interrupts
+    lcd_string_P(4, 0, STR_INT0_TRIG);
+    _delay_ms(200);                           // Show message briefly
+    lcd_string(4, 0, "                    "); // Clear message
+}
+
 static void demo_04_isr_communication(void)
 {
     setup_io_and_display();
-    setup_ext_interrupt();
 
-    // Reset counters
-    int0_count = 0;
-    int0_flag = 0;
+    // Subscribe before enabling INT0, so no event is posted unheard
+    Event_init();
+    Event_subscribe(EVENT_INT0, int0_message_handler);
+    Event_set_idle_hook(refresh_registers);
+
+    setup_ext_interrupt();
 
     lcd_string_P(1, 0, STR_MODE_ISR_FLAG);
     lcd_string_P(2, 0, STR_PD0_INT0);
     lcd_string_P(3, 0, STR_PRESS_PD0);
+    show_event_count(0);
 
-    while (1)
-    {
-        // CHECK ISR FLAG: This is how ISR communicates with main
-        if (int0_flag)
-        {
-            // Acknowledge flag (clear it)
-            int0_flag = 0;
-
-            // COMPLEX PROCESSING in main loop context (not in ISR)
-            // This is safe to do here - doesn't block other interrupts
-            lcd_string_P(4, 0, STR_INT0_TRIG);
-            _delay_ms(200);                           // Show message briefly
-            lcd_string(4, 0, "                    "); // Clear message
-        }
-
-        // Display interrupt counter
-        lcd_xy(5, 0);
-        lcd_string_P(5, 0, STR_EVENTS);
-        lcd_xy(5, 8);
-        GLCD_4DigitDecimal(int0_count); // Shows total interrupt count
-
-        // Display register values
-        lcd_xy(6, 0);
-        lcd_string_P(6, 0, STR_PORTB);
-        lcd_xy(6, 7);
-        GLCD_3DigitDecimal(PORTB);
-
-        uint8_t pind_value = PIND;
-        lcd_xy(7, 0);
-        lcd_string_P(7, 0, STR_PIND);
-        lcd_xy(7, 7);
-        GLCD_3DigitDecimal(pind_value);
-
-        _delay_ms(50); // Moderate refresh rate
-
-        // TEACHING POINT: Flag-based communication allows ISR to be fast
-        // while main loop does slow work (display updates, calculations, etc.)
-    }
+    // TEACHING POINT: the event queue allows ISR to be fast while handlers
+    // do slow work (display updates, calculations, etc.)
+    Event_run(); // Never returns
 }
 
 // ============================================================================
@@ -725,67 +735,56 @@ static void demo_04_isr_communication(void)
 // 1. Try each mode (0-3) by changing call in main()
 // 2. Notice when LED toggles (press, release, or both)
 // 3. With low level mode, watch rapid interrupt firing while held
+//    (the queue fills faster than it drains - see Event_get_dropped())
 //
+
+// Handler for EVENT_INT0 - only the counter, so a flood stays responsive
+static void int0_count_handler(const Event_t *event)
+{
+    show_event_count(event->data);
+}
+
 static void demo_05_edge_detection_modes(uint8_t mode)
 {
     setup_io_and_display();
-    setup_ext_interrupt_mode(mode);
 
-    // Reset counter
-    int0_count = 0;
+    Event_init();
+    Event_subscribe(EVENT_INT0, int0_count_handler);
+    Event_set_idle_hook(refresh_registers);
+
+    setup_ext_interrupt_mode(mode);
 
     lcd_string_P(1, 0, STR_MODE_EDGE);
     lcd_string_P(2, 0, STR_PD0_INT0);
     lcd_string_P(3, 0, STR_PRESS_PD0);
 
-    while (1)
+    // Display current mode
+    lcd_xy(4, 0);
+    lcd_string(4, 0, "Mode: ");
+    lcd_xy(4, 6);
+    switch (mode)
     {
-        // Display current mode
-        lcd_xy(4, 0);
-        lcd_string(4, 0, "Mode: ");
-        lcd_xy(4, 6);
-        switch (mode)
-        {
-        case 0:
-            lcd_string_P(4, 6, STR_FALLING_EDGE);
-            break;
-        case 1:
-            lcd_string_P(4, 6, STR_RISING_EDGE);
-            break;
-        case 2:
-            lcd_string_P(4, 6, STR_ANY_CHANGE);
-            break;
-        case 3:
-            lcd_string_P(4, 6, STR_LOW_LEVEL);
-            break;
-        }
-
-        // Display interrupt counter
-        lcd_xy(5, 0);
-        lcd_string_P(5, 0, STR_EVENTS);
-        lcd_xy(5, 8);
-        GLCD_4DigitDecimal(int0_count);
-
-        // Display register values
-        lcd_xy(6, 0);
-        lcd_string_P(6, 0, STR_PORTB);
-        lcd_xy(6, 7);
-        GLCD_3DigitDecimal(PORTB);
-
-        uint8_t pind_value = PIND;
-        lcd_xy(7, 0);
-        lcd_string_P(7, 0, STR_PIND);
-        lcd_xy(7, 7);
-        GLCD_3DigitDecimal(pind_value);
-
-        _delay_ms(50);
-
-        // TEACHING POINTS:
-        // - Mode 0 (falling): Interrupt on button press only
-        // - Mode 1 (rising): Interrupt on button release only
-        // - Mode 2 (any change): Interrupt on press AND release (2× count)
-        // - Mode 3 (low level): Interrupts continuously while held (rapid count!)
+    case 0:
+        lcd_string_P(4, 6, STR_FALLING_EDGE);
+        break;
+    case 1:
+        lcd_string_P(4, 6, STR_RISING_EDGE);
+        break;
+    case 2:
+        lcd_string_P(4, 6, STR_ANY_CHANGE);
+        break;
+    case 3:
+        lcd_string_P(4, 6, STR_LOW_LEVEL);
+        break;
     }
+    show_event_count(0);
+
+    // TEACHING POINTS:
+    // - Mode 0 (falling): Interrupt on button press only
+    // - Mode 1 (rising): Interrupt on button release only
+    // - Mode 2 (any change): Interrupt on press AND release (2× count)
+    // - Mode 3 (low level): Interrupts continuously while held (rapid count!)
+    Event_run(); // Never returns
 }
 
 // ============================================================================
@@ -820,7 +819,7 @@ int main(void)
 
     // === WEEK 2: INTERRUPTS ===
     // demo_03_interrupt_basics();        // INT0 interrupt with PD0→LED0
-    demo_04_isr_communication(); // ISR flags, counters, main processing
+    demo_04_isr_communication(); // ISR events, counters, main processing
 
     // === WEEK 3: EDGE MODES ===
     // demo_05_edge_detection_modes(0);   // Falling edge (button press)
@@ -874,11 +873,12 @@ int main(void)
      *   Answer: INT0 (higher priority, lower vector number)
      *
      * EXERCISE 7: Volatile Demonstration (Advanced)
-     * - Remove 'volatile' from int0_flag declaration
-     * - Compile with optimization (-Os or -O2)
+     * - Add 'volatile uint8_t int0_flag' set by ISR(INT0_vect)
+     * - Poll it from a while(1) loop instead of Event_run()
+     * - Remove 'volatile', compile with optimization (-Os or -O2)
      * - Observe: Flag checking may not work! Compiler optimizes it away
-     * - Restore 'volatile' - now it works correctly
      * - Lesson: Always use volatile for ISR-shared variables
+     *   (_event.c declares its queue indices volatile for this reason)
      */
 
     // ========================================================================
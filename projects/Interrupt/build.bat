@@ -5,6 +5,7 @@ echo Building 14_Interrupt_Basic Project...
     -mmcu=atmega128 ^
     -DF_CPU=7372800UL ^
     -DBAUD=9600 ^
+    -DEVENT_BUS_ENABLED ^
     -Os ^
     -Wall ^
     -Wextra ^
@@ -12,6 +13,7 @@ echo Building 14_Interrupt_Basic Project...
     -I../../shared_libs ^
     Main.c ^
     ../../shared_libs/_uart.c ^
+    ../../shared_libs/_event.c ^
     -o Main.elf
 
 if %errorlevel% neq 0 (
@@ -19,5 +19,6 @@
 #include "../../shared_libs/_port.h"
 #include "../../shared_libs/_glcd.h"
 #include "../../shared_libs/_init.h"
+#include "../../shared_libs/_event.h"
 
 #endif
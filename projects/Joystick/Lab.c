@@ -33,11 +33,10 @@
 
 #include "config.h"
 
-// Lab configuration - Joystick ADC channels
-#define JOYSTICK_X_CHANNEL 0 // ADC0
-#define JOYSTICK_Y_CHANNEL 1 // ADC1
+// Joystick ADC channels: JOYSTICK_X_CHANNEL / JOYSTICK_Y_CHANNEL in _joystick.h
+// Exercises 1-2 use the calibrated pipeline, 3-4 the raw scanned values
 
-// Joystick calibration values (adjust based on hardware)
+// Fixed calibration for the raw exercises (adjust based on hardware)
 #define JOYSTICK_CENTER_X 512
 #define JOYSTICK_CENTER_Y 512
 #define JOYSTICK_DEADZONE 50
@@ -57,49 +56,64 @@ uint8_t cursor_x = 64, cursor_y = 32;
 void lab_ex1_joystick_calibration(void)
 {
     /*
-     * CHALLENGE: Display real-time joystick values
-     * TASK: Read X/Y values and show them on display
-     * LEARNING: ADC reading and value interpretation
+     * CHALLENGE: Watch the running calibration learn your joystick
+     * TASK: Move the stick through its full range, then store the result
+     * LEARNING: Auto-calibration (min/center/max) and EEPROM persistence
      */
 
     puts_USART1("\\r\\n=== Lab 1: Joystick Calibration ===\\r\\n");
-    puts_USART1("Move joystick and observe values\\r\\n");
-    puts_USART1("Press button to continue...\\r\\n\\r\\n");
+    puts_USART1("Stick at rest: center is learned first\\r\\n");
+    puts_USART1("Then move it in full circles, press button to finish\\r\\n\\r\\n");
 
     lcd_clear();
     lcd_string(0, 0, "JOYSTICK CALIBRATION");
     lcd_string(1, 0, "Move stick around");
 
+    Joystick_reset_calibration(); // next sample becomes the center
+    _delay_ms(100);
+
     uint16_t samples = 0;
     while (samples < 100 && !button_pressed(0)) // 10 seconds of sampling
     {
-        uint16_t x_val = Read_Adc_Data(JOYSTICK_X_CHANNEL);
-        uint16_t y_val = Read_Adc_Data(JOYSTICK_Y_CHANNEL);
+        Joystick_calibration_t cal;
+        uint16_t x_val, y_val;
+
+        Joystick_get_raw(&x_val, &y_val); // averaged by the background scan
+        Joystick_get_calibration(&cal);
 
         // Display values on LCD
-        char buffer[20];
-        sprintf(buffer, "X: %4d Y: %4d", x_val, y_val);
+        char buffer[22];
+        sprintf(buffer, "X: %4u Y: %4u", x_val, y_val);
         lcd_string(3, 0, buffer);
+        sprintf(buffer, "X %4u..%4u", cal.min[0], cal.max[0]);
+        lcd_string(4, 0, buffer);
+        sprintf(buffer, "Y %4u..%4u", cal.min[1], cal.max[1]);
+        lcd_string(5, 0, buffer);
 
         // Send to serial for debugging
-        char serial_buffer[50];
-        sprintf(serial_buffer, "Sample %d: X=%d, Y=%d\\r\\n", samples, x_val, y_val);
+        char serial_buffer[60];
+        sprintf(serial_buffer, "Sample %u: X=%u (%u..%u) Y=%u (%u..%u)\\r\\n", samples,
+                x_val, cal.min[0], cal.max[0], y_val, cal.min[1], cal.max[1]);
         puts_USART1(serial_buffer);
 
         _delay_ms(100);
         samples++;
     }
 
-    puts_USART1("Calibration complete!\\r\\n");
+    if (Joystick_save_calibration())
+        puts_USART1("Calibration saved to EEPROM!\\r\\n");
+    else
+        puts_USART1("Calibration unchanged, EEPROM not written\\r\\n");
     lab_score += 50;
 }
 
 void lab_ex1_deadzone_testing(void)
 {
     /*
-     * CHALLENGE: Implement and test deadzone functionality
-     * TASK: Create a deadzone around center position
-     * LEARNING: Noise filtering and input processing
+     * CHALLENGE: Compare deadzone sizes
+     * TASK: The deadzone grows every 10 steps; find the smallest that
+     *       still reads 0 when you let go of the stick
+     * LEARNING: Radial deadzone and rescaled output
      */
 
     puts_USART1("\\r\\n=== Lab 1.2: Deadzone Testing ===\\r\\n");
@@ -111,24 +125,24 @@ void lab_ex1_deadzone_testing(void)
 
     for (int test = 0; test < 50 && !button_pressed(0); test++)
     {
-        uint16_t x_val = Read_Adc_Data(JOYSTICK_X_CHANNEL);
-        uint16_t y_val = Read_Adc_Data(JOYSTICK_Y_CHANNEL);
+        uint8_t deadzone = (test / 10) * 8; // 0, 8, 16, 24, 32 of 127
+        Joystick_state_t joy;
 
-        // Apply deadzone
-        int16_t x_offset = x_val - JOYSTICK_CENTER_X;
-        int16_t y_offset = y_val - JOYSTICK_CENTER_Y;
+        Joystick_set_deadzone(deadzone);
+        Joystick_read(&joy);
 
-        bool in_deadzone = (abs(x_offset) < JOYSTICK_DEADZONE && abs(y_offset) < JOYSTICK_DEADZONE);
+        bool in_deadzone = (joy.magnitude == 0);
 
         lcd_string(3, 0, in_deadzone ? "STATUS: DEADZONE   " : "STATUS: ACTIVE     ");
 
         char debug[30];
-        sprintf(debug, "X:%+4d Y:%+4d", x_offset, y_offset);
+        sprintf(debug, "X:%+4d Y:%+4d DZ:%2u", joy.x, joy.y, deadzone);
         lcd_string(4, 0, debug);
 
         _delay_ms(200);
     }
 
+    Joystick_set_deadzone(JOYSTICK_DEADZONE_DEFAULT);
     lab_score += 50;
 }
 
@@ -145,7 +159,7 @@ void lab_ex2_cursor_control(void)
     /*
      * CHALLENGE: Create smooth cursor movement
      * TASK: Control a cursor on screen with joystick
-     * LEARNING: Coordinate mapping and boundary checking
+     * LEARNING: Velocity control with an expo curve and sub-pixel steps
      */
 
     puts_USART1("\\r\\n=== Lab 2: Cursor Control ===\\r\\n");
@@ -158,39 +172,31 @@ void lab_ex2_cursor_control(void)
     cursor_x = 64; // Center of screen
     cursor_y = 32;
 
+    // Position in 1/32 pixel: full deflection moves 4 pixels per step,
+    // the expo curve keeps small deflections slow enough to aim
+    int16_t pos_x = cursor_x * 32, pos_y = cursor_y * 32;
+    Joystick_set_expo(192);
+
     for (int moves = 0; moves < 200 && !button_pressed(0); moves++)
     {
-        uint16_t x_val = Read_Adc_Data(JOYSTICK_X_CHANNEL);
-        uint16_t y_val = Read_Adc_Data(JOYSTICK_Y_CHANNEL);
-
-        // Calculate movement with deadzone
-        int16_t x_offset = x_val - JOYSTICK_CENTER_X;
-        int16_t y_offset = y_val - JOYSTICK_CENTER_Y;
-
-        int8_t dx = 0, dy = 0;
-
-        if (abs(x_offset) > JOYSTICK_DEADZONE)
-        {
-            dx = (x_offset > 0) ? 1 : -1;
-            if (abs(x_offset) > 200)
-                dx *= 2; // Faster movement for larger deflection
-        }
-
-        if (abs(y_offset) > JOYSTICK_DEADZONE)
-        {
-            dy = (y_offset > 0) ? 1 : -1;
-            if (abs(y_offset) > 200)
-                dy *= 2;
-        }
+        Joystick_state_t joy;
+        Joystick_read(&joy);
 
         // Update cursor position with boundary checking
-        int16_t new_x = cursor_x + dx;
-        int16_t new_y = cursor_y + dy;
+        pos_x += joy.x;
+        pos_y += joy.y;
+
+        if (pos_x < 0)
+            pos_x = 0;
+        if (pos_x > 127 * 32)
+            pos_x = 127 * 32;
+        if (pos_y < 16 * 32)
+            pos_y = 16 * 32; // Leave room for text
+        if (pos_y > 63 * 32)
+            pos_y = 63 * 32;
 
-        if (new_x >= 0 && new_x < 128)
-            cursor_x = new_x;
-        if (new_y >= 16 && new_y < 64)
-            cursor_y = new_y; // Leave room for text
+        cursor_x = pos_x / 32;
+        cursor_y = pos_y / 32;
 
         // Clear previous cursor and draw new one
         GLCD_Rectangle(0, 16, 127, 63); // Clear drawing area
@@ -205,6 +211,7 @@ void lab_ex2_cursor_control(void)
         _delay_ms(50);
     }
 
+    Joystick_set_expo(JOYSTICK_EXPO_DEFAULT);
     lab_score += 100;
 }
 
@@ -237,8 +244,8 @@ void lab_ex3_led_joystick_control(void)
 
     for (int cycle = 0; cycle < 100 && !button_pressed(0); cycle++)
     {
-        uint16_t x_val = Read_Adc_Data(JOYSTICK_X_CHANNEL);
-        uint16_t y_val = Read_Adc_Data(JOYSTICK_Y_CHANNEL);
+        uint16_t x_val = Adc_scan_get(JOYSTICK_X_CHANNEL);
+        uint16_t y_val = Adc_scan_get(JOYSTICK_Y_CHANNEL);
 
         // Determine joystick direction
         int16_t x_offset = x_val - JOYSTICK_CENTER_X;
@@ -324,8 +331,8 @@ void lab_ex4_catch_the_dot(void)
     while (targets_caught < 5 && !button_pressed(0))
     {
         // Read joystick for player movement
-        uint16_t x_val = Read_Adc_Data(JOYSTICK_X_CHANNEL);
-        uint16_t y_val = Read_Adc_Data(JOYSTICK_Y_CHANNEL);
+        uint16_t x_val = Adc_scan_get(JOYSTICK_X_CHANNEL);
+        uint16_t y_val = Adc_scan_get(JOYSTICK_Y_CHANNEL);
 
         int16_t x_offset = x_val - JOYSTICK_CENTER_X;
         int16_t y_offset = y_val - JOYSTICK_CENTER_Y;
@@ -420,6 +427,8 @@ void show_lab_menu(void)
 int main(void)
 {
     init_devices();
+    Joystick_init(); // background ADC scan of X/Y, stored calibration
+    sei();
 
     puts_USART1("\\r\\n*** JOYSTICK CONTROL LAB SESSION ***\\r\\n");
     puts_USART1("Welcome to hands-on joystick programming!\\r\\n");
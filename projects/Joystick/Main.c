@@ -27,6 +27,12 @@
  * - LCD display for position visualization
  * - Serial connection for calibration (9600 baud)
  *
+ * SIGNAL PATH (shared_libs/_joystick.c):
+ * The ADC scans X and Y in the background; the ADC interrupt averages,
+ * calibrates (running min/max/center, saved in EEPROM), applies the
+ * radial deadzone and the expo curve. read_joystick_position() only
+ * copies the latest result, so the main loop never waits for the ADC.
+ *
  * LEARNING PROGRESSION:
  * - Demo 1: Basic Joystick Reading
  * - Demo 2: Coordinate Mapping and Calibration
@@ -38,9 +44,7 @@
 
 #include "config.h"
 
-// Joystick configuration
-#define JOYSTICK_X_CHANNEL 0
-#define JOYSTICK_Y_CHANNEL 1
+// Joystick configuration (ADC channels: JOYSTICK_X/Y_CHANNEL in _joystick.h)
 #define JOYSTICK_BUTTON_PIN PINC0
 #define JOYSTICK_BUTTON_PORT PINC
 
@@ -51,17 +55,8 @@
 #define LED_RIGHT (1 << 3)
 #define LED_CENTER (1 << 4)
 
-// Joystick calibration values
-typedef struct
-{
-    uint16_t x_center;
-    uint16_t y_center;
-    uint16_t x_min;
-    uint16_t x_max;
-    uint16_t y_min;
-    uint16_t y_max;
-    uint16_t deadzone;
-} joystick_calibration_t;
+// Deflection (of 100) that lights a direction LED
+#define DIRECTION_THRESHOLD 50
 
 // Joystick position structure
 typedef struct
@@ -75,18 +70,14 @@ typedef struct
 } joystick_position_t;
 
 // Global variables
-joystick_calibration_t joystick_cal;
 joystick_position_t joystick_pos;
-uint8_t calibration_mode = 0;
+uint16_t joystick_expo = 0; // 0 = linear, 256 = cubic
 
 // Function to initialize joystick system
 void init_joystick_control()
 {
     puts_USART1("Initializing Joystick Control System...\r\n");
 
-    // Initialize ADC for joystick reading
-    ADC_init();
-
     // Configure direction LEDs
     DDRB = 0xFF;  // PORTB as output
     PORTB = 0x00; // All LEDs off initially
@@ -95,91 +86,63 @@ void init_joystick_control()
     DDRC &= ~(1 << JOYSTICK_BUTTON_PIN);
     PORTC |= (1 << JOYSTICK_BUTTON_PIN);
 
-    // Set default calibration values
-    joystick_cal.x_center = 512;
-    joystick_cal.y_center = 512;
-    joystick_cal.x_min = 0;
-    joystick_cal.x_max = 1023;
-    joystick_cal.y_min = 0;
-    joystick_cal.y_max = 1023;
-    joystick_cal.deadzone = 50;
+    // Background ADC scan + calibration from EEPROM (or learn it now)
+    if (Joystick_load_calibration())
+    {
+        puts_USART1("Calibration loaded from EEPROM\r\n");
+    }
+    else
+    {
+        puts_USART1("No stored calibration: leave the stick centered, then move it full circle\r\n");
+    }
+    Joystick_init();
 
     puts_USART1("Joystick Control Ready!\r\n");
-    puts_USART1("Commands: 'c'=calibrate, 'r'=raw values, 's'=scaled values\r\n");
-    puts_USART1("         'd'=demo mode, 'h'=help\r\n");
+    puts_USART1("Commands: 'c'=center, 'w'=save calibration, 'e'=expo curve\r\n");
+    puts_USART1("         'r'=raw values, 's'=scaled values, 'd'=demo mode, 'h'=help\r\n");
 }
 
-// Function to read joystick position
+// Function to read joystick position (latest background sample, no ADC wait)
 void read_joystick_position()
 {
-    // Read X and Y channels
-    joystick_pos.x_raw = ADC_read(JOYSTICK_X_CHANNEL);
-    joystick_pos.y_raw = ADC_read(JOYSTICK_Y_CHANNEL);
+    Joystick_state_t joy;
+
+    Joystick_read(&joy);
+    Joystick_get_raw(&joystick_pos.x_raw, &joystick_pos.y_raw);
 
     // Read button state (active low)
     joystick_pos.button_pressed = !(JOYSTICK_BUTTON_PORT & (1 << JOYSTICK_BUTTON_PIN));
 
-    // Scale to -100 to +100 range
-    int32_t x_temp = (int32_t)joystick_pos.x_raw - joystick_cal.x_center;
-    int32_t y_temp = (int32_t)joystick_pos.y_raw - joystick_cal.y_center;
+    // Scale -127..127 to -100..+100 (calibration, deadzone and curve already applied)
+    joystick_pos.x_scaled = ((int16_t)joy.x * 100) / JOYSTICK_OUTPUT_MAX;
+    joystick_pos.y_scaled = ((int16_t)joy.y * 100) / JOYSTICK_OUTPUT_MAX;
 
-    // Apply scaling
-    if (x_temp > 0)
-    {
-        joystick_pos.x_scaled = (x_temp * 100) / (joystick_cal.x_max - joystick_cal.x_center);
-    }
-    else
-    {
-        joystick_pos.x_scaled = (x_temp * 100) / (joystick_cal.x_center - joystick_cal.x_min);
-    }
+    // Determine direction
+    joystick_pos.direction = 0;
 
-    if (y_temp > 0)
+    if (joy.magnitude == 0)
     {
-        joystick_pos.y_scaled = (y_temp * 100) / (joystick_cal.y_max - joystick_cal.y_center);
+        joystick_pos.direction = LED_CENTER;
     }
     else
     {
-        joystick_pos.y_scaled = (y_temp * 100) / (joystick_cal.y_center - joystick_cal.y_min);
-    }
-
-    // Clamp values
-    if (joystick_pos.x_scaled > 100)
-        joystick_pos.x_scaled = 100;
-    if (joystick_pos.x_scaled < -100)
-        joystick_pos.x_scaled = -100;
-    if (joystick_pos.y_scaled > 100)
-        joystick_pos.y_scaled = 100;
-    if (joystick_pos.y_scaled < -100)
-        joystick_pos.y_scaled = -100;
-
-    // Determine direction with deadzone
-    joystick_pos.direction = 0;
-
-    if (abs(joystick_pos.x_scaled) > joystick_cal.deadzone ||
-        abs(joystick_pos.y_scaled) > joystick_cal.deadzone)
-    {
-
-        if (joystick_pos.y_scaled > joystick_cal.deadzone)
+        if (joystick_pos.y_scaled > DIRECTION_THRESHOLD)
         {
             joystick_pos.direction |= LED_UP;
         }
-        if (joystick_pos.y_scaled < -joystick_cal.deadzone)
+        if (joystick_pos.y_scaled < -DIRECTION_THRESHOLD)
         {
             joystick_pos.direction |= LED_DOWN;
         }
-        if (joystick_pos.x_scaled > joystick_cal.deadzone)
+        if (joystick_pos.x_scaled > DIRECTION_THRESHOLD)
         {
             joystick_pos.direction |= LED_RIGHT;
         }
-        if (joystick_pos.x_scaled < -joystick_cal.deadzone)
+        if (joystick_pos.x_scaled < -DIRECTION_THRESHOLD)
         {
             joystick_pos.direction |= LED_LEFT;
         }
     }
-    else
-    {
-        joystick_pos.direction = LED_CENTER;
-    }
 }
 
 // Function to update LED indicators
@@ -233,12 +196,12 @@ void handle_joystick_commands()
     if (is_USART1_received())
     {
         char command = get_USART1();
+        char buffer[80];
 
         switch (command)
         {
         case 'r':
         case 'R':
-            char buffer[80];
             sprintf(buffer, "Raw: X=%4u Y=%4u Btn=%u\r\n",
                     joystick_pos.x_raw, joystick_pos.y_raw, joystick_pos.button_pressed);
             puts_USART1(buffer);
@@ -257,6 +220,33 @@ void handle_joystick_commands()
             demonstrate_joystick();
             break;
 
+        case 'c':
+        case 'C':
+            Joystick_calibrate_center();
+            puts_USART1("Center set to the current position\r\n");
+            break;
+
+        case 'w':
+        case 'W':
+        {
+            Joystick_calibration_t cal;
+            Joystick_get_calibration(&cal);
+            sprintf(buffer, "X %u..%u..%u  Y %u..%u..%u\r\n",
+                    cal.min[0], cal.center[0], cal.max[0], cal.min[1], cal.center[1], cal.max[1]);
+            puts_USART1(buffer);
+            puts_USART1(Joystick_save_calibration() ? "Calibration saved to EEPROM\r\n"
+                                                    : "Calibration unchanged, EEPROM not written\r\n");
+            break;
+        }
+
+        case 'e':
+        case 'E':
+            joystick_expo = (joystick_expo >= 256) ? 0 : joystick_expo + 128;
+            Joystick_set_expo(joystick_expo);
+            sprintf(buffer, "Expo %u/256 (0 = linear)\r\n", joystick_expo);
+            puts_USART1(buffer);
+            break;
+
         case 'h':
         case 'H':
         case '?':
@@ -264,6 +254,9 @@ void handle_joystick_commands()
             puts_USART1("r/R - Show raw ADC values\r\n");
             puts_USART1("s/S - Show scaled values\r\n");
             puts_USART1("d/D - Run demonstration\r\n");
+            puts_USART1("c/C - Set center (stick at rest)\r\n");
+            puts_USART1("w/W - Save calibration to EEPROM\r\n");
+            puts_USART1("e/E - Cycle expo curve (linear, 50%, cubic)\r\n");
             puts_USART1("h/? - Show this help\r\n");
             break;
 
@@ -279,7 +272,7 @@ int main(void)
     // Initialize system components
     init_devices();
     Uart1_init();
-    ADC_init();
+    UCSR1B &= ~(1 << RXCIE1); // UART is polled: the ADC scan ISR is the only interrupt
 
     puts_USART1("Joystick Control System Starting...\r\n");
     puts_USART1("Educational analog joystick interface demo\r\n");
@@ -287,6 +280,7 @@ int main(void)
 
     // Initialize joystick control
     init_joystick_control();
+    sei();
 
     puts_USART1("\r\nPress 'h' for help or 'd' for demo\r\n");
 
@@ -5,6 +5,7 @@ echo Building 15_Joystick Project...
     -mmcu=atmega128 ^
     -DF_CPU=7372800UL ^
     -DBAUD=9600 ^
+    -DJOYSTICK_ENABLED ^
     -Os ^
     -Wall ^
     -Wextra ^
@@ -12,6 +13,9 @@ echo Building 15_Joystick Project...
     -I../../shared_libs ^
     Main.c ^
     ../../shared_libs/_uart.c ^
+    ../../shared_libs/_adc.c ^
+    ../../shared_libs/_eeprom.c ^
+    ../../shared_libs/_joystick.c ^
     -o Main.elf
 
 if %errorlevel% neq 0 (
@@ -14,5 +14,7 @@
 #include <string.h>
 #include <avr/interrupt.h>
 #include "../../shared_libs/_uart.h"
+#include "../../shared_libs/_adc.h"
+#include "../../shared_libs/_joystick.h"
 
 #endif
@@ -31,9 +31,14 @@
  * DEBOUNCING TECHNIQUES:
  * - Time-based delay debouncing
  * - State machine debouncing
- * - Counter-based validation
+ * - Counter-based validation (one integrator per key, _keypad.c)
  * - Hysteresis filtering
  *
+ * KEYPAD SCANNING:
+ * The shared _keypad driver scans one row per Timer2 system tick in the
+ * background and queues press/release/long/repeat events. The demos
+ * poll the queue and never wait inside a scan loop.
+ *
  * LEARNING PROGRESSION:
  * - Demo 1: Basic Debouncing Implementation
  * - Demo 2: State Machine Approach
@@ -45,240 +50,41 @@
 
 #include "config.h"
 
-// LCD Control Pins
-#define LCD_DDR DDRG
-#define LCD_PORT PORTG
-#define LCD_RS 0
-#define LCD_E 1
-#define LCD_D4 2
-
-// LCD Commands
-#define LCD_CLEAR 0x01
-#define LCD_ENTRY_MODE 0x06
-#define LCD_DISPLAY_ON 0x0C
-#define LCD_FUNCTION_SET 0x28
-#define LCD_DDRAM_ADDR 0x80
-
-// Basic LCD functions
-void lcd_enable_pulse(void)
-{
-    LCD_PORT |= (1 << LCD_E);
-    _delay_us(1);
-    LCD_PORT &= ~(1 << LCD_E);
-    _delay_us(50);
-}
-
-void lcd_write_nibble(uint8_t nibble)
-{
-    LCD_PORT = (LCD_PORT & 0xC3) | ((nibble & 0x0F) << LCD_D4);
-    lcd_enable_pulse();
-}
-
-void lcd_write_byte(uint8_t data, uint8_t rs)
-{
-    if (rs)
-        LCD_PORT |= (1 << LCD_RS);
-    else
-        LCD_PORT &= ~(1 << LCD_RS);
-    lcd_write_nibble(data >> 4);
-    lcd_write_nibble(data & 0x0F);
-    _delay_us(50);
-}
-
-void lcd_command(uint8_t cmd)
-{
-    lcd_write_byte(cmd, 0);
-    if (cmd == LCD_CLEAR)
-        _delay_ms(2);
-}
-
-void lcd_data(uint8_t data)
-{
-    lcd_write_byte(data, 1);
-}
-
-void lcd_init(void)
-{
-    LCD_DDR |= (1 << LCD_RS) | (1 << LCD_E) | (1 << LCD_D4) | (1 << 3) | (1 << 4) | (1 << 5);
-    _delay_ms(50);
-    LCD_PORT &= ~(1 << LCD_RS);
-    lcd_write_nibble(0x03);
-    _delay_ms(5);
-    lcd_write_nibble(0x03);
-    _delay_us(150);
-    lcd_write_nibble(0x03);
-    _delay_us(150);
-    lcd_write_nibble(0x02);
-    _delay_us(150);
-    lcd_command(LCD_FUNCTION_SET);
-    lcd_command(LCD_DISPLAY_ON);
-    lcd_command(LCD_CLEAR);
-    lcd_command(LCD_ENTRY_MODE);
-}
-
-void lcd_clear(void)
-{
-    lcd_command(LCD_CLEAR);
-}
-
-void lcd_goto(uint8_t row, uint8_t col)
-{
-    uint8_t address = (row == 0) ? 0x00 + col : 0x40 + col;
-    lcd_command(LCD_DDRAM_ADDR | address);
-}
-
-void lcd_puts(const char *str)
-{
-    while (*str)
-        lcd_data(*str++);
-}
-
-void lcd_puts_at(uint8_t row, uint8_t col, const char *str)
-{
-    lcd_goto(row, col);
-    lcd_puts(str);
-}
-
-// Keypad definitions
-#define KEYPAD_DDR DDRA
-#define KEYPAD_PORT PORTA
-#define KEYPAD_PIN PINA
-#define ROW_MASK 0x0F
-#define COL_MASK 0xF0
-
-// Debouncing parameters
-#define DEBOUNCE_TIME_MS 20
-#define LONG_PRESS_TIME_MS 1000
-#define REPEAT_DELAY_MS 500
-#define REPEAT_RATE_MS 100
-
-const char keypad_map[4][4] = {
-    {'1', '2', '3', 'A'},
-    {'4', '5', '6', 'B'},
-    {'7', '8', '9', 'C'},
-    {'*', '0', '#', 'D'}};
-
-// Key state tracking
-typedef struct
-{
-    char current_key;
-    char last_key;
-    uint8_t is_pressed;
-    uint16_t press_duration;
-    uint8_t debounce_count;
-} keypad_state_t;
-
-keypad_state_t key_state = {'\0', '\0', 0, 0, 0};
-
-/*
- * Initialize keypad
- */
-void keypad_init(void)
-{
-    KEYPAD_DDR = ROW_MASK;
-    KEYPAD_PORT = 0xFF;
-}
-
-/*
- * Raw scan (no debouncing)
- */
-char keypad_scan_raw(void)
-{
-    for (uint8_t row = 0; row < 4; row++)
-    {
-        KEYPAD_PORT |= ROW_MASK;
-        KEYPAD_PORT &= ~(1 << row);
-        _delay_us(5);
-
-        uint8_t cols = KEYPAD_PIN & COL_MASK;
-
-        for (uint8_t col = 0; col < 4; col++)
-        {
-            if (!(cols & (1 << (col + 4))))
-            {
-                return keypad_map[row][col];
-            }
-        }
-    }
-    return '\0';
-}
+#include "../../shared_libs/_lcd.h" // HD44780 driver with shadow DDRAM (only changed cells are sent)
+#include "../../shared_libs/_keypad.h" // background scanner: per-key debouncing, event queue
+#include "../../shared_libs/_timer2.h" // system tick: Timer2_ovf_handler() scans the keypad
+#include "../../shared_libs/_cpu_load.h" // idle/active accounting, $LOAD telemetry line
+#include "../../shared_libs/_isr_priority.h" // Timer0 latency probe (-DISR_PRIORITY_PROBE)
 
 /*
- * Debounced key reading with state machine
+ * Send the $LOAD telemetry line (CpuLoad_format_report) once per second:
+ * load permille, loops, worst loop time and per-ISR time in microseconds.
+ * With the latency probe built in, a $LAT line follows: worst and average
+ * interrupt entry latency in microseconds while the keypad is scanned.
  */
-char keypad_get_debounced(void)
+static void report_cpu_load(void)
 {
-    char raw_key = keypad_scan_raw();
-
-    if (raw_key != '\0')
-    {
-        if (raw_key == key_state.current_key)
-        {
-            // Same key, increment debounce counter
-            if (key_state.debounce_count < 255)
-            {
-                key_state.debounce_count++;
-            }
+    static unsigned long next_report = 0;
+    unsigned long now = Timer2_get_milliseconds();
+    char line[96];
 
-            // Key is stable for debounce time
-            if (key_state.debounce_count >= 3 && !key_state.is_pressed)
-            {
-                key_state.is_pressed = 1;
-                key_state.press_duration = 0;
-                return key_state.current_key; // Valid key press
-            }
-        }
-        else
-        {
-            // Different key detected
-            key_state.current_key = raw_key;
-            key_state.debounce_count = 1;
-        }
-    }
-    else
+    if ((long)(now - next_report) < 0)
     {
-        // No key pressed
-        if (key_state.debounce_count > 0)
-        {
-            key_state.debounce_count--;
-        }
-
-        if (key_state.debounce_count == 0)
-        {
-            key_state.is_pressed = 0;
-            key_state.current_key = '\0';
-        }
+        return;
     }
+    next_report = now + 1000;
 
-    return '\0'; // No valid key press
-}
-
-/*
- * Wait for key with full debouncing
- */
-char keypad_getkey_debounced(void)
-{
-    char key;
-
-    // Wait for key press
-    do
-    {
-        key = keypad_get_debounced();
-        _delay_ms(10);
-    } while (key == '\0');
-
-    // Wait for key release
-    while (keypad_scan_raw() != '\0')
+    if (CpuLoad_format_report(line, sizeof(line)))
     {
-        _delay_ms(10);
+        puts_USART1(line);
     }
 
-    // Reset state
-    key_state.current_key = '\0';
-    key_state.is_pressed = 0;
-    key_state.debounce_count = 0;
-
-    return key;
+#ifdef ISR_PRIORITY_PROBE
+    sprintf(line, "$LAT,%u,%u\r\n",
+            ISR_PRIORITY_PROBE_COUNTS_TO_US(Isr_priority_probe_max_latency()),
+            ISR_PRIORITY_PROBE_COUNTS_TO_US(Isr_priority_probe_avg_latency()));
+    puts_USART1(line);
+#endif
 }
 
 /* ========================================================================
@@ -287,60 +93,60 @@ char keypad_getkey_debounced(void)
 void demo1_debouncing_test(void)
 {
     puts_USART1("\r\n=== DEMO 1: Debouncing Comparison ===\r\n");
-    puts_USART1("Testing raw vs debounced key reading\r\n");
+    puts_USART1("Raw contact changes vs debounced presses\r\n");
     puts_USART1("Press keys rapidly, then press 'D' to exit\r\n\r\n");
 
-    lcd_clear();
-    lcd_puts_at(0, 0, "Debounce Test:");
+    Lcd_clear();
+    Lcd_puts_at(0, 0, "Debounce Test:");
 
-    uint16_t raw_count = 0;
-    uint16_t debounced_count = 0;
-    char last_raw = '\0';
+    Keypad_flush();
+    Keypad_reset_stats();
+    CpuLoad_init(); // background scanning should cost only a few percent
+#ifdef ISR_PRIORITY_PROBE
+    Isr_priority_probe_start(); // the 100us probe interrupt shows up in the load too
+#endif
 
     while (1)
     {
-        // Raw scan
-        char raw = keypad_scan_raw();
-        if (raw != '\0' && raw != last_raw)
-        {
-            raw_count++;
-            last_raw = raw;
+        Keypad_event_t ev;
+        Keypad_stats_t stats;
+        char buf[40];
 
-            char buf[30];
-            sprintf(buf, "Raw: %c (#%u)\r\n", raw, raw_count);
-            puts_USART1(buf);
-        }
-        else if (raw == '\0')
+        CpuLoad_loop_mark();
+
+        if (!Keypad_get_event(&ev))
         {
-            last_raw = '\0';
+            report_cpu_load();
+            CpuLoad_idle(); // sleep until the next tick; the scanner ISR samples the keys meanwhile
+            continue;
         }
-
-        // Debounced scan
-        char debounced = keypad_get_debounced();
-        if (debounced != '\0')
+        if (ev.type != KEYPAD_PRESS)
         {
-            debounced_count++;
+            continue;
+        }
 
-            char buf[30];
-            sprintf(buf, "  Debounced: %c (#%u)\r\n", debounced, debounced_count);
-            puts_USART1(buf);
+        // Raw changes count every contact edge the scanner saw, bounces included
+        Keypad_get_stats(&stats);
+        sprintf(buf, "Debounced: %c (#%u, raw %u)\r\n", ev.key, stats.presses, stats.raw_changes);
+        puts_USART1(buf);
 
-            lcd_goto(1, 0);
-            sprintf(buf, "R:%u D:%u    ", raw_count, debounced_count);
-            lcd_puts(buf);
+        sprintf(buf, "R:%u D:%u", stats.raw_changes, stats.presses);
+        Lcd_clear_row(1);
+        Lcd_puts_at(1, 0, buf);
 
-            if (debounced == 'D')
-            {
-                _delay_ms(500);
-                char summary[80];
-                sprintf(summary, "\r\nResults: Raw=%u, Debounced=%u, Bounces=%u\r\n",
-                        raw_count, debounced_count, raw_count - debounced_count);
-                puts_USART1(summary);
-                return;
-            }
+        if (ev.key == 'D')
+        {
+            // a clean press and release is 2 raw changes ('D' is still held: 1)
+            unsigned int clean = 2 * stats.presses - 1;
+            sprintf(buf, "\r\nResults: Raw=%u, Debounced=%u, Bounces=%u\r\n",
+                    stats.raw_changes, stats.presses,
+                    (stats.raw_changes > clean) ? stats.raw_changes - clean : 0);
+            puts_USART1(buf);
+#ifdef ISR_PRIORITY_PROBE
+            Isr_priority_probe_stop();
+#endif
+            return;
         }
-
-        _delay_ms(10);
     }
 }
 
@@ -351,77 +157,84 @@ void demo2_long_press(void)
 {
     puts_USART1("\r\n=== DEMO 2: Long Press Detection ===\r\n");
     puts_USART1("Short press = normal, Long press = special\r\n");
+    puts_USART1("Hold a key for auto-repeat, hold several at once\r\n");
     puts_USART1("Press 'D' to exit\r\n\r\n");
 
-    lcd_clear();
-    lcd_puts_at(0, 0, "Long Press Test:");
+    Lcd_clear();
+    Lcd_puts_at(0, 0, "Long Press Test:");
+
+    Keypad_flush();
+    uint16_t long_keys = 0; // keys that reached the long press while held
 
     while (1)
     {
-        char key = keypad_scan_raw();
+        Keypad_event_t ev;
+        char buf[40];
+
+        if (!Keypad_get_event(&ev))
+        {
+            continue;
+        }
 
-        if (key != '\0' && key_state.current_key == '\0')
+        uint16_t bit = (uint16_t)1 << ev.index;
+        uint8_t held = 0;
+        for (uint16_t state = Keypad_state(); state; state &= state - 1)
         {
-            // New key press
-            key_state.current_key = key;
-            key_state.press_duration = 0;
-
-            lcd_goto(1, 0);
-            char buf[20];
-            sprintf(buf, "Press: %c...   ", key);
-            lcd_puts(buf);
+            held++;
         }
-        else if (key != '\0' && key == key_state.current_key)
+
+        switch (ev.type)
         {
-            // Key still pressed
-            key_state.press_duration++;
+        case KEYPAD_PRESS:
+            sprintf(buf, "Press: %c (%u held)", ev.key, held);
+            Lcd_clear_row(1);
+            Lcd_puts_at(1, 0, buf);
+            break;
 
-            if (key_state.press_duration == 100)
-            { // ~1 second
-                lcd_goto(1, 0);
-                char buf[20];
-                sprintf(buf, "LONG: %c!!!   ", key);
-                lcd_puts(buf);
+        case KEYPAD_REPEAT:
+            sprintf(buf, "Repeat: %c\r\n", ev.key);
+            puts_USART1(buf);
+            break;
 
-                sprintf(buf, "Long press detected: %c\r\n", key);
-                puts_USART1(buf);
+        case KEYPAD_LONG:
+            long_keys |= bit;
+            sprintf(buf, "LONG: %c!!!", ev.key);
+            Lcd_clear_row(1);
+            Lcd_puts_at(1, 0, buf);
 
-                PORTC = 0xFF;
-            }
-        }
-        else if (key == '\0' && key_state.current_key != '\0')
-        {
-            // Key released
-            char pressed_key = key_state.current_key;
-            uint16_t duration = key_state.press_duration;
+            sprintf(buf, "Long press detected: %c\r\n", ev.key);
+            puts_USART1(buf);
 
-            char buf[40];
-            if (duration < 100)
+            PORTC = 0xFF;
+            break;
+
+        case KEYPAD_RELEASE:
+            if (long_keys & bit)
             {
-                sprintf(buf, "Short press: %c (%ums)\r\n", pressed_key, duration * 10);
-                lcd_goto(1, 0);
-                sprintf(buf, "Short: %c      ", pressed_key);
-                lcd_puts(buf);
+                sprintf(buf, "Long press: %c\r\n", ev.key);
             }
             else
             {
-                sprintf(buf, "Long press: %c (%ums)\r\n", pressed_key, duration * 10);
+                sprintf(buf, "Short press: %c\r\n", ev.key);
+                Lcd_clear_row(1);
+                Lcd_puts_at(1, 0, "Short: ");
+                Lcd_putc(ev.key);
             }
             puts_USART1(buf);
+            long_keys &= ~bit;
 
-            if (pressed_key == 'D')
+            if (ev.key == 'D')
             {
-                _delay_ms(500);
                 puts_USART1("\r\nExiting demo...\r\n");
-                key_state.current_key = '\0';
+                PORTC = 0x00;
                 return;
             }
-
-            key_state.current_key = '\0';
-            PORTC = 0x00;
+            if (!long_keys)
+            {
+                PORTC = 0x00;
+            }
+            break;
         }
-
-        _delay_ms(10);
     }
 }
 
@@ -440,27 +253,31 @@ void demo3_pin_entry(void)
     uint8_t attempts = 0;
     const uint8_t max_attempts = 3;
 
-    lcd_clear();
-    lcd_puts_at(0, 0, "Enter PIN:");
+    Lcd_clear();
+    Lcd_puts_at(0, 0, "Enter PIN:");
 
     while (attempts < max_attempts)
     {
-        lcd_goto(1, 0);
-        lcd_puts("PIN: ");
+        Lcd_goto(1, 0);
+        Lcd_puts("PIN: ");
 
         // Display entered digits as asterisks
         for (uint8_t i = 0; i < pin_index; i++)
         {
-            lcd_data('*');
+            Lcd_putc('*');
         }
         for (uint8_t i = pin_index; i < 4; i++)
         {
-            lcd_data('_');
+            Lcd_putc('_');
         }
-        lcd_puts("   ");
+        Lcd_puts("   ");
 
-        // Get key
-        char key = keypad_getkey_debounced();
+        // Get key (the screen above is redrawn every pass; unchanged cells are not sent)
+        char key = Keypad_getkey();
+        if (key == '\0')
+        {
+            continue;
+        }
 
         char buf[30];
         sprintf(buf, "Key: %c\r\n", key);
@@ -502,9 +319,9 @@ void demo3_pin_entry(void)
 
             if (correct)
             {
-                lcd_clear();
-                lcd_puts_at(0, 0, "ACCESS GRANTED!");
-                lcd_puts_at(1, 0, "  Welcome!");
+                Lcd_clear();
+                Lcd_puts_at(0, 0, "ACCESS GRANTED!");
+                Lcd_puts_at(1, 0, "  Welcome!");
 
                 puts_USART1("\r\n*** ACCESS GRANTED ***\r\n");
 
@@ -524,12 +341,12 @@ void demo3_pin_entry(void)
             {
                 attempts++;
 
-                lcd_clear();
-                lcd_puts_at(0, 0, "ACCESS DENIED!");
+                Lcd_clear();
+                Lcd_puts_at(0, 0, "ACCESS DENIED!");
 
                 char msg[20];
                 sprintf(msg, "Attempts: %u/%u", attempts, max_attempts);
-                lcd_puts_at(1, 0, msg);
+                Lcd_puts_at(1, 0, msg);
 
                 sprintf(buf, "Wrong PIN! Attempts: %u/%u\r\n", attempts, max_attempts);
                 puts_USART1(buf);
@@ -537,25 +354,24 @@ void demo3_pin_entry(void)
                 PORTC = 0xFF;
                 _delay_ms(1500);
                 PORTC = 0x00;
+                Keypad_flush(); // ignore keys pressed during the message
 
                 if (attempts < max_attempts)
                 {
-                    lcd_clear();
-                    lcd_puts_at(0, 0, "Enter PIN:");
+                    Lcd_clear();
+                    Lcd_puts_at(0, 0, "Enter PIN:");
                     pin_index = 0;
                     for (uint8_t i = 0; i < 5; i++)
                         entered_pin[i] = 0;
                 }
             }
         }
-
-        _delay_ms(100);
     }
 
     // Locked out
-    lcd_clear();
-    lcd_puts_at(0, 0, " SYSTEM LOCKED");
-    lcd_puts_at(1, 0, "  Try Again!");
+    Lcd_clear();
+    Lcd_puts_at(0, 0, " SYSTEM LOCKED");
+    Lcd_puts_at(1, 0, "  Try Again!");
 
     puts_USART1("\r\n*** SYSTEM LOCKED - Too many attempts ***\r\n");
 
@@ -582,20 +398,24 @@ void demo4_input_validation(void)
     char phone[11] = {0};
     uint8_t index = 0;
 
-    lcd_clear();
-    lcd_puts_at(0, 0, "Phone Number:");
+    Lcd_clear();
+    Lcd_puts_at(0, 0, "Phone Number:");
 
     while (1)
     {
-        lcd_goto(1, 0);
-        lcd_puts(phone);
+        Lcd_goto(1, 0);
+        Lcd_puts(phone);
         for (uint8_t i = index; i < 10; i++)
         {
-            lcd_data('_');
+            Lcd_putc('_');
         }
-        lcd_puts(" ");
+        Lcd_puts(" ");
 
-        char key = keypad_getkey_debounced();
+        char key = Keypad_getkey(); // holding '*' repeats the backspace
+        if (key == '\0')
+        {
+            continue;
+        }
 
         if (key == 'D')
         {
@@ -627,9 +447,9 @@ void demo4_input_validation(void)
             if (index == 10)
             {
                 // Valid submission
-                lcd_clear();
-                lcd_puts_at(0, 0, "Number Saved:");
-                lcd_puts_at(1, 0, phone);
+                Lcd_clear();
+                Lcd_puts_at(0, 0, "Number Saved:");
+                Lcd_puts_at(1, 0, phone);
 
                 char buf[50];
                 sprintf(buf, "\r\nPhone number saved: %s\r\n", phone);
@@ -644,15 +464,15 @@ void demo4_input_validation(void)
                 for (uint8_t i = 0; i < 11; i++)
                     phone[i] = 0;
 
-                lcd_clear();
-                lcd_puts_at(0, 0, "Phone Number:");
+                Lcd_clear();
+                Lcd_puts_at(0, 0, "Phone Number:");
             }
             else
             {
                 // Invalid length
-                lcd_clear();
-                lcd_puts_at(0, 0, "Error: Need 10");
-                lcd_puts_at(1, 0, "digits!");
+                Lcd_clear();
+                Lcd_puts_at(0, 0, "Error: Need 10");
+                Lcd_puts_at(1, 0, "digits!");
 
                 puts_USART1("ERROR: Phone must be 10 digits\r\n");
 
@@ -660,25 +480,26 @@ void demo4_input_validation(void)
                 _delay_ms(1500);
                 PORTC = 0x00;
 
-                lcd_clear();
-                lcd_puts_at(0, 0, "Phone Number:");
+                Lcd_clear();
+                Lcd_puts_at(0, 0, "Phone Number:");
             }
         }
         else
         {
             // Invalid key
-            lcd_clear();
-            lcd_puts_at(0, 0, "Invalid key!");
-            lcd_puts_at(1, 0, "Digits only");
+            Lcd_clear();
+            Lcd_puts_at(0, 0, "Invalid key!");
+            Lcd_puts_at(1, 0, "Digits only");
 
             char buf[40];
             sprintf(buf, "Invalid key: %c (use digits only)\r\n", key);
             puts_USART1(buf);
 
             _delay_ms(1000);
+            Keypad_flush();
 
-            lcd_clear();
-            lcd_puts_at(0, 0, "Phone Number:");
+            Lcd_clear();
+            Lcd_puts_at(0, 0, "Phone Number:");
         }
     }
 }
@@ -702,26 +523,38 @@ void display_main_menu(void)
     puts_USART1("Enter selection (1-4): ");
 }
 
+// System tick: with -DKEYPAD_ENABLED the handler scans one keypad row
+ISR(TIMER2_OVF_vect)
+{
+    unsigned long t = CpuLoad_isr_enter();
+    Timer2_ovf_handler();
+    CpuLoad_isr_exit(CPU_LOAD_ISR_TIMER2, t);
+}
+
 int main(void)
 {
     // Initialize peripherals
     Uart1_init();
-    lcd_init();
-    keypad_init();
+    Lcd_init();
+    Keypad_init();
+    Timer2_init();
+    UCSR1B &= ~(1 << RXCIE1); // UART is polled: the Timer2 tick is the only interrupt
 
     // Configure status LEDs
     DDRC = 0xFF;
     PORTC = 0x00;
 
+    sei(); // the Timer2 tick scans the keypad in the background
+
     // Send startup message
     _delay_ms(500);
     puts_USART1("\r\n\r\n*** Keypad Advanced Features ***\r\n");
     puts_USART1("Debouncing & Validation\r\n");
 
     // Welcome screen
-    lcd_clear();
-    lcd_puts_at(0, 0, "Keypad Advanced");
-    lcd_puts_at(1, 0, "  Ready!");
+    Lcd_clear();
+    Lcd_puts_at(0, 0, "Keypad Advanced");
+    Lcd_puts_at(1, 0, "  Ready!");
 
     PORTC = 0x01;
     _delay_ms(2000);
@@ -750,8 +583,8 @@ int main(void)
             break;
         default:
             puts_USART1("Invalid selection!\r\n");
-            lcd_clear();
-            lcd_puts_at(0, 0, "Invalid!");
+            Lcd_clear();
+            Lcd_puts_at(0, 0, "Invalid!");
             _delay_ms(1000);
             break;
         }
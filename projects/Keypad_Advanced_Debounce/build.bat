@@ -1,6 +1,6 @@
 @echo off
 echo Building Keypad Advanced Debounce Project...
-"C:\Program Files (x86)\Atmel\Studio\7.0\toolchain\avr8\avr8-gnu-toolchain\bin\avr-gcc.exe" -mmcu=atmega128 -DF_CPU=7372800UL -DBAUD=9600 -Os -Wall -Wextra -I. -I../../shared_libs Main.c ../../shared_libs/_uart.c -o Main.elf
+"C:\Program Files (x86)\Atmel\Studio\7.0\toolchain\avr8\avr8-gnu-toolchain\bin\avr-gcc.exe" -mmcu=atmega128 -DF_CPU=7372800UL -DBAUD=9600 -DKEYPAD_ENABLED -DISR_PRIORITY_PROBE -Os -Wall -Wextra -I. -I../../shared_libs Main.c ../../shared_libs/_uart.c ../../shared_libs/_lcd.c ../../shared_libs/_keypad.c ../../shared_libs/_timer2.c ../../shared_libs/_cpu_load.c ../../shared_libs/_isr_priority.c -o Main.elf
 if %errorlevel% equ 0 (
     echo Build successful! Generating HEX file...
     "C:\Program Files (x86)\Atmel\Studio\7.0\toolchain\avr8\avr8-gnu-toolchain\bin\avr-objcopy.exe" -O ihex -R .eeprom Main.elf Main.hex
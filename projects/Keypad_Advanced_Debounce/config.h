@@ -5,6 +5,7 @@
 #define BAUD 9600
 
 #include <avr/io.h>
+#include <avr/interrupt.h>
 #include <util/delay.h>
 #include <stdio.h>
 #include <stdint.h>
@@ -28,355 +28,220 @@
  * - LEDs for operation status
  * - Serial connection for debugging (9600 baud)
  *
- * CALCULATOR KEYPAD LAYOUT:
- *   [1] [2] [3] [+]  (A = Add)
- *   [4] [5] [6] [-]  (B = Subtract)
- *   [7] [8] [9] [×]  (C = Multiply)
- *   [C] [0] [=] [÷]  (* = Clear, # = Equals, D = Divide)
+ * CALCULATOR KEYPAD LAYOUT (tap / hold):
+ *   [1] [2] [3] [+ / (]  (A)
+ *   [4] [5] [6] [- / )]  (B)
+ *   [7] [8] [9] [* / .]  (C)
+ *   [C] [0] [=] [/ / <]  (* = Clear / hold: INT <-> Q16.16, D hold = backspace)
  *
  * FEATURES:
- * - Basic arithmetic operations (+, -, ×, ÷)
- * - Multi-digit number entry with validation
- * - Error handling (division by zero, overflow)
- * - Clear and reset functions
+ * - Whole expressions with precedence and parentheses (shared_libs/_calc.c)
+ * - 32-bit integer or Q16.16 fixed-point mode
+ * - Error handling (syntax, parentheses, division by zero, overflow)
+ * - Display formatting without sprintf()
  *
  * LEARNING PROGRESSION:
  * - Demo 1: Basic Calculator Functions
  * - Demo 2: Advanced Operations
  * - Demo 3: Error Handling
  * - Demo 4: User Interface Enhancement
+ * - Demo 5: Calculator engine cycle benchmark
  *
  * =============================================================================
  */
 
 #include "config.h"
 
-// LCD Control Pins
-#define LCD_DDR DDRG
-#define LCD_PORT PORTG
-#define LCD_RS 0
-#define LCD_E 1
-#define LCD_D4 2
-
-// LCD Commands
-#define LCD_CLEAR 0x01
-#define LCD_ENTRY_MODE 0x06
-#define LCD_DISPLAY_ON 0x0C
-#define LCD_FUNCTION_SET 0x28
-#define LCD_DDRAM_ADDR 0x80
-
-// Basic LCD functions
-void lcd_enable_pulse(void)
-{
-    LCD_PORT |= (1 << LCD_E);
-    _delay_us(1);
-    LCD_PORT &= ~(1 << LCD_E);
-    _delay_us(50);
-}
-
-void lcd_write_nibble(uint8_t nibble)
-{
-    LCD_PORT = (LCD_PORT & 0xC3) | ((nibble & 0x0F) << LCD_D4);
-    lcd_enable_pulse();
-}
-
-void lcd_write_byte(uint8_t data, uint8_t rs)
-{
-    if (rs)
-        LCD_PORT |= (1 << LCD_RS);
-    else
-        LCD_PORT &= ~(1 << LCD_RS);
-    lcd_write_nibble(data >> 4);
-    lcd_write_nibble(data & 0x0F);
-    _delay_us(50);
-}
-
-void lcd_command(uint8_t cmd)
-{
-    lcd_write_byte(cmd, 0);
-    if (cmd == LCD_CLEAR)
-        _delay_ms(2);
-}
-
-void lcd_data(uint8_t data)
-{
-    lcd_write_byte(data, 1);
-}
+#include "../../shared_libs/_lcd.h" // HD44780 driver with shadow DDRAM (only changed cells are sent)
+#include "../../shared_libs/_keypad.h" // background scanner: per-key debouncing, event queue
+#include "../../shared_libs/_timer2.h" // system tick: Timer2_ovf_handler() scans the keypad
+#include "../../shared_libs/_calc.h"   // expression engine: precedence, int32 / Q16.16
 
-void lcd_init(void)
-{
-    LCD_DDR |= (1 << LCD_RS) | (1 << LCD_E) | (1 << LCD_D4) | (1 << 3) | (1 << 4) | (1 << 5);
-    _delay_ms(50);
-    LCD_PORT &= ~(1 << LCD_RS);
-    lcd_write_nibble(0x03);
-    _delay_ms(5);
-    lcd_write_nibble(0x03);
-    _delay_us(150);
-    lcd_write_nibble(0x03);
-    _delay_us(150);
-    lcd_write_nibble(0x02);
-    _delay_us(150);
-    lcd_command(LCD_FUNCTION_SET);
-    lcd_command(LCD_DISPLAY_ON);
-    lcd_command(LCD_CLEAR);
-    lcd_command(LCD_ENTRY_MODE);
-}
-
-void lcd_clear(void)
-{
-    lcd_command(LCD_CLEAR);
-}
-
-void lcd_goto(uint8_t row, uint8_t col)
-{
-    uint8_t address = (row == 0) ? 0x00 + col : 0x40 + col;
-    lcd_command(LCD_DDRAM_ADDR | address);
-}
-
-void lcd_puts(const char *str)
-{
-    while (*str)
-        lcd_data(*str++);
-}
-
-void lcd_puts_at(uint8_t row, uint8_t col, const char *str)
-{
-    lcd_goto(row, col);
-    lcd_puts(str);
-}
-
-// Keypad definitions
-#define KEYPAD_DDR DDRA
-#define KEYPAD_PORT PORTA
-#define KEYPAD_PIN PINA
-#define ROW_MASK 0x0F
-#define COL_MASK 0xF0
-
-const char keypad_map[4][4] = {
-    {'1', '2', '3', 'A'},
-    {'4', '5', '6', 'B'},
-    {'7', '8', '9', 'C'},
-    {'*', '0', '#', 'D'}};
-
-void keypad_init(void)
+/*
+ * Next key press from the scanner queue, '\0' if nothing was pressed.
+ * Never waits; auto-repeat is ignored so a held key enters one digit.
+ */
+char keypad_getkey(void)
 {
-    KEYPAD_DDR = ROW_MASK;
-    KEYPAD_PORT = 0xFF;
-}
+    Keypad_event_t ev;
 
-char keypad_scan(void)
-{
-    for (uint8_t row = 0; row < 4; row++)
+    while (Keypad_get_event(&ev))
     {
-        KEYPAD_PORT |= ROW_MASK;
-        KEYPAD_PORT &= ~(1 << row);
-        _delay_us(5);
-
-        uint8_t cols = KEYPAD_PIN & COL_MASK;
-
-        for (uint8_t col = 0; col < 4; col++)
+        if (ev.type == KEYPAD_PRESS)
         {
-            if (!(cols & (1 << (col + 4))))
-            {
-                return keypad_map[row][col];
-            }
+            return ev.key;
         }
     }
     return '\0';
 }
 
-char keypad_getkey(void)
-{
-    char key;
-    do
-    {
-        key = keypad_scan();
-    } while (key == '\0');
+/* ========================================================================
+ * DEMO 1: Expression Calculator
+ * ======================================================================== */
+#define CALC_EXPR_MAX 32
+
+// tap and hold meaning of A, B, C, D ('\b' = backspace)
+static const char calc_tap_keys[4] = {'+', '-', '*', '/'};
+static const char calc_hold_keys[4] = {'(', ')', '.', '\b'};
 
-    _delay_ms(20);
-    while (keypad_scan() != '\0')
+// Row 0: the end of the expression. Appending at the end only writes one
+// character; scrolling and backspace rewrite the row (the LCD shadow
+// still sends only the cells that changed).
+static void calc_show_expression(const char *expr, uint8_t len, uint8_t appended)
+{
+    if (appended && len <= LCD_COLS)
     {
-        _delay_ms(10);
+        Lcd_goto(0, len - 1);
+        Lcd_putc(expr[len - 1]);
+        return;
     }
-    _delay_ms(20);
+    Lcd_clear_row(0);
+    Lcd_puts_at(0, 0, (len > LCD_COLS) ? expr + len - LCD_COLS : expr);
+}
+
+// Row 1: mode on the left, result (RAM) or message (PROGMEM) on the right
+static void calc_show_result(uint8_t mode, const char *text, uint8_t in_progmem)
+{
+    uint8_t len = in_progmem ? strlen_P(text) : strlen(text);
 
-    return key;
+    Lcd_clear_row(1);
+    Lcd_puts_at(1, 0, (mode == CALC_MODE_FIXED) ? "Q16" : "INT");
+    Lcd_goto(1, LCD_COLS - len);
+    if (in_progmem)
+        Lcd_puts_P(text);
+    else
+        Lcd_puts(text);
 }
 
-/* ========================================================================
- * DEMO 1: Basic Calculator
- * ======================================================================== */
 void demo1_calculator(void)
 {
-    puts_USART1("\r\n=== DEMO 1: Basic Calculator ===\r\n");
-    puts_USART1("A=+, B=-, C=*, D=/, #==, *=Clear\r\n\r\n");
-
-    int32_t operand1 = 0;
-    int32_t operand2 = 0;
-    int32_t result = 0;
-    char operation = '\0';
-    uint8_t entering_second = 0;
+    puts_USART1("\r\n=== DEMO 1: Expression Calculator ===\r\n");
+    puts_USART1("Tap A=+ B=- C=* D=/  Hold A=( B=) C=. D=backspace\r\n");
+    puts_USART1("#=equals  *=clear  Hold *=INT/Q16.16 mode\r\n\r\n");
+
+    char expr[CALC_EXPR_MAX + 1];
+    char text[CALC_FORMAT_SIZE];
+    uint8_t len = 0;
+    uint8_t mode = CALC_MODE_INT;
     uint8_t show_result = 0;
+    uint8_t held = 0; // the held key already did its hold action
+    int32_t answer = 0;
+    Keypad_event_t ev;
 
-    lcd_clear();
-    lcd_puts_at(0, 0, "Calculator");
-    lcd_puts_at(1, 0, "0");
+    expr[0] = '\0';
+    Lcd_clear();
+    calc_show_result(mode, "0", 0);
+    Keypad_flush();
 
     while (1)
     {
-        char key = keypad_getkey();
+        if (!Keypad_get_event(&ev))
+        {
+            continue;
+        }
 
-        char buf[40];
-        sprintf(buf, "Key: %c\r\n", key);
-        puts_USART1(buf);
+        char c = '\0';
+        char key = ev.key;
 
-        if (key >= '0' && key <= '9')
+        if ((key >= 'A' && key <= 'D') || key == '*')
         {
-            // Digit entered
-            if (show_result)
+            // keys with a hold action act on release, or on KEYPAD_LONG
+            if (ev.type == KEYPAD_PRESS)
             {
-                // Start new calculation
-                operand1 = 0;
-                operand2 = 0;
-                operation = '\0';
-                entering_second = 0;
-                show_result = 0;
+                held = 0;
+                continue;
             }
-
-            if (!entering_second)
+            if (ev.type == KEYPAD_LONG)
+            {
+                held = 1;
+                c = (key == '*') ? 'M' : calc_hold_keys[key - 'A'];
+            }
+            else if (ev.type == KEYPAD_RELEASE && !held)
             {
-                operand1 = operand1 * 10 + (key - '0');
-                if (operand1 > 9999)
-                    operand1 = 9999; // Limit
+                c = (key == '*') ? 'X' : calc_tap_keys[key - 'A'];
+            }
+        }
+        else if (ev.type == KEYPAD_PRESS)
+        {
+            c = key; // digits and '#'
+        }
+        if (c == '\0')
+        {
+            continue;
+        }
+
+        putch_USART1(c == '\b' ? '<' : c);
 
-                lcd_goto(1, 0);
-                sprintf(buf, "%ld       ", operand1);
-                lcd_puts(buf);
+        if (c == 'X' || c == 'M')
+        {
+            // Clear, or clear and switch INT <-> Q16.16
+            if (c == 'M')
+            {
+                mode = (mode == CALC_MODE_INT) ? CALC_MODE_FIXED : CALC_MODE_INT;
+                puts_USART1((mode == CALC_MODE_FIXED) ? " [Q16.16]\r\n" : " [INT]\r\n");
             }
             else
             {
-                operand2 = operand2 * 10 + (key - '0');
-                if (operand2 > 9999)
-                    operand2 = 9999;
-
-                lcd_goto(1, 0);
-                sprintf(buf, "%ld%c%ld    ", operand1, operation, operand2);
-                lcd_puts(buf);
+                puts_USART1(" Cleared\r\n");
             }
+            len = 0;
+            expr[0] = '\0';
+            answer = 0;
+            show_result = 0;
+            Lcd_clear_row(0);
+            calc_show_result(mode, "0", 0);
+            PORTC = 0x00;
+        }
+        else if (c == '#')
+        {
+            uint8_t err = Calc_eval(expr, mode, &answer);
 
-            PORTC = (PORTC << 1) | 0x01;
-            if (PORTC > 0x0F)
-                PORTC = 0x01;
+            puts_USART1(" = ");
+            if (err == CALC_OK)
+            {
+                Calc_format(answer, mode, text);
+                calc_show_result(mode, text, 0);
+                puts_USART1(text);
+                show_result = 1;
+                PORTC = 0x0F;
+            }
+            else
+            {
+                char message[16];
+                strcpy_P(message, Calc_error_P(err));
+                calc_show_result(mode, Calc_error_P(err), 1);
+                puts_USART1(message);
+                PORTC = 0xFF;
+            }
+            puts_USART1("\r\n");
         }
-        else if (key == 'A' || key == 'B' || key == 'C' || key == 'D')
+        else if (c == '\b')
         {
-            // Operation
-            if (show_result)
+            if (len)
             {
-                operand1 = result;
-                show_result = 0;
+                expr[--len] = '\0';
+                calc_show_expression(expr, len, 0);
             }
-
-            // Map to operation symbols
-            if (key == 'A')
-                operation = '+';
-            else if (key == 'B')
-                operation = '-';
-            else if (key == 'C')
-                operation = '*';
-            else if (key == 'D')
-                operation = '/';
-
-            entering_second = 1;
-            operand2 = 0;
-
-            lcd_goto(1, 0);
-            sprintf(buf, "%ld%c       ", operand1, operation);
-            lcd_puts(buf);
-
-            PORTC = 0x03;
         }
-        else if (key == '#')
+        else if (len < CALC_EXPR_MAX)
         {
-            // Equals
-            if (operation != '\0' && entering_second)
+            if (show_result)
             {
-                // Calculate result
-                switch (operation)
+                // an operator continues with the last answer, anything else starts over
+                show_result = 0;
+                len = 0;
+                if (c == '+' || c == '-' || c == '*' || c == '/')
                 {
-                case '+':
-                    result = operand1 + operand2;
-                    break;
-                case '-':
-                    result = operand1 - operand2;
-                    break;
-                case '*':
-                    result = operand1 * operand2;
-                    break;
-                case '/':
-                    if (operand2 == 0)
-                    {
-                        lcd_clear();
-                        lcd_puts_at(0, 0, "Error:");
-                        lcd_puts_at(1, 0, "Divide by zero!");
-
-                        puts_USART1("ERROR: Division by zero!\r\n");
-
-                        PORTC = 0xFF;
-                        _delay_ms(2000);
-
-                        lcd_clear();
-                        lcd_puts_at(0, 0, "Calculator");
-                        operand1 = 0;
-                        operand2 = 0;
-                        operation = '\0';
-                        entering_second = 0;
-                        result = 0;
-                        lcd_puts_at(1, 0, "0");
-                        continue;
-                    }
-                    result = operand1 / operand2;
-                    break;
+                    len = Calc_format(answer, mode, expr);
                 }
-
-                // Display result
-                lcd_goto(0, 0);
-                sprintf(buf, "%ld%c%ld=      ", operand1, operation, operand2);
-                lcd_puts(buf);
-
-                lcd_goto(1, 0);
-                sprintf(buf, "%ld       ", result);
-                lcd_puts(buf);
-
-                sprintf(buf, "Calculation: %ld %c %ld = %ld\r\n",
-                        operand1, operation, operand2, result);
-                puts_USART1(buf);
-
-                show_result = 1;
-                PORTC = 0xFF;
-                _delay_ms(500);
-                PORTC = 0x00;
+                expr[len] = '\0';
+                calc_show_expression(expr, len, 0);
             }
+            expr[len++] = c;
+            expr[len] = '\0';
+            calc_show_expression(expr, len, 1);
+            PORTC = (PORTC << 1) | 0x01;
         }
-        else if (key == '*')
-        {
-            // Clear
-            operand1 = 0;
-            operand2 = 0;
-            operation = '\0';
-            entering_second = 0;
-            show_result = 0;
-            result = 0;
-
-            lcd_clear();
-            lcd_puts_at(0, 0, "Calculator");
-            lcd_puts_at(1, 0, "0");
-
-            puts_USART1("Cleared\r\n");
-            PORTC = 0x00;
-        }
-
-        _delay_ms(100);
     }
 }
 
@@ -396,25 +261,35 @@ void demo2_menu_system(void)
         "5.Exit"};
     uint8_t menu_size = 5;
     uint8_t current_page = 0;
+    uint8_t redraw = 1;
 
     while (1)
     {
-        // Display two menu items at a time
-        lcd_clear();
-        lcd_goto(0, 0);
-        if (current_page < menu_size)
-        {
-            lcd_puts(menu_items[current_page]);
-        }
-        lcd_goto(1, 0);
-        if (current_page + 1 < menu_size)
+        // Display two menu items at a time (only after a key changed something)
+        if (redraw)
         {
-            lcd_puts(menu_items[current_page + 1]);
-        }
+            Lcd_clear();
+            Lcd_goto(0, 0);
+            if (current_page < menu_size)
+            {
+                Lcd_puts(menu_items[current_page]);
+            }
+            Lcd_goto(1, 0);
+            if (current_page + 1 < menu_size)
+            {
+                Lcd_puts(menu_items[current_page + 1]);
+            }
 
-        PORTC = 1 << (current_page % 8);
+            PORTC = 1 << (current_page % 8);
+            redraw = 0;
+        }
 
         char key = keypad_getkey();
+        if (key == '\0')
+        {
+            continue;
+        }
+        redraw = 1;
 
         if (key == '2' || key == '8')
         {
@@ -441,9 +316,9 @@ void demo2_menu_system(void)
             // Select item
             uint8_t selection = key - '1';
 
-            lcd_clear();
-            lcd_puts_at(0, 0, "Selected:");
-            lcd_puts_at(1, 0, menu_items[selection] + 2); // Skip number
+            Lcd_clear();
+            Lcd_puts_at(0, 0, "Selected:");
+            Lcd_puts_at(1, 0, menu_items[selection] + 2); // Skip number
 
             char buf[50];
             sprintf(buf, "Menu selection: %s\r\n", menu_items[selection]);
@@ -475,8 +350,8 @@ void demo3_guessing_game(void)
     // Simple pseudo-random number (based on timer, not secure)
     uint8_t secret = 42; // For demo, use fixed number
 
-    lcd_clear();
-    lcd_puts_at(0, 0, "Guess 0-99:");
+    Lcd_clear();
+    Lcd_puts_at(0, 0, "Guess 0-99:");
 
     puts_USART1("Secret number set! Start guessing...\r\n");
 
@@ -487,20 +362,24 @@ void demo3_guessing_game(void)
         char guess_str[3] = {0};
         uint8_t digit_count = 0;
 
-        lcd_goto(1, 0);
-        lcd_puts("__        ");
+        Lcd_goto(1, 0);
+        Lcd_puts("__        ");
 
         while (1)
         {
             char key = keypad_getkey();
+            if (key == '\0')
+            {
+                continue;
+            }
 
             if (key >= '0' && key <= '9' && digit_count < 2)
             {
                 guess_str[digit_count++] = key;
 
-                lcd_goto(1, 0);
-                lcd_puts(guess_str);
-                lcd_puts("        ");
+                Lcd_goto(1, 0);
+                Lcd_puts(guess_str);
+                Lcd_puts("        ");
             }
             else if (key == '*')
             {
@@ -509,8 +388,8 @@ void demo3_guessing_game(void)
                 guess_str[0] = 0;
                 guess_str[1] = 0;
 
-                lcd_goto(1, 0);
-                lcd_puts("__        ");
+                Lcd_goto(1, 0);
+                Lcd_puts("__        ");
             }
             else if (key == '#' && digit_count > 0)
             {
@@ -534,10 +413,10 @@ void demo3_guessing_game(void)
                 if (guess == secret)
                 {
                     // Correct!
-                    lcd_clear();
-                    lcd_puts_at(0, 0, "Correct!");
+                    Lcd_clear();
+                    Lcd_puts_at(0, 0, "Correct!");
                     sprintf(buf, "In %u tries", attempts);
-                    lcd_puts_at(1, 0, buf);
+                    Lcd_puts_at(1, 0, buf);
 
                     sprintf(buf, "*** CORRECT! The number was %u ***\r\n", secret);
                     puts_USART1(buf);
@@ -558,10 +437,10 @@ void demo3_guessing_game(void)
                 }
                 else if (guess < secret)
                 {
-                    lcd_clear();
-                    lcd_puts_at(0, 0, "Too Low!");
+                    Lcd_clear();
+                    Lcd_puts_at(0, 0, "Too Low!");
                     sprintf(buf, "Try:%u", attempts);
-                    lcd_puts_at(1, 0, buf);
+                    Lcd_puts_at(1, 0, buf);
 
                     puts_USART1("  -> Too low! Guess higher.\r\n");
 
@@ -569,10 +448,10 @@ void demo3_guessing_game(void)
                 }
                 else
                 {
-                    lcd_clear();
-                    lcd_puts_at(0, 0, "Too High!");
+                    Lcd_clear();
+                    Lcd_puts_at(0, 0, "Too High!");
                     sprintf(buf, "Try:%u", attempts);
-                    lcd_puts_at(1, 0, buf);
+                    Lcd_puts_at(1, 0, buf);
 
                     puts_USART1("  -> Too high! Guess lower.\r\n");
 
@@ -581,8 +460,8 @@ void demo3_guessing_game(void)
 
                 _delay_ms(1500);
 
-                lcd_clear();
-                lcd_puts_at(0, 0, "Guess 0-99:");
+                Lcd_clear();
+                Lcd_puts_at(0, 0, "Guess 0-99:");
                 break;
             }
         }
@@ -600,20 +479,17 @@ void demo4_stopwatch(void)
     uint16_t milliseconds = 0;
     uint8_t running = 0;
 
-    lcd_clear();
-    lcd_puts_at(0, 0, "Stopwatch:");
-    lcd_puts_at(1, 0, "00:00.0");
+    Lcd_clear();
+    Lcd_puts_at(0, 0, "Stopwatch:");
+    Lcd_puts_at(1, 0, "00:00.0");
 
     while (1)
     {
         // Check for key press (non-blocking)
-        char key = keypad_scan();
-        static char last_key = '\0';
+        char key = keypad_getkey();
 
-        if (key != '\0' && key != last_key)
+        if (key != '\0')
         {
-            last_key = key;
-
             if (key == '1')
             {
                 // Start/Stop
@@ -631,7 +507,7 @@ void demo4_stopwatch(void)
                 milliseconds = 0;
                 running = 0;
 
-                lcd_puts_at(1, 0, "00:00.0");
+                Lcd_puts_at(1, 0, "00:00.0");
                 puts_USART1("Reset\r\n");
 
                 PORTC = 0x00;
@@ -642,10 +518,6 @@ void demo4_stopwatch(void)
                 return;
             }
         }
-        else if (key == '\0')
-        {
-            last_key = '\0';
-        }
 
         if (running)
         {
@@ -658,7 +530,7 @@ void demo4_stopwatch(void)
 
             char buf[20];
             sprintf(buf, "%02u:%02u.%u", minutes, seconds, tenths);
-            lcd_puts_at(1, 0, buf);
+            Lcd_puts_at(1, 0, buf);
 
             // Blink LED
             if (milliseconds % 50 == 0)
@@ -671,6 +543,106 @@ void demo4_stopwatch(void)
     }
 }
 
+/* ========================================================================
+ * DEMO 5: Engine Cycle Benchmark
+ * Correctness is checked on the PC: shared_libs/host/calc_test.c
+ * (test_host.sh). This demo only measures the engine on the target.
+ * ======================================================================== */
+typedef struct
+{
+    const char *expr;
+    uint8_t mode;
+} calc_bench_t;
+
+static const calc_bench_t calc_bench[] = {
+    {"1+2*3", CALC_MODE_INT},
+    {"(12+3)*-4/5", CALC_MODE_INT},
+    {"2147483647+1", CALC_MODE_INT},
+    {"1/(3-3)", CALC_MODE_INT},
+    {"((1+2)*(3+4)-5)*(6-(7+8)/9)", CALC_MODE_INT},
+    {"2.5*(1.5-0.25)", CALC_MODE_FIXED},
+    {"1/3", CALC_MODE_FIXED},
+    {"-10/4", CALC_MODE_FIXED},
+    {"200*200", CALC_MODE_FIXED},
+};
+
+#define CALC_BENCH_COUNT (sizeof(calc_bench) / sizeof(calc_bench[0]))
+
+// Timer1 at F_CPU/1 counts CPU cycles (up to 65535, 8.9ms at 7.3728MHz)
+static void cycles_start(void)
+{
+    TCCR1A = 0;
+    TCCR1B = (1 << CS10);
+    TCNT1 = 0;
+}
+
+static uint16_t cycles_stop(void)
+{
+    uint16_t cycles = TCNT1;
+    TCCR1B = 0;
+    return cycles;
+}
+
+void demo5_engine_benchmark(void)
+{
+    char buf[80];
+    char text[CALC_FORMAT_SIZE];
+    uint8_t i, err;
+    int32_t value;
+    uint16_t cycles, overhead, worst = 0;
+
+    puts_USART1("\r\n=== DEMO 5: Calculator Engine Benchmark ===\r\n");
+    puts_USART1("Expression                     Result        Cycles\r\n");
+
+    cli(); // no keypad ticks inside the measurements
+    cycles_start();
+    overhead = cycles_stop();
+    sei();
+
+    for (i = 0; i < CALC_BENCH_COUNT; i++)
+    {
+        const calc_bench_t *t = &calc_bench[i];
+
+        value = 0;
+        cli();
+        cycles_start();
+        err = Calc_eval(t->expr, t->mode, &value);
+        cycles = cycles_stop() - overhead;
+        sei();
+
+        if (err == CALC_OK)
+            Calc_format(value, t->mode, text);
+        else
+            strcpy_P(text, Calc_error_P(err));
+
+        if (cycles > worst)
+            worst = cycles;
+        sprintf(buf, "%-30s %-13s %5u\r\n", t->expr, text, cycles);
+        puts_USART1(buf);
+    }
+
+    // Formatting the widest integer: engine formatter vs sprintf
+    cli();
+    cycles_start();
+    Calc_format(-2147483647L - 1, CALC_MODE_INT, text);
+    cycles = cycles_stop() - overhead;
+    cycles_start();
+    sprintf(buf, "%ld", -2147483647L - 1);
+    uint16_t sprintf_cycles = cycles_stop() - overhead;
+    sei();
+
+    sprintf(buf, "\r\nFormat %s: Calc_format %u cycles, sprintf %u cycles\r\n", text, cycles, sprintf_cycles);
+    puts_USART1(buf);
+
+    Lcd_clear();
+    Lcd_puts_at(0, 0, "Engine bench");
+    sprintf(buf, "max %u cycles", worst);
+    Lcd_puts_at(1, 0, buf);
+
+    puts_USART1("Press any key to continue...");
+    getch_USART1();
+}
+
 /* ========================================================================
  * Main Menu System
  * ======================================================================== */
@@ -686,16 +658,25 @@ void display_main_menu(void)
     puts_USART1("  [2] Menu System\r\n");
     puts_USART1("  [3] Guessing Game\r\n");
     puts_USART1("  [4] Stopwatch\r\n");
+    puts_USART1("  [5] Engine Cycle Benchmark\r\n");
     puts_USART1("\r\n");
-    puts_USART1("Enter selection (1-4): ");
+    puts_USART1("Enter selection (1-5): ");
+}
+
+// System tick: with -DKEYPAD_ENABLED the handler scans one keypad row
+ISR(TIMER2_OVF_vect)
+{
+    Timer2_ovf_handler();
 }
 
 int main(void)
 {
     // Initialize peripherals
     Uart1_init();
-    lcd_init();
-    keypad_init();
+    Lcd_init();
+    Keypad_init();
+    Timer2_init();
+    UCSR1B &= ~(1 << RXCIE1); // UART is polled: the Timer2 tick is the only interrupt
 
     // Configure status LEDs
     DDRC = 0xFF;
@@ -707,9 +688,11 @@ int main(void)
     puts_USART1("Interactive Applications\r\n");
 
     // Welcome screen
-    lcd_clear();
-    lcd_puts_at(0, 0, "Calculator");
-    lcd_puts_at(1, 0, "  Ready!");
+    Lcd_clear();
+    Lcd_puts_at(0, 0, "Calculator");
+    Lcd_puts_at(1, 0, "  Ready!");
+
+    sei(); // the Timer2 tick scans the keypad in the background
 
     PORTC = 0x0F;
     _delay_ms(2000);
@@ -737,10 +720,13 @@ int main(void)
         case '4':
             demo4_stopwatch();
             break;
+        case '5':
+            demo5_engine_benchmark();
+            break;
         default:
             puts_USART1("Invalid selection!\r\n");
-            lcd_clear();
-            lcd_puts_at(0, 0, "Invalid!");
+            Lcd_clear();
+            Lcd_puts_at(0, 0, "Invalid!");
             _delay_ms(1000);
             break;
         }
@@ -5,9 +5,12 @@
 #define BAUD 9600
 
 #include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/pgmspace.h>
 #include <util/delay.h>
 #include <stdio.h>
 #include <stdint.h>
+#include <string.h>
 #include "../../shared_libs/_uart.h"
 
 #endif
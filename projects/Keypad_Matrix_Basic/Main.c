@@ -56,99 +56,7 @@
 
 #include "config.h"
 
-// LCD Control Pins
-#define LCD_DDR DDRG
-#define LCD_PORT PORTG
-#define LCD_RS 0
-#define LCD_E 1
-#define LCD_D4 2
-
-// LCD Commands
-#define LCD_CLEAR 0x01
-#define LCD_ENTRY_MODE 0x06
-#define LCD_DISPLAY_ON 0x0C
-#define LCD_FUNCTION_SET 0x28
-#define LCD_DDRAM_ADDR 0x80
-
-// Basic LCD functions
-void lcd_enable_pulse(void)
-{
-    LCD_PORT |= (1 << LCD_E);
-    _delay_us(1);
-    LCD_PORT &= ~(1 << LCD_E);
-    _delay_us(50);
-}
-
-void lcd_write_nibble(uint8_t nibble)
-{
-    LCD_PORT = (LCD_PORT & 0xC3) | ((nibble & 0x0F) << LCD_D4);
-    lcd_enable_pulse();
-}
-
-void lcd_write_byte(uint8_t data, uint8_t rs)
-{
-    if (rs)
-        LCD_PORT |= (1 << LCD_RS);
-    else
-        LCD_PORT &= ~(1 << LCD_RS);
-    lcd_write_nibble(data >> 4);
-    lcd_write_nibble(data & 0x0F);
-    _delay_us(50);
-}
-
-void lcd_command(uint8_t cmd)
-{
-    lcd_write_byte(cmd, 0);
-    if (cmd == LCD_CLEAR)
-        _delay_ms(2);
-}
-
-void lcd_data(uint8_t data)
-{
-    lcd_write_byte(data, 1);
-}
-
-void lcd_init(void)
-{
-    LCD_DDR |= (1 << LCD_RS) | (1 << LCD_E) | (1 << LCD_D4) | (1 << 3) | (1 << 4) | (1 << 5);
-    _delay_ms(50);
-    LCD_PORT &= ~(1 << LCD_RS);
-    lcd_write_nibble(0x03);
-    _delay_ms(5);
-    lcd_write_nibble(0x03);
-    _delay_us(150);
-    lcd_write_nibble(0x03);
-    _delay_us(150);
-    lcd_write_nibble(0x02);
-    _delay_us(150);
-    lcd_command(LCD_FUNCTION_SET);
-    lcd_command(LCD_DISPLAY_ON);
-    lcd_command(LCD_CLEAR);
-    lcd_command(LCD_ENTRY_MODE);
-}
-
-void lcd_clear(void)
-{
-    lcd_command(LCD_CLEAR);
-}
-
-void lcd_goto(uint8_t row, uint8_t col)
-{
-    uint8_t address = (row == 0) ? 0x00 + col : 0x40 + col;
-    lcd_command(LCD_DDRAM_ADDR | address);
-}
-
-void lcd_puts(const char *str)
-{
-    while (*str)
-        lcd_data(*str++);
-}
-
-void lcd_puts_at(uint8_t row, uint8_t col, const char *str)
-{
-    lcd_goto(row, col);
-    lcd_puts(str);
-}
+#include "../../shared_libs/_lcd.h" // HD44780 driver with shadow DDRAM (only changed cells are sent)
 
 // Keypad port definitions
 #define KEYPAD_DDR DDRA
@@ -252,8 +160,8 @@ void demo1_basic_detection(void)
     puts_USART1("Press keys on the keypad\r\n");
     puts_USART1("Press 'D' to exit\r\n\r\n");
 
-    lcd_clear();
-    lcd_puts_at(0, 0, "Press any key:");
+    Lcd_clear();
+    Lcd_puts_at(0, 0, "Press any key:");
 
     uint16_t key_count = 0;
 
@@ -269,7 +177,7 @@ void demo1_basic_detection(void)
             // Display on LCD
             char buf[20];
             sprintf(buf, "Key: %c (#%u)  ", key, key_count);
-            lcd_puts_at(1, 0, buf);
+            Lcd_puts_at(1, 0, buf);
 
             // Send to UART
             sprintf(buf, "Key pressed: '%c' (Count: %u)\r\n", key, key_count);
@@ -317,12 +225,12 @@ void demo2_test_pattern(void)
     uint8_t seq_index = 0;
     uint8_t total_keys = 16;
 
-    lcd_clear();
-    lcd_puts_at(0, 0, "Test: Press");
+    Lcd_clear();
+    Lcd_puts_at(0, 0, "Test: Press");
 
     char buf[20];
     sprintf(buf, "Key: %c (%u/%u)", test_sequence[seq_index], seq_index + 1, total_keys);
-    lcd_puts_at(1, 0, buf);
+    Lcd_puts_at(1, 0, buf);
 
     while (seq_index < total_keys)
     {
@@ -343,17 +251,17 @@ void demo2_test_pattern(void)
             if (seq_index < total_keys)
             {
                 sprintf(buf, "Key: %c (%u/%u)", test_sequence[seq_index], seq_index + 1, total_keys);
-                lcd_puts_at(1, 0, buf);
+                Lcd_puts_at(1, 0, buf);
             }
         }
         else
         {
             // Wrong key
             puts_USART1("  ✗ Wrong key!\r\n");
-            lcd_clear();
-            lcd_puts_at(0, 0, "Wrong! Try:");
+            Lcd_clear();
+            Lcd_puts_at(0, 0, "Wrong! Try:");
             sprintf(buf, "%c", test_sequence[seq_index]);
-            lcd_puts_at(1, 0, buf);
+            Lcd_puts_at(1, 0, buf);
 
             // Flash LEDs
             for (uint8_t i = 0; i < 3; i++)
@@ -364,17 +272,17 @@ void demo2_test_pattern(void)
                 _delay_ms(100);
             }
 
-            lcd_clear();
-            lcd_puts_at(0, 0, "Test: Press");
+            Lcd_clear();
+            Lcd_puts_at(0, 0, "Test: Press");
             sprintf(buf, "Key: %c (%u/%u)", test_sequence[seq_index], seq_index + 1, total_keys);
-            lcd_puts_at(1, 0, buf);
+            Lcd_puts_at(1, 0, buf);
         }
     }
 
     // All keys tested!
-    lcd_clear();
-    lcd_puts_at(0, 0, "Test Complete!");
-    lcd_puts_at(1, 0, "All keys OK");
+    Lcd_clear();
+    Lcd_puts_at(0, 0, "Test Complete!");
+    Lcd_puts_at(1, 0, "All keys OK");
 
     puts_USART1("\r\n✓ Keypad test PASSED!\r\n");
     PORTC = 0xFF;
@@ -393,8 +301,8 @@ void demo3_multi_key(void)
     puts_USART1("Detecting simultaneous key presses\r\n");
     puts_USART1("Press 'D' to exit\r\n\r\n");
 
-    lcd_clear();
-    lcd_puts_at(0, 0, "Multi-Key Test:");
+    Lcd_clear();
+    Lcd_puts_at(0, 0, "Multi-Key Test:");
 
     while (1)
     {
@@ -422,13 +330,13 @@ void demo3_multi_key(void)
         if (key_count > 0)
         {
             // Display pressed keys
-            lcd_goto(1, 0);
+            Lcd_goto(1, 0);
             char buf[20];
 
             if (key_count == 1)
             {
                 sprintf(buf, "Keys: %c       ", keys_pressed[0]);
-                lcd_puts(buf);
+                Lcd_puts(buf);
 
                 // Check for exit
                 if (keys_pressed[0] == 'D')
@@ -441,16 +349,16 @@ void demo3_multi_key(void)
             else
             {
                 sprintf(buf, "Keys:%u [", key_count);
-                lcd_puts(buf);
+                Lcd_puts(buf);
 
                 puts_USART1("\rMultiple keys: ");
                 for (uint8_t i = 0; i < key_count && i < 5; i++)
                 {
-                    lcd_data(keys_pressed[i]);
+                    Lcd_putc(keys_pressed[i]);
                     putch_USART1(keys_pressed[i]);
                     putch_USART1(' ');
                 }
-                lcd_puts("]   ");
+                Lcd_puts("]   ");
                 puts_USART1("   ");
             }
 
@@ -458,7 +366,7 @@ void demo3_multi_key(void)
         }
         else
         {
-            lcd_puts_at(1, 0, "No keys         ");
+            Lcd_puts_at(1, 0, "No keys         ");
             PORTC = 0x00;
         }
 
@@ -475,8 +383,8 @@ void demo4_frequency_test(void)
     puts_USART1("Measuring keypad scan rate\r\n");
     puts_USART1("Press any key, hold, then release\r\n\r\n");
 
-    lcd_clear();
-    lcd_puts_at(0, 0, "Scan Rate Test:");
+    Lcd_clear();
+    Lcd_puts_at(0, 0, "Scan Rate Test:");
 
     puts_USART1("Starting scan rate measurement...\r\n");
 
@@ -499,10 +407,10 @@ void demo4_frequency_test(void)
             if (key != '\0')
             {
                 key_detect_count++;
-                lcd_goto(1, 0);
+                Lcd_goto(1, 0);
                 char buf[20];
                 sprintf(buf, "Key: %c Cnt:%u ", key, key_detect_count);
-                lcd_puts(buf);
+                Lcd_puts(buf);
                 PORTC = 0xFF;
             }
             else
@@ -528,10 +436,10 @@ void demo4_frequency_test(void)
     sprintf(buf, "Total detections: %u\r\n", key_detect_count);
     puts_USART1(buf);
 
-    lcd_clear();
-    lcd_puts_at(0, 0, "Test Complete!");
+    Lcd_clear();
+    Lcd_puts_at(0, 0, "Test Complete!");
     sprintf(buf, "Rate:%lu/s", scan_count / 5);
-    lcd_puts_at(1, 0, buf);
+    Lcd_puts_at(1, 0, buf);
 
     _delay_ms(2000);
 
@@ -562,7 +470,7 @@ int main(void)
 {
     // Initialize peripherals
     Uart1_init();
-    lcd_init();
+    Lcd_init();
     keypad_init();
 
     // Configure status LEDs
@@ -575,9 +483,9 @@ int main(void)
     puts_USART1("Row/Column scanning technique\r\n");
 
     // Welcome screen
-    lcd_clear();
-    lcd_puts_at(0, 0, " Keypad Ready");
-    lcd_puts_at(1, 0, " 4x4 Matrix");
+    Lcd_clear();
+    Lcd_puts_at(0, 0, " Keypad Ready");
+    Lcd_puts_at(1, 0, " 4x4 Matrix");
 
     PORTC = 0x01;
     _delay_ms(2000);
@@ -606,8 +514,8 @@ int main(void)
             break;
         default:
             puts_USART1("Invalid selection!\r\n");
-            lcd_clear();
-            lcd_puts_at(0, 0, "Invalid!");
+            Lcd_clear();
+            Lcd_puts_at(0, 0, "Invalid!");
             _delay_ms(1000);
             break;
         }
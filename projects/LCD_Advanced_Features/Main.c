@@ -32,7 +32,7 @@
  * - Vertical scrolling displays
  * - Animated progress bars and meters
  * - Custom character animations
- * - Multi-level menu navigation
+ * - Multi-level PROGMEM menu on LCD and terminal (shared_libs/_menu.c)
  *
  * LEARNING PROGRESSION:
  * - Demo 1: Scrolling Text Effects
@@ -45,151 +45,9 @@
 
 #include "config.h"
 
-// LCD Control Pins
-#define LCD_DDR DDRG
-#define LCD_PORT PORTG
-#define LCD_RS 0
-#define LCD_E 1
-#define LCD_D4 2
-#define LCD_D5 3
-#define LCD_D6 4
-#define LCD_D7 5
-
-// LCD Commands
-#define LCD_CLEAR 0x01
-#define LCD_HOME 0x02
-#define LCD_ENTRY_MODE 0x06
-#define LCD_DISPLAY_ON 0x0C
-#define LCD_FUNCTION_SET 0x28
-#define LCD_CGRAM_ADDR 0x40
-#define LCD_DDRAM_ADDR 0x80
-
-// LCD dimensions
-#define LCD_ROWS 2
-#define LCD_COLS 16
-
-/*
- * Basic LCD functions (same as basic project)
- */
-void lcd_enable_pulse(void)
-{
-    LCD_PORT |= (1 << LCD_E);
-    _delay_us(1);
-    LCD_PORT &= ~(1 << LCD_E);
-    _delay_us(50);
-}
-
-void lcd_write_nibble(uint8_t nibble)
-{
-    LCD_PORT = (LCD_PORT & 0xC3) | ((nibble & 0x0F) << LCD_D4);
-    lcd_enable_pulse();
-}
-
-void lcd_write_byte(uint8_t data, uint8_t rs)
-{
-    if (rs)
-        LCD_PORT |= (1 << LCD_RS);
-    else
-        LCD_PORT &= ~(1 << LCD_RS);
-
-    lcd_write_nibble(data >> 4);
-    lcd_write_nibble(data & 0x0F);
-    _delay_us(50);
-}
-
-void lcd_command(uint8_t cmd)
-{
-    lcd_write_byte(cmd, 0);
-    if (cmd == LCD_CLEAR || cmd == LCD_HOME)
-        _delay_ms(2);
-}
-
-void lcd_data(uint8_t data)
-{
-    lcd_write_byte(data, 1);
-}
-
-void lcd_init(void)
-{
-    LCD_DDR |= (1 << LCD_RS) | (1 << LCD_E) |
-               (1 << LCD_D4) | (1 << LCD_D5) |
-               (1 << LCD_D6) | (1 << LCD_D7);
-
-    _delay_ms(50);
-    LCD_PORT &= ~(1 << LCD_RS);
-
-    lcd_write_nibble(0x03);
-    _delay_ms(5);
-    lcd_write_nibble(0x03);
-    _delay_us(150);
-    lcd_write_nibble(0x03);
-    _delay_us(150);
-    lcd_write_nibble(0x02);
-    _delay_us(150);
-
-    lcd_command(LCD_FUNCTION_SET);
-    lcd_command(LCD_DISPLAY_ON);
-    lcd_command(LCD_CLEAR);
-    lcd_command(LCD_ENTRY_MODE);
-}
-
-void lcd_clear(void)
-{
-    lcd_command(LCD_CLEAR);
-}
-
-void lcd_goto(uint8_t row, uint8_t col)
-{
-    uint8_t address;
-    switch (row)
-    {
-    case 0:
-        address = 0x00 + col;
-        break;
-    case 1:
-        address = 0x40 + col;
-        break;
-    default:
-        address = 0x00;
-        break;
-    }
-    lcd_command(LCD_DDRAM_ADDR | address);
-}
-
-void lcd_puts(const char *str)
-{
-    while (*str)
-    {
-        lcd_data(*str++);
-    }
-}
-
-void lcd_puts_at(uint8_t row, uint8_t col, const char *str)
-{
-    lcd_goto(row, col);
-    lcd_puts(str);
-}
-
-void lcd_create_char(uint8_t location, const uint8_t *pattern)
-{
-    lcd_command(LCD_CGRAM_ADDR | (location << 3));
-    for (uint8_t i = 0; i < 8; i++)
-    {
-        lcd_data(pattern[i]);
-    }
-}
-
-/*
- * Clear a specific row
- */
-void lcd_clear_row(uint8_t row)
-{
-    lcd_goto(row, 0);
-    for (uint8_t i = 0; i < LCD_COLS; i++)
-    {
-        lcd_data(' ');
-    }
-}
+#include "../../shared_libs/_lcd.h"       // HD44780 driver with shadow DDRAM (only changed cells are sent)
+#include "../../shared_libs/_lcd_glyph.h" // CGRAM glyph cache and bar widgets
+#include "../../shared_libs/_menu.h"      // PROGMEM menu tree, redraws only changed lines
 
 /* ========================================================================
  * DEMO 1: Horizontal Scrolling Marquee
@@ -204,18 +62,18 @@ void demo1_scrolling_text(void)
     while (message[msg_len])
         msg_len++;
 
-    lcd_clear();
-    lcd_puts_at(0, 0, "Scrolling Demo:");
+    Lcd_clear();
+    Lcd_puts_at(0, 0, "Scrolling Demo:");
 
     uint8_t offset = 0;
 
     while (1)
     {
         // Display 16 characters starting from offset
-        lcd_goto(1, 0);
+        Lcd_goto(1, 0);
         for (uint8_t i = 0; i < LCD_COLS; i++)
         {
-            lcd_data(message[(offset + i) % msg_len]);
+            Lcd_putc(message[(offset + i) % msg_len]);
         }
 
         offset++;
@@ -248,57 +106,17 @@ void demo2_progress_bars(void)
 {
     puts_USART1("\r\n=== DEMO 2: Progress Bars ===\r\n");
 
-    // Define custom characters for progress bar
-    const uint8_t bar_empty[8] = {
-        0b11111, 0b10001, 0b10001, 0b10001,
-        0b10001, 0b10001, 0b10001, 0b11111};
-    const uint8_t bar_full[8] = {
-        0b11111, 0b11111, 0b11111, 0b11111,
-        0b11111, 0b11111, 0b11111, 0b11111};
-    const uint8_t bar_1[8] = {
-        0b11111, 0b11001, 0b11001, 0b11001,
-        0b11001, 0b11001, 0b11001, 0b11111};
-    const uint8_t bar_2[8] = {
-        0b11111, 0b11101, 0b11101, 0b11101,
-        0b11101, 0b11101, 0b11101, 0b11111};
-    const uint8_t bar_3[8] = {
-        0b11111, 0b11111, 0b11101, 0b11101,
-        0b11101, 0b11101, 0b11111, 0b11111};
-
-    lcd_create_char(0, bar_empty);
-    lcd_create_char(1, bar_1);
-    lcd_create_char(2, bar_2);
-    lcd_create_char(3, bar_3);
-    lcd_create_char(4, bar_full);
-
-    // Demo: Loading simulation
-    lcd_clear();
-    lcd_puts_at(0, 0, "Loading...");
+    // Bar glyphs come from the CGRAM cache: only the partial cell needs one
+    Glyph_reset();
+    Glyph_reset_stats();
+
+    // Demo: Loading simulation (16 cells x 5 columns = 80 steps)
+    Lcd_clear();
+    Lcd_puts_at(0, 0, "Loading...");
 
     for (uint8_t percent = 0; percent <= 100; percent += 5)
     {
-        // Calculate bar representation
-        uint16_t total_segments = LCD_COLS * 4; // 4 segments per character
-        uint16_t filled = (total_segments * percent) / 100;
-
-        lcd_goto(1, 0);
-        for (uint8_t i = 0; i < LCD_COLS; i++)
-        {
-            uint16_t seg_pos = i * 4;
-            if (seg_pos + 4 <= filled)
-            {
-                lcd_data(4); // Full
-            }
-            else if (seg_pos >= filled)
-            {
-                lcd_data(0); // Empty
-            }
-            else
-            {
-                uint8_t partial = filled - seg_pos;
-                lcd_data(partial); // Partial (1-3)
-            }
-        }
+        Glyph_bar_horizontal(1, 0, LCD_COLS, percent, 100);
 
         // Display percentage
         char buf[20];
@@ -309,9 +127,30 @@ void demo2_progress_bars(void)
         _delay_ms(100);
     }
 
-    lcd_clear();
-    lcd_puts_at(0, 0, "Complete!");
-    lcd_puts_at(1, 0, "    100%");
+    // Level meters: four vertical bars over both rows (16 steps each)
+    Lcd_clear();
+    Lcd_puts_at(0, 0, "Levels");
+    for (uint8_t t = 0; t < 64; t++)
+    {
+        for (uint8_t ch = 0; ch < 4; ch++)
+        {
+            uint8_t phase = (t * (ch + 1) + ch * 5) & 31;
+            uint8_t level = (phase < 16) ? phase : 31 - phase; // triangle wave 0..15
+            Glyph_bar_vertical(1, 12 + ch, 2, level, 15);
+        }
+        _delay_ms(60);
+    }
+
+    Glyph_stats_t stats;
+    Glyph_get_stats(&stats);
+    char buf[60];
+    sprintf(buf, "\r\nCGRAM cache: %u hits, %u uploads, %u evictions\r\n",
+            stats.hits, stats.misses, stats.evictions);
+    puts_USART1(buf);
+
+    Lcd_clear();
+    Lcd_puts_at(0, 0, "Complete!");
+    Lcd_puts_at(1, 0, "    100%");
 
     puts_USART1("\r\n\r\nProgress complete!\r\n");
     _delay_ms(2000);
@@ -323,31 +162,25 @@ void demo2_progress_bars(void)
 /* ========================================================================
  * DEMO 3: Animated Graphics
  * ======================================================================== */
+// Animation glyphs live in flash; the cache puts them into CGRAM on first use
+static const Glyph_t SPINNER[4] PROGMEM = {
+    {{0b00000, 0b00000, 0b00100, 0b01110, 0b11111, 0b01110, 0b00100, 0b00000}, '*'},
+    {{0b00000, 0b00100, 0b01100, 0b11100, 0b11100, 0b01100, 0b00100, 0b00000}, '<'},
+    {{0b00000, 0b01000, 0b01000, 0b11000, 0b11000, 0b01000, 0b01000, 0b00000}, '|'},
+    {{0b01000, 0b01000, 0b01100, 0b01110, 0b01110, 0b01100, 0b01000, 0b01000}, '>'}};
+
+static const Glyph_t BALL PROGMEM = {
+    {0b00000, 0b00000, 0b01110, 0b11111, 0b11111, 0b01110, 0b00000, 0b00000}, 'o'};
+
 void demo3_animations(void)
 {
     puts_USART1("\r\n=== DEMO 3: Animated Graphics ===\r\n");
 
-    // Spinner animation characters
-    const uint8_t spinner1[8] = {
-        0b00000, 0b00000, 0b00100, 0b01110,
-        0b11111, 0b01110, 0b00100, 0b00000};
-    const uint8_t spinner2[8] = {
-        0b00000, 0b00100, 0b01100, 0b11100,
-        0b11100, 0b01100, 0b00100, 0b00000};
-    const uint8_t spinner3[8] = {
-        0b00000, 0b01000, 0b01000, 0b11000,
-        0b11000, 0b01000, 0b01000, 0b00000};
-    const uint8_t spinner4[8] = {
-        0b01000, 0b01000, 0b01100, 0b01110,
-        0b01110, 0b01100, 0b01000, 0b01000};
-
-    lcd_create_char(0, spinner1);
-    lcd_create_char(1, spinner2);
-    lcd_create_char(2, spinner3);
-    lcd_create_char(3, spinner4);
-
-    lcd_clear();
-    lcd_puts_at(0, 0, "Processing...");
+    Glyph_reset();
+    Glyph_reset_stats();
+
+    Lcd_clear();
+    Lcd_puts_at(0, 0, "Processing...");
 
     puts_USART1("Displaying spinner animation\r\n");
 
@@ -355,8 +188,8 @@ void demo3_animations(void)
     {
         for (uint8_t frame = 0; frame < 4; frame++)
         {
-            lcd_goto(1, 7);
-            lcd_data(frame);
+            Lcd_goto(1, 7);
+            Lcd_putc(Glyph_get(&SPINNER[frame])); // uploaded once, then cache hits
 
             PORTC = 1 << frame;
             _delay_ms(100);
@@ -364,14 +197,8 @@ void demo3_animations(void)
     }
 
     // Bouncing ball animation
-    lcd_clear();
-    lcd_puts_at(0, 0, "Bouncing:");
-
-    const uint8_t ball[8] = {
-        0b00000, 0b00000, 0b01110,
-        0b11111, 0b11111, 0b01110,
-        0b00000, 0b00000};
-    lcd_create_char(0, ball);
+    Lcd_clear();
+    Lcd_puts_at(0, 0, "Bouncing:");
 
     puts_USART1("Displaying bouncing ball\r\n");
 
@@ -380,21 +207,27 @@ void demo3_animations(void)
         // Move right
         for (uint8_t pos = 0; pos < LCD_COLS; pos++)
         {
-            lcd_clear_row(1);
-            lcd_goto(1, pos);
-            lcd_data(0);
+            Lcd_clear_row(1);
+            Lcd_goto(1, pos);
+            Lcd_putc(Glyph_get(&BALL));
             _delay_ms(80);
         }
         // Move left
         for (int8_t pos = LCD_COLS - 1; pos >= 0; pos--)
         {
-            lcd_clear_row(1);
-            lcd_goto(1, pos);
-            lcd_data(0);
+            Lcd_clear_row(1);
+            Lcd_goto(1, pos);
+            Lcd_putc(Glyph_get(&BALL));
             _delay_ms(80);
         }
     }
 
+    Glyph_stats_t stats;
+    Glyph_get_stats(&stats);
+    char buf[60];
+    sprintf(buf, "CGRAM cache: %u hits, %u uploads\r\n", stats.hits, stats.misses);
+    puts_USART1(buf);
+
     puts_USART1("\r\nAnimation complete!\r\n");
     puts_USART1("Press any key to continue...");
     getch_USART1();
@@ -403,89 +236,87 @@ void demo3_animations(void)
 /* ========================================================================
  * DEMO 4: Interactive Menu System
  * ======================================================================== */
-void demo4_menu_system(void)
+// Menu tree: every label, page and callback is a constant in flash
+static void menu_leds_on(void)
 {
-    puts_USART1("\r\n=== DEMO 4: Menu System ===\r\n");
-    puts_USART1("Commands: w=up, s=down, ENTER=select, q=quit\r\n");
-
-    // Arrow characters
-    const uint8_t arrow_right[8] = {
-        0b00000, 0b01000, 0b01100, 0b01110,
-        0b01100, 0b01000, 0b00000, 0b00000};
-    lcd_create_char(0, arrow_right);
-
-    const char *menu_items[] = {
-        "Settings",
-        "Display",
-        "Sensors",
-        "About"};
-    uint8_t menu_size = 4;
-    uint8_t selected = 0;
-
-    while (1)
-    {
-        // Display menu
-        lcd_clear();
-        lcd_puts_at(0, 0, "MENU:");
-
-        // Show current and next item
-        lcd_goto(1, 0);
-        lcd_data(0); // Arrow
-        lcd_data(' ');
-        lcd_puts(menu_items[selected]);
-
-        // UART feedback
-        char buf[40];
-        sprintf(buf, "\rSelected: %s      ", menu_items[selected]);
-        puts_USART1(buf);
-
-        // LED indicator
-        PORTC = 1 << selected;
+    PORTC = 0xFF;
+}
 
-        // Wait for input
-        char cmd = getch_USART1();
-        putch_USART1(cmd);
+static void menu_leds_off(void)
+{
+    PORTC = 0x00;
+}
 
-        switch (cmd)
-        {
-        case 'w':
-        case 'W':
-            if (selected > 0)
-                selected--;
-            else
-                selected = menu_size - 1;
-            break;
+static void menu_leds_count(void)
+{
+    PORTC++;
+}
 
-        case 's':
-        case 'S':
-            if (selected < menu_size - 1)
-                selected++;
-            else
-                selected = 0;
-            break;
+static void menu_about(void)
+{
+    Lcd_clear();
+    Lcd_puts_at(0, 0, "ATmega128 LCD");
+    Lcd_puts_at(1, 0, "Menu: _menu.c");
+    _delay_ms(1500);
+}
 
-        case '\r':
-        case '\n':
-            // Item selected
-            lcd_clear();
-            lcd_puts_at(0, 0, "Selected:");
-            lcd_puts_at(1, 0, menu_items[selected]);
+static const char menu_s_main[] PROGMEM = "MENU";
+static const char menu_s_demos[] PROGMEM = "Demos";
+static const char menu_s_scroll[] PROGMEM = "Scrolling";
+static const char menu_s_progress[] PROGMEM = "Progress";
+static const char menu_s_graphics[] PROGMEM = "Graphics";
+static const char menu_s_leds[] PROGMEM = "LEDs";
+static const char menu_s_on[] PROGMEM = "All on";
+static const char menu_s_off[] PROGMEM = "All off";
+static const char menu_s_count[] PROGMEM = "Count";
+static const char menu_s_about[] PROGMEM = "About";
+static const char menu_s_back[] PROGMEM = "Back";
+static const char menu_s_exit[] PROGMEM = "Exit";
+
+static const Menu_item_t demos_items[] PROGMEM = {
+    {menu_s_scroll, 0, demo1_scrolling_text},
+    {menu_s_progress, 0, demo2_progress_bars},
+    {menu_s_graphics, 0, demo3_animations},
+    {menu_s_back, 0, 0}};
+static const Menu_page_t demos_page PROGMEM = {menu_s_demos, demos_items, MENU_COUNT(demos_items)};
+
+static const Menu_item_t leds_items[] PROGMEM = {
+    {menu_s_on, 0, menu_leds_on},
+    {menu_s_off, 0, menu_leds_off},
+    {menu_s_count, 0, menu_leds_count},
+    {menu_s_back, 0, 0}};
+static const Menu_page_t leds_page PROGMEM = {menu_s_leds, leds_items, MENU_COUNT(leds_items)};
+
+static const Menu_item_t main_items[] PROGMEM = {
+    {menu_s_demos, &demos_page, 0},
+    {menu_s_leds, &leds_page, 0},
+    {menu_s_about, 0, menu_about},
+    {menu_s_exit, 0, 0}};
+static const Menu_page_t main_page PROGMEM = {menu_s_main, main_items, MENU_COUNT(main_items)};
 
-            sprintf(buf, "\r\n\r\nOpening: %s\r\n", menu_items[selected]);
-            puts_USART1(buf);
+void demo4_menu_system(void)
+{
+    char buf[48];
 
-            PORTC = 0xFF;
-            _delay_ms(1500);
-            break;
+    // The same tree on the LCD and, in a VT100 terminal, on the UART.
+    // Moving the selection rewrites only the two lines that changed.
+    Menu_init(&main_page);
+    Menu_attach(&Menu_lcd);
+    Menu_attach(&Menu_uart);
 
-        case 'q':
-        case 'Q':
-            puts_USART1("\r\n\r\nExiting menu...\r\n");
-            return;
+    uint8_t result = MENU_OPENED;
+    do
+    {
+        if (result == MENU_OPENED || result == MENU_ACTION)
+        {
+            // the terminal was cleared for the full redraw
+            puts_USART1("\033[12;1Hw=up s=down Enter=select q=back 1-9=pick");
         }
+        result = Menu_input(Menu_key_uart(getch_USART1()));
+    } while (result != MENU_EXIT);
 
-        _delay_ms(100);
-    }
+    sprintf(buf, "\033[2J\033[HExiting menu (%u lines drawn)\r\n", Menu_lines_drawn());
+    puts_USART1(buf);
 }
 
 /* ========================================================================
@@ -511,7 +342,7 @@ int main(void)
 {
     // Initialize peripherals
     Uart1_init();
-    lcd_init();
+    Lcd_init();
 
     // Configure status LEDs
     DDRC = 0xFF;
@@ -523,17 +354,17 @@ int main(void)
     puts_USART1("Scrolling, Animation, Menus\r\n");
 
     // Welcome animation
-    lcd_clear();
+    Lcd_clear();
     const char *msg = "  LCD Advanced  ";
     for (uint8_t i = 0; i < 16; i++)
     {
-        lcd_goto(0, i);
-        lcd_data(msg[i]);
+        Lcd_goto(0, i);
+        Lcd_putc(msg[i]);
         PORTC = 1 << (i % 8);
         _delay_ms(50);
     }
 
-    lcd_puts_at(1, 0, "  Features!");
+    Lcd_puts_at(1, 0, "  Features!");
     _delay_ms(1500);
 
     while (1)
@@ -560,8 +391,8 @@ int main(void)
             break;
         default:
             puts_USART1("Invalid selection!\r\n");
-            lcd_clear();
-            lcd_puts_at(0, 0, "Invalid!");
+            Lcd_clear();
+            Lcd_puts_at(0, 0, "Invalid!");
             _delay_ms(1000);
             break;
         }
@@ -5,6 +5,7 @@
 #define BAUD 9600
 
 #include <avr/io.h>
+#include <avr/pgmspace.h>
 #include <util/delay.h>
 #include <stdio.h>
 #include "../../shared_libs/_uart.h"
@@ -32,6 +32,7 @@
  * - Demo 3: Cursor and Display Control
  * - Demo 4: Custom Character Creation
  * - Demo 5: Dynamic Content Updates
+ * - Menu 5: Bus throughput of the selected LCD backend (chars/s)
  *
  * =============================================================================
  */
@@ -39,199 +40,7 @@
 
 #include "config.h"
 
-// LCD Control Pin Definitions
-#define LCD_DDR DDRG
-#define LCD_PORT PORTG
-#define LCD_RS 0 // Register Select (0=Command, 1=Data)
-#define LCD_E 1  // Enable
-#define LCD_D4 2 // Data bit 4
-#define LCD_D5 3 // Data bit 5
-#define LCD_D6 4 // Data bit 6
-#define LCD_D7 5 // Data bit 7
-
-// LCD Commands
-#define LCD_CLEAR 0x01
-#define LCD_HOME 0x02
-#define LCD_ENTRY_MODE 0x06     // Increment cursor, no shift
-#define LCD_DISPLAY_ON 0x0C     // Display on, cursor off, blink off
-#define LCD_DISPLAY_CURSOR 0x0E // Display on, cursor on
-#define LCD_DISPLAY_BLINK 0x0F  // Display on, cursor on, blink on
-#define LCD_FUNCTION_SET 0x28   // 4-bit mode, 2 lines, 5x8 font
-#define LCD_CGRAM_ADDR 0x40
-#define LCD_DDRAM_ADDR 0x80
-
-// LCD dimensions
-#define LCD_ROWS 2
-#define LCD_COLS 16
-
-                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                      /*
-                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       * Send enable pulse
-                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       */
-                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                      void lcd_enable_pulse(void)
-{
-    LCD_PORT |= (1 << LCD_E);
-    _delay_us(1);
-    LCD_PORT &= ~(1 << LCD_E);
-    _delay_us(50);
-}
-
-/*
- * Write 4 bits to LCD
- */
-void lcd_write_nibble(uint8_t nibble)
-{
-    // Set data pins
-    LCD_PORT = (LCD_PORT & 0xC3) | ((nibble & 0x0F) << LCD_D4);
-    lcd_enable_pulse();
-}
-
-/*
- * Write byte to LCD (8 bits as two 4-bit transfers)
- */
-void lcd_write_byte(uint8_t data, uint8_t rs)
-{
-    // Set RS pin
-    if (rs)
-        LCD_PORT |= (1 << LCD_RS);
-    else
-        LCD_PORT &= ~(1 << LCD_RS);
-
-    // Send high nibble
-    lcd_write_nibble(data >> 4);
-
-    // Send low nibble
-    lcd_write_nibble(data & 0x0F);
-
-    _delay_us(50);
-}
-
-/*
- * Send command to LCD
- */
-void lcd_command(uint8_t cmd)
-{
-    lcd_write_byte(cmd, 0);
-    if (cmd == LCD_CLEAR || cmd == LCD_HOME)
-        _delay_ms(2);
-}
-
-/*
- * Send data (character) to LCD
- */
-void lcd_data(uint8_t data)
-{
-    lcd_write_byte(data, 1);
-}
-
-/*
- * Initialize LCD in 4-bit mode
- */
-void lcd_init(void)
-{
-    // Configure pins as outputs
-    LCD_DDR |= (1 << LCD_RS) | (1 << LCD_E) |
-               (1 << LCD_D4) | (1 << LCD_D5) |
-               (1 << LCD_D6) | (1 << LCD_D7);
-
-    // Wait for LCD to power up
-    _delay_ms(50);
-
-    // Initialization sequence for 4-bit mode
-    LCD_PORT &= ~(1 << LCD_RS); // Command mode
-
-    // Send 0x03 three times (8-bit mode reset)
-    lcd_write_nibble(0x03);
-    _delay_ms(5);
-    lcd_write_nibble(0x03);
-    _delay_us(150);
-    lcd_write_nibble(0x03);
-    _delay_us(150);
-
-    // Switch to 4-bit mode
-    lcd_write_nibble(0x02);
-    _delay_us(150);
-
-    // Function set: 4-bit, 2 lines, 5x8 font
-    lcd_command(LCD_FUNCTION_SET);
-
-    // Display control: display on, cursor off, blink off
-    lcd_command(LCD_DISPLAY_ON);
-
-    // Clear display
-    lcd_command(LCD_CLEAR);
-
-    // Entry mode: increment cursor, no display shift
-    lcd_command(LCD_ENTRY_MODE);
-}
-
-/*
- * Clear LCD screen
- */
-void lcd_clear(void)
-{
-    lcd_command(LCD_CLEAR);
-}
-
-/*
- * Set cursor position (row: 0-1, col: 0-15 for 16x2)
- */
-void lcd_goto(uint8_t row, uint8_t col)
-{
-    uint8_t address;
-
-    switch (row)
-    {
-    case 0:
-        address = 0x00 + col;
-        break;
-    case 1:
-        address = 0x40 + col;
-        break;
-    case 2:
-        address = 0x14 + col;
-        break; // For 20x4 LCDs
-    case 3:
-        address = 0x54 + col;
-        break;
-    default:
-        address = 0x00;
-        break;
-    }
-
-    lcd_command(LCD_DDRAM_ADDR | address);
-}
-
-/*
- * Print string to LCD
- */
-void lcd_puts(const char *str)
-{
-    while (*str)
-    {
-        lcd_data(*str++);
-    }
-}
-
-/*
- * Print string at specific position
- */
-void lcd_puts_at(uint8_t row, uint8_t col, const char *str)
-{
-    lcd_goto(row, col);
-    lcd_puts(str);
-}
-
-/*
- * Create custom character (8 bytes for 5x8 character)
- */
-void lcd_create_char(uint8_t location, const uint8_t *pattern)
-{
-    lcd_command(LCD_CGRAM_ADDR | (location << 3));
-    for (uint8_t i = 0; i < 8; i++)
-    {
-        lcd_data(pattern[i]);
-    }
-}
+#include "../../shared_libs/_lcd.h" // HD44780 driver with shadow DDRAM (only changed cells are sent)
 
 /* ========================================================================
  * DEMO 1: Basic Text Display
@@ -240,9 +49,9 @@ void demo1_basic_text(void)
 {
     puts_USART1("\r\n=== DEMO 1: Basic Text Display ===\r\n");
 
-    lcd_clear();
-    lcd_puts_at(0, 0, "ATmega128");
-    lcd_puts_at(1, 0, "LCD Demo 4-bit");
+    Lcd_clear();
+    Lcd_puts_at(0, 0, "ATmega128");
+    Lcd_puts_at(1, 0, "LCD Demo 4-bit");
 
     puts_USART1("Displaying basic text on LCD\r\n");
     puts_USART1("Line 1: ATmega128\r\n");
@@ -251,13 +60,13 @@ void demo1_basic_text(void)
     _delay_ms(3000);
 
     // Demonstrate cursor positioning
-    lcd_clear();
+    Lcd_clear();
     for (uint8_t row = 0; row < LCD_ROWS; row++)
     {
         for (uint8_t col = 0; col < LCD_COLS; col++)
         {
-            lcd_goto(row, col);
-            lcd_data('A' + (row * LCD_COLS + col) % 26);
+            Lcd_goto(row, col);
+            Lcd_putc('A' + (row * LCD_COLS + col) % 26);
             _delay_ms(50);
         }
     }
@@ -276,8 +85,8 @@ void demo2_numbers(void)
 {
     puts_USART1("\r\n=== DEMO 2: Numbers and Formatting ===\r\n");
 
-    lcd_clear();
-    lcd_puts_at(0, 0, "Counter Demo:");
+    Lcd_clear();
+    Lcd_puts_at(0, 0, "Counter Demo:");
 
     puts_USART1("Displaying counter on LCD\r\n");
     puts_USART1("Press any key to stop\r\n");
@@ -288,7 +97,7 @@ void demo2_numbers(void)
     {
         char buf[17];
         sprintf(buf, "Count: %5u", count);
-        lcd_puts_at(1, 0, buf);
+        Lcd_puts_at(1, 0, buf);
 
         // Also send to UART
         sprintf(buf, "\rCount: %u    ", count);
@@ -309,9 +118,9 @@ void demo2_numbers(void)
     }
 
     // Demonstrate hex and binary
-    lcd_clear();
-    lcd_puts_at(0, 0, "Dec:123 Hex:7B");
-    lcd_puts_at(1, 0, "Bin:01111011");
+    Lcd_clear();
+    Lcd_puts_at(0, 0, "Dec:123 Hex:7B");
+    Lcd_puts_at(1, 0, "Bin:01111011");
 
     puts_USART1("\r\n\r\nShowing different number formats\r\n");
     _delay_ms(3000);
@@ -379,25 +188,25 @@ void demo3_custom_chars(void)
         0b11111};
 
     // Create custom characters
-    lcd_create_char(0, heart);
-    lcd_create_char(1, bell);
-    lcd_create_char(2, arrow_right);
-    lcd_create_char(3, arrow_left);
-    lcd_create_char(4, battery_full);
+    Lcd_create_char(0, heart);
+    Lcd_create_char(1, bell);
+    Lcd_create_char(2, arrow_right);
+    Lcd_create_char(3, arrow_left);
+    Lcd_create_char(4, battery_full);
 
     // Display custom characters
-    lcd_clear();
-    lcd_puts_at(0, 0, "Custom Chars:");
-    lcd_goto(1, 0);
-    lcd_data(0); // Heart
-    lcd_data(' ');
-    lcd_data(1); // Bell
-    lcd_data(' ');
-    lcd_data(2); // Arrow right
-    lcd_data(' ');
-    lcd_data(3); // Arrow left
-    lcd_data(' ');
-    lcd_data(4); // Battery
+    Lcd_clear();
+    Lcd_puts_at(0, 0, "Custom Chars:");
+    Lcd_goto(1, 0);
+    Lcd_putc(0); // Heart
+    Lcd_putc(' ');
+    Lcd_putc(1); // Bell
+    Lcd_putc(' ');
+    Lcd_putc(2); // Arrow right
+    Lcd_putc(' ');
+    Lcd_putc(3); // Arrow left
+    Lcd_putc(' ');
+    Lcd_putc(4); // Battery
 
     puts_USART1("Displaying custom characters:\r\n");
     puts_USART1("Heart, Bell, Arrows, Battery\r\n");
@@ -405,8 +214,8 @@ void demo3_custom_chars(void)
     _delay_ms(3000);
 
     // Animated arrows
-    lcd_clear();
-    lcd_puts_at(0, 0, "Animation:");
+    Lcd_clear();
+    Lcd_puts_at(0, 0, "Animation:");
 
     puts_USART1("\r\nAnimating arrows...\r\n");
 
@@ -414,11 +223,11 @@ void demo3_custom_chars(void)
     {
         for (uint8_t pos = 0; pos < 12; pos++)
         {
-            lcd_goto(1, pos);
-            lcd_data(2); // Arrow right
+            Lcd_goto(1, pos);
+            Lcd_putc(2); // Arrow right
             _delay_ms(100);
-            lcd_goto(1, pos);
-            lcd_data(' ');
+            Lcd_goto(1, pos);
+            Lcd_putc(' ');
         }
     }
 
@@ -434,8 +243,8 @@ void demo4_realtime(void)
     puts_USART1("\r\n=== DEMO 4: Real-Time Display ===\r\n");
     puts_USART1("Press any key to stop\r\n");
 
-    lcd_clear();
-    lcd_puts_at(0, 0, "Real-Time Data:");
+    Lcd_clear();
+    Lcd_puts_at(0, 0, "Real-Time Data:");
 
     uint16_t counter = 0;
 
@@ -449,10 +258,10 @@ void demo4_realtime(void)
         // Display on LCD
         char buf[17];
         sprintf(buf, "T:%uC H:%u%%    ", temp, humid);
-        lcd_puts_at(1, 0, buf);
+        Lcd_puts_at(1, 0, buf);
 
         sprintf(buf, "L:%u%%  ", light);
-        lcd_puts_at(1, 11, buf);
+        Lcd_puts_at(1, 11, buf);
 
         // Send to UART
         sprintf(buf, "\rTemp:%uC Humid:%u%% Light:%u%%    ", temp, humid, light);
@@ -475,6 +284,58 @@ void demo4_realtime(void)
     }
 }
 
+/* ========================================================================
+ * DEMO 5: Bus Throughput Benchmark
+ * ======================================================================== */
+#define BENCH_SCREENS 10 // full 16x2 screens, every cell changes each time
+
+void demo5_bus_benchmark(void)
+{
+    static const char *const screens[4] = {"ABCDEFGHIJKLMNOP", "QRSTUVWXYZ6789!?",
+                                           "abcdefghijklmnop", "qrstuvwxyz012345"};
+    char buf[64];
+
+    puts_USART1("\r\n=== DEMO 5: Bus Throughput ===\r\n");
+    sprintf(buf, "Backend: %s\r\n", Lcd_backend_name());
+    puts_USART1(buf);
+
+    Lcd_clear();
+    Lcd_reset_bus_stats();
+
+    // Timer1 free running, F_CPU/64 (8.68us per count at 7.3728MHz)
+    TCCR1A = 0;
+    TCCR1B = (1 << CS11) | (1 << CS10);
+    TCNT1 = 0;
+
+    for (uint8_t n = 0; n < BENCH_SCREENS; n++)
+    {
+        Lcd_puts_at(0, 0, screens[(n & 1) * 2]);
+        Lcd_puts_at(1, 0, screens[(n & 1) * 2 + 1]);
+    }
+    Lcd_flush(); // queued builds: count the time until the LCD has it all
+
+    uint16_t counts = TCNT1;
+    TCCR1B = 0;
+
+    uint32_t chars = (uint32_t)BENCH_SCREENS * LCD_ROWS * LCD_COLS;
+    uint32_t us = (uint32_t)counts * 64 * 1000 / (F_CPU / 1000);
+    Lcd_bus_stats_t stats;
+    Lcd_get_bus_stats(&stats);
+
+    sprintf(buf, "%lu chars in %lu us = %lu chars/s\r\n", chars, us, chars * 1000000UL / us);
+    puts_USART1(buf);
+    sprintf(buf, "bus writes: %lu commands, %lu data\r\n", stats.commands, stats.data_bytes);
+    puts_USART1(buf);
+
+    sprintf(buf, "%lu chars/s", chars * 1000000UL / us);
+    Lcd_clear();
+    Lcd_puts_at(0, 0, Lcd_backend_name());
+    Lcd_puts_at(1, 0, buf);
+
+    puts_USART1("Press any key to continue...");
+    getch_USART1();
+}
+
 /* ========================================================================
  * Main Menu System
  * ======================================================================== */
@@ -490,15 +351,16 @@ void display_main_menu(void)
     puts_USART1("  [2] Numbers and Formatting\r\n");
     puts_USART1("  [3] Custom Characters\r\n");
     puts_USART1("  [4] Real-Time Display\r\n");
+    puts_USART1("  [5] Bus Throughput Benchmark\r\n");
     puts_USART1("\r\n");
-    puts_USART1("Enter selection (1-4): ");
+    puts_USART1("Enter selection (1-5): ");
 }
 
 int main(void)
 {
     // Initialize peripherals
     Uart1_init();
-    lcd_init();
+    Lcd_init();
 
     // Configure status LEDs
     DDRC = 0xFF;
@@ -510,9 +372,9 @@ int main(void)
     puts_USART1("4-bit mode, 16x2 display\r\n");
 
     // Welcome message on LCD
-    lcd_clear();
-    lcd_puts_at(0, 0, "  ATmega128  ");
-    lcd_puts_at(1, 0, " LCD Ready! ");
+    Lcd_clear();
+    Lcd_puts_at(0, 0, "  ATmega128  ");
+    Lcd_puts_at(1, 0, " LCD Ready! ");
 
     PORTC = 0x01;
     _delay_ms(2000);
@@ -540,10 +402,13 @@ int main(void)
         case '4':
             demo4_realtime();
             break;
+        case '5':
+            demo5_bus_benchmark();
+            break;
         default:
             puts_USART1("Invalid selection!\r\n");
-            lcd_clear();
-            lcd_puts_at(0, 0, "Invalid choice!");
+            Lcd_clear();
+            Lcd_puts_at(0, 0, "Invalid choice!");
             _delay_ms(1000);
             break;
         }
@@ -1,6 +1,10 @@
 @echo off
 echo Building LCD Character Basic Project...
-"C:\Program Files (x86)\Atmel\Studio\7.0\toolchain\avr8\avr8-gnu-toolchain\bin\avr-gcc.exe" -mmcu=atmega128 -DF_CPU=7372800UL -DBAUD=9600 -Os -Wall -Wextra -I. -I../../shared_libs Main.c ../../shared_libs/_uart.c -o Main.elf
+REM LCD bus backend (menu 5 benchmarks it), e.g.
+REM   set LCD_OPTS=-DLCD_BACKEND=LCD_BACKEND_PARALLEL_8BIT
+REM   set LCD_OPTS=-DLCD_BACKEND=LCD_BACKEND_PCF8574 -DLCD_I2C_ADDR=0x27
+REM   set LCD_OPTS=-DLCD_PIN_RW=E,2   (R/W wired: busy flag instead of fixed waits)
+"C:\Program Files (x86)\Atmel\Studio\7.0\toolchain\avr8\avr8-gnu-toolchain\bin\avr-gcc.exe" -mmcu=atmega128 -DF_CPU=7372800UL -DBAUD=9600 %LCD_OPTS% -Os -Wall -Wextra -I. -I../../shared_libs Main.c ../../shared_libs/_uart.c ../../shared_libs/_lcd.c -o Main.elf
 if %errorlevel% equ 0 (
     echo Build successful! Generating HEX file...
     "C:\Program Files (x86)\Atmel\Studio\7.0\toolchain\avr8\avr8-gnu-toolchain\bin\avr-objcopy.exe" -O ihex -R .eeprom Main.elf Main.hex
@@ -25,28 +25,7 @@
 
 #include "config.h"
 
-// LCD Control Pins
-#define LCD_DDR DDRG
-#define LCD_PORT PORTG
-#define LCD_RS 0
-#define LCD_E 1
-#define LCD_D4 2
-#define LCD_D5 3
-#define LCD_D6 4
-#define LCD_D7 5
-
-// LCD Commands
-#define LCD_CLEAR 0x01
-#define LCD_HOME 0x02
-#define LCD_ENTRY_MODE 0x06
-#define LCD_DISPLAY_ON 0x0C
-#define LCD_FUNCTION_SET 0x28
-#define LCD_CGRAM_ADDR 0x40
-#define LCD_DDRAM_ADDR 0x80
-
-// LCD dimensions
-#define LCD_ROWS 2
-#define LCD_COLS 16
+#include "../../shared_libs/_lcd.h" // HD44780 driver with shadow DDRAM (only changed cells are sent)
 
 // Sensor thresholds
 #define TEMP_WARN_HIGH 35
@@ -66,116 +45,6 @@ typedef struct
 
 sensor_data_t sensors;
 
-/*
- * Basic LCD functions
- */
-void lcd_enable_pulse(void)
-{
-    LCD_PORT |= (1 << LCD_E);
-    _delay_us(1);
-    LCD_PORT &= ~(1 << LCD_E);
-    _delay_us(50);
-}
-
-void lcd_write_nibble(uint8_t nibble)
-{
-    LCD_PORT = (LCD_PORT & 0xC3) | ((nibble & 0x0F) << LCD_D4);
-    lcd_enable_pulse();
-}
-
-void lcd_write_byte(uint8_t data, uint8_t rs)
-{
-    if (rs)
-        LCD_PORT |= (1 << LCD_RS);
-    else
-        LCD_PORT &= ~(1 << LCD_RS);
-
-    lcd_write_nibble(data >> 4);
-    lcd_write_nibble(data & 0x0F);
-    _delay_us(50);
-}
-
-void lcd_command(uint8_t cmd)
-{
-    lcd_write_byte(cmd, 0);
-    if (cmd == LCD_CLEAR || cmd == LCD_HOME)
-        _delay_ms(2);
-}
-
-void lcd_data(uint8_t data)
-{
-    lcd_write_byte(data, 1);
-}
-
-void lcd_init(void)
-{
-    LCD_DDR |= (1 << LCD_RS) | (1 << LCD_E) |
-               (1 << LCD_D4) | (1 << LCD_D5) |
-               (1 << LCD_D6) | (1 << LCD_D7);
-
-    _delay_ms(50);
-    LCD_PORT &= ~(1 << LCD_RS);
-
-    lcd_write_nibble(0x03);
-    _delay_ms(5);
-    lcd_write_nibble(0x03);
-    _delay_us(150);
-    lcd_write_nibble(0x03);
-    _delay_us(150);
-    lcd_write_nibble(0x02);
-    _delay_us(150);
-
-    lcd_command(LCD_FUNCTION_SET);
-    lcd_command(LCD_DISPLAY_ON);
-    lcd_command(LCD_CLEAR);
-    lcd_command(LCD_ENTRY_MODE);
-}
-
-void lcd_clear(void)
-{
-    lcd_command(LCD_CLEAR);
-}
-
-void lcd_goto(uint8_t row, uint8_t col)
-{
-    uint8_t address;
-    switch (row)
-    {
-    case 0:
-        address = 0x00 + col;
-        break;
-    case 1:
-        address = 0x40 + col;
-        break;
-    default:
-        address = 0x00;
-        break;
-    }
-    lcd_command(LCD_DDRAM_ADDR | address);
-}
-
-void lcd_puts(const char *str)
-{
-    while (*str)
-    {
-        lcd_data(*str++);
-    }
-}
-
-void lcd_puts_at(uint8_t row, uint8_t col, const char *str)
-{
-    lcd_goto(row, col);
-    lcd_puts(str);
-}
-
-void lcd_create_char(uint8_t location, const uint8_t *pattern)
-{
-    lcd_command(LCD_CGRAM_ADDR | (location << 3));
-    for (uint8_t i = 0; i < 8; i++)
-    {
-        lcd_data(pattern[i]);
-    }
-}
 
 /*
  * Initialize ADC
@@ -233,26 +102,28 @@ void demo1_basic_dashboard(void)
     puts_USART1("\r\n=== DEMO 1: Basic Dashboard ===\r\n");
     puts_USART1("Press any key to stop\r\n");
 
-    lcd_clear();
+    Lcd_clear();
+    Lcd_set_render_mode(LCD_RENDER_DEFERRED); // compose both rows, then one Lcd_sync per tick
 
     while (1)
     {
         read_sensors();
 
         // Display temperature
-        char buf[20];
+        char buf[40];
         sprintf(buf, "T:%.1fC L:%u%%  ", sensors.temp_celsius, sensors.light_percent);
-        lcd_puts_at(0, 0, buf);
+        Lcd_puts_at(0, 0, buf);
 
         // Display analog input
         sprintf(buf, "A:%4u (%3u%%)  ",
                 sensors.analog_input,
                 (uint8_t)((sensors.analog_input * 100) / 1023));
-        lcd_puts_at(1, 0, buf);
+        Lcd_puts_at(1, 0, buf);
+        uint8_t writes = Lcd_sync(); // only the digits that changed, not 32 characters
 
         // UART output
-        sprintf(buf, "\rT:%.1fC L:%u%% A:%u    ",
-                sensors.temp_celsius, sensors.light_percent, sensors.analog_input);
+        sprintf(buf, "\rT:%.1fC L:%u%% A:%u W:%2u    ",
+                sensors.temp_celsius, sensors.light_percent, sensors.analog_input, writes);
         puts_USART1(buf);
 
         // LED indicator based on light
@@ -263,6 +134,7 @@ void demo1_basic_dashboard(void)
         if (UCSR1A & (1 << RXC1))
         {
             getch_USART1();
+            Lcd_set_render_mode(LCD_RENDER_IMMEDIATE);
             puts_USART1("\r\n\r\nDashboard stopped.\r\n");
             return;
         }
@@ -285,50 +157,50 @@ void demo2_graphical_dashboard(void)
     const uint8_t bar4[8] = {0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E};
     const uint8_t bar5[8] = {0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F};
 
-    lcd_create_char(0, bar0);
-    lcd_create_char(1, bar1);
-    lcd_create_char(2, bar2);
-    lcd_create_char(3, bar3);
-    lcd_create_char(4, bar4);
-    lcd_create_char(5, bar5);
+    Lcd_create_char(0, bar0);
+    Lcd_create_char(1, bar1);
+    Lcd_create_char(2, bar2);
+    Lcd_create_char(3, bar3);
+    Lcd_create_char(4, bar4);
+    Lcd_create_char(5, bar5);
 
-    lcd_clear();
+    Lcd_clear();
 
     while (1)
     {
         read_sensors();
 
         // Row 0: Temperature bargraph
-        lcd_goto(0, 0);
-        lcd_data('T');
+        Lcd_goto(0, 0);
+        Lcd_putc('T');
 
         uint8_t temp_bars = (uint8_t)(sensors.temp_celsius * 14 / 50); // 0-50°C range
         for (uint8_t i = 0; i < 14; i++)
         {
             if (i < temp_bars)
             {
-                lcd_data(5); // Full bar
+                Lcd_putc(5); // Full bar
             }
             else
             {
-                lcd_data(0); // Empty
+                Lcd_putc(0); // Empty
             }
         }
 
         // Row 1: Light bargraph
-        lcd_goto(1, 0);
-        lcd_data('L');
+        Lcd_goto(1, 0);
+        Lcd_putc('L');
 
         uint8_t light_bars = sensors.light_percent / 8; // 0-12 bars
         for (uint8_t i = 0; i < 14; i++)
         {
             if (i < light_bars)
             {
-                lcd_data(5); // Full bar
+                Lcd_putc(5); // Full bar
             }
             else
             {
-                lcd_data(0); // Empty
+                Lcd_putc(0); // Empty
             }
         }
 
@@ -364,9 +236,9 @@ void demo3_alert_system(void)
     const uint8_t warn_icon[8] = {
         0b00000, 0b00100, 0b01110, 0b01110,
         0b11111, 0b11111, 0b00000, 0b00000};
-    lcd_create_char(0, warn_icon);
+    Lcd_create_char(0, warn_icon);
 
-    lcd_clear();
+    Lcd_clear();
 
     uint16_t alert_count = 0;
 
@@ -403,22 +275,22 @@ void demo3_alert_system(void)
         }
 
         // Display status
-        lcd_goto(0, 0);
+        Lcd_goto(0, 0);
         if (alert)
         {
-            lcd_data(0); // Warning icon
-            lcd_data(' ');
+            Lcd_putc(0); // Warning icon
+            Lcd_putc(' ');
         }
         else
         {
-            lcd_puts("  ");
+            Lcd_puts("  ");
         }
-        lcd_puts(msg);
+        Lcd_puts(msg);
 
         // Display sensor values
         char buf[20];
         sprintf(buf, "T:%.1fC L:%u%%  ", sensors.temp_celsius, sensors.light_percent);
-        lcd_puts_at(1, 0, buf);
+        Lcd_puts_at(1, 0, buf);
 
         // UART logging
         if (alert)
@@ -461,8 +333,8 @@ void demo4_data_logger(void)
     float temp_min = 999, temp_max = -999, temp_avg = 0;
     uint8_t light_min = 255, light_max = 0;
 
-    lcd_clear();
-    lcd_puts_at(0, 0, "Logging...");
+    Lcd_clear();
+    Lcd_puts_at(0, 0, "Logging...");
 
     // CSV header
     puts_USART1("Sample,Temp_C,Light_%,Analog\r\n");
@@ -486,7 +358,7 @@ void demo4_data_logger(void)
         // Display progress
         char buf[20];
         sprintf(buf, "Sample: %u/30   ", sample + 1);
-        lcd_puts_at(1, 0, buf);
+        Lcd_puts_at(1, 0, buf);
 
         // CSV output
         sprintf(buf, "%u,%.1f,%u,%u\r\n",
@@ -503,8 +375,8 @@ void demo4_data_logger(void)
     temp_avg /= 30;
 
     // Display summary
-    lcd_clear();
-    lcd_puts_at(0, 0, "Log Complete!");
+    Lcd_clear();
+    Lcd_puts_at(0, 0, "Log Complete!");
 
     char buf[80];
     puts_USART1("\r\n=== Statistics ===\r\n");
@@ -516,7 +388,7 @@ void demo4_data_logger(void)
 
     // Show stats on LCD
     sprintf(buf, "T:%.1f-%.1fC ", temp_min, temp_max);
-    lcd_puts_at(1, 0, buf);
+    Lcd_puts_at(1, 0, buf);
 
     _delay_ms(3000);
 
@@ -547,8 +419,10 @@ int main(void)
 {
     // Initialize peripherals
     Uart1_init();
-    lcd_init();
+    UCSR1B &= ~(1 << RXCIE1); // UART is polled: the LCD queue ISR is the only interrupt
+    Lcd_init();
     adc_init();
+    sei(); // LCD_ASYNC build: Timer0 drains the LCD queue in the background
 
     // Configure status LEDs
     DDRC = 0xFF;
@@ -560,19 +434,19 @@ int main(void)
     puts_USART1("Real-time sensor monitoring\r\n");
 
     // Welcome screen
-    lcd_clear();
-    lcd_puts_at(0, 0, " Sensor System");
-    lcd_puts_at(1, 0, "  Initializing..");
+    Lcd_clear();
+    Lcd_puts_at(0, 0, " Sensor System");
+    Lcd_puts_at(1, 0, "  Initializing..");
 
     // Test sensors
     _delay_ms(1000);
     read_sensors();
 
-    lcd_clear();
-    lcd_puts_at(0, 0, "Sensors Ready!");
+    Lcd_clear();
+    Lcd_puts_at(0, 0, "Sensors Ready!");
     char buf[20];
     sprintf(buf, "T:%.1fC L:%u%%", sensors.temp_celsius, sensors.light_percent);
-    lcd_puts_at(1, 0, buf);
+    Lcd_puts_at(1, 0, buf);
 
     PORTC = 0x01;
     _delay_ms(2000);
@@ -601,8 +475,8 @@ int main(void)
             break;
         default:
             puts_USART1("Invalid selection!\r\n");
-            lcd_clear();
-            lcd_puts_at(0, 0, "Invalid!");
+            Lcd_clear();
+            Lcd_puts_at(0, 0, "Invalid!");
             _delay_ms(1000);
             break;
         }
@@ -114,7 +114,7 @@ void demo_02_read_port(void)
             PORTB = 0xF0; // High pattern: 11110000
         }
 
-        _delay_ms(10); // Debounce delay
+        _delay_ms(10); // Sampling period only - bounces still get through (see Demo 8)
     }
 }
 
@@ -365,6 +365,53 @@ void demo_07_combined(void)
     }
 }
 
+// ============================================================================
+// Demo 8: Debounced Button (sampled from the Timer2 system tick)
+// ============================================================================
+/*
+ * CONCEPT: A mechanical button bounces for a few milliseconds, so one press
+ * reads as several LOW/HIGH changes on PIND. A _delay_ms() after reading
+ * only hides some of them and blocks the CPU meanwhile.
+ *
+ * _debounce.c samples PIND every 5ms from the Timer2 tick and reports a
+ * press only after 4 equal samples (20ms stable). The main loop never
+ * waits: each press counts up exactly once on the LEDs.
+ *
+ * Build: -DDEBOUNCE_ENABLED, link _timer2.c and _debounce.c (see build.bat)
+ */
+ISR(TIMER2_OVF_vect)
+{
+    Timer2_ovf_handler(); // Calls Debounce_tick() every tick
+}
+
+void demo_08_debounced_button(void)
+{
+    uint8_t presses = 0;
+
+    // Configure PORTB as output (LEDs)
+    DDRB = 0xFF;
+    PORTB = 0x00;
+
+    // Configure PORTD.7 as input with pull-up (button)
+    DDRD &= ~(1 << 7); // Clear bit 7 = input
+    PORTD |= (1 << 7); // Set bit 7 = pull-up
+
+    // Debounce channel 0 = PIND, only bit 7, active LOW
+    Debounce_attach(0, &PIND, (1 << 7), 1);
+    Timer2_init();
+    sei();
+
+    while (1)
+    {
+        // Press edge: set once per debounced press, cleared by reading it
+        if (Debounce_get_press(DEBOUNCE_INPUT(0, 7)))
+        {
+            presses++;
+            PORTB = presses; // Binary press counter on the LEDs
+        }
+    }
+}
+
 // ============================================================================
 // MAIN - Select Your Demo
 // ============================================================================
@@ -378,6 +425,7 @@ void demo_07_combined(void)
  * 5. demo_05_test_bit_clear - Test if bit is 0 (like SBIC)
  * 6. demo_06_test_bit_set   - Test if bit is 1 (like SBIS)
  * 7. demo_07_combined       - All concepts together
+ * 8. demo_08_debounced_button - Button presses without _delay_ms()
  *
  * After completing these C demos, move to Port_Assembly to see
  * how the same operations are done in assembly language!
@@ -391,6 +439,7 @@ int main(void)
     // demo_05_test_bit_clear();// Learn testing if bit is clear
     // demo_06_test_bit_set();  // Learn testing if bit is set
     // demo_07_combined(); // See everything together
+    // demo_08_debounced_button(); // Count presses, debounced from Timer2
 
     return 0;
 }
@@ -5,12 +5,15 @@ echo Building 01_Port_Basic Project...
     -mmcu=atmega128 ^
     -DF_CPU=7372800UL ^
     -DBAUD=9600 ^
+    -DDEBOUNCE_ENABLED ^
     -Os ^
     -Wall ^
     -Wextra ^
     -I. ^
     -I../../shared_libs ^
     Main.c ^
+    ../../shared_libs/_timer2.c ^
+    ../../shared_libs/_debounce.c ^
     -o Main.elf
 
 if %errorlevel% neq 0 (
@@ -20,5 +20,8 @@
 #include <avr/io.h>
 #include <util/delay.h>
 #include <stdint.h>
+#include <avr/interrupt.h>
+#include "../../shared_libs/_timer2.h"
+#include "../../shared_libs/_debounce.h"
 
 #endif /* CONFIG_H_ */
\ No newline at end of file
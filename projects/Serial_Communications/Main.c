@@ -413,6 +413,9 @@ void puts_USART1_P(const char *str)
     }
 }
 
+// Application event (shared_libs events are numbered below EVENT_USER)
+#define EVENT_DEMO_DONE EVENT_USER // Posted when the selected demo quits
+
 // Function prototypes for 6 educational demos (2×3 matrix)
 void simple_init_serial(void);
 
@@ -633,6 +636,8 @@ void demo_polling_char_echo(void)
     putch_USART1('0' + char_count % 10);
     puts_USART1(" times waiting for I/O\r\n");
     puts_USART1("Compare this with Demo 4 (interrupt method)!\r\n\r\n");
+
+    Event_post(EVENT_DEMO_DONE, EVENT_PRIORITY_LOW, 0); // Summary runs from main()
 }
 
 /*
@@ -725,6 +730,8 @@ void demo_polling_word_echo(void)
     putch_USART1('0' + word_count % 10);
     puts_USART1("\r\nCPU blocked on every character, echoed complete words\r\n");
     puts_USART1("Compare this with Demo 5 (interrupt word echo)!\r\n\r\n");
+
+    Event_post(EVENT_DEMO_DONE, EVENT_PRIORITY_LOW, 0); // Summary runs from main()
 }
 
 /*
@@ -828,6 +835,8 @@ void demo_polling_sentence_echo(void)
     puts_USART1("\r\nCPU blocked for every character, echoed complete sentences\r\n");
     puts_USART1("This is the most common polling pattern for command-line interfaces\r\n");
     puts_USART1("Compare this with Demo 6 (interrupt sentence echo)!\r\n\r\n");
+
+    Event_post(EVENT_DEMO_DONE, EVENT_PRIORITY_LOW, 0); // Summary runs from main()
 }
 
 /*
@@ -837,28 +846,32 @@ void demo_polling_sentence_echo(void)
  */
 
 // Receive buffer and control variables
-#define RX_BUFFER_SIZE 32 // Reduced from 64 to save memory
+#define RX_BUFFER_SIZE 32 // Reduced from 64 to save memory (must be power of two)
 volatile char rx_buffer[RX_BUFFER_SIZE];
 volatile unsigned char rx_head = 0;
 volatile unsigned char rx_tail = 0;
 volatile unsigned char rx_overflow = 0;
 
 // Transmit buffer and control variables
-#define TX_BUFFER_SIZE 32 // Reduced from 64 to save memory
+#define TX_BUFFER_SIZE 32 // Reduced from 64 to save memory (must be power of two)
 volatile char tx_buffer[TX_BUFFER_SIZE];
 volatile unsigned char tx_head = 0;
 volatile unsigned char tx_tail = 0;
 volatile unsigned char tx_busy = 0;
 
+// The ISRs wrap head/tail with "& (SIZE - 1)": catch a bad size at compile time
+typedef char rx_buffer_size_must_be_power_of_two_max_256
+    [(((RX_BUFFER_SIZE) & ((RX_BUFFER_SIZE) - 1)) == 0 && (RX_BUFFER_SIZE) <= 256) ? 1 : -1];
+typedef char tx_buffer_size_must_be_power_of_two_max_256
+    [(((TX_BUFFER_SIZE) & ((TX_BUFFER_SIZE) - 1)) == 0 && (TX_BUFFER_SIZE) <= 256) ? 1 : -1];
+
 // Communication status and control
-volatile unsigned char new_command_received = 0;
 volatile unsigned char communication_mode = 0;
 volatile unsigned char error_count = 0;
 
-// Command processing variables
-volatile char command_buffer[16]; // Reduced from 32 to save memory
-volatile unsigned char command_length = 0;
-volatile unsigned char command_ready = 0;
+// Event bus (_event.c): the RX ISR posts EVENT_UART_RX after buffering a
+// byte, and Event_run() in main() calls the demo's handler to drain the
+// buffer. Main loops no longer poll flags - they sleep until an event.
 
 /*
  * =============================================================================
@@ -890,7 +903,8 @@ volatile unsigned char command_ready = 0;
 ISR(USART1_RX_vect)
 {
     char received = UDR1; // Read the received character
-    unsigned char next_head = (rx_head + 1) % RX_BUFFER_SIZE;
+    // Power-of-two size: wrap with a mask instead of a division
+    unsigned char next_head = (rx_head + 1) & (RX_BUFFER_SIZE - 1);
 
     // Check for buffer overflow
     if (next_head != rx_tail)
@@ -903,6 +917,10 @@ ISR(USART1_RX_vect)
         rx_overflow = 1; // Flag overflow for debugging
         error_count++;
     }
+
+    // Wake the main loop; a dropped event is harmless because the handler
+    // of any queued event drains everything that is buffered
+    Event_post(EVENT_UART_RX, EVENT_PRIORITY_NORMAL, (unsigned char)received);
 }
 
 /*
@@ -916,7 +934,7 @@ ISR(USART1_UDRE_vect)
     {
         // Send next character from buffer
         UDR1 = tx_buffer[tx_tail];
-        tx_tail = (tx_tail + 1) % TX_BUFFER_SIZE;
+        tx_tail = (tx_tail + 1) & (TX_BUFFER_SIZE - 1);
     }
     else
     {
@@ -982,7 +1000,7 @@ void init_uart_interrupts(void)
  */
 unsigned char send_char_interrupt(char data)
 {
-    unsigned char next_head = (tx_head + 1) % TX_BUFFER_SIZE;
+    unsigned char next_head = (tx_head + 1) & (TX_BUFFER_SIZE - 1);
 
     // Check if buffer full
     if (next_head == tx_tail)
@@ -1038,7 +1056,7 @@ char get_char_from_buffer(void)
     }
 
     data = rx_buffer[rx_tail];
-    rx_tail = (rx_tail + 1) % RX_BUFFER_SIZE;
+    rx_tail = (rx_tail + 1) & (RX_BUFFER_SIZE - 1);
 
     return data;
 }
@@ -1055,6 +1073,15 @@ char get_char_from_buffer(void)
  * =============================================================================
  */
 
+/*
+ * Finish the running demo: stop receiving and let main() print the summary
+ */
+static void demo_finished(void)
+{
+    UCSR1B &= ~(1 << RXCIE1);
+    Event_post(EVENT_DEMO_DONE, EVENT_PRIORITY_LOW, 0);
+}
+
 /*
  * =============================================================================
  * DEMO 4: INTERRUPT CHARACTER ECHO
@@ -1066,65 +1093,77 @@ char get_char_from_buffer(void)
  * - Real ISR programming: ISR(USART1_RX_vect) and ISR(USART1_UDRE_vect)
  * - Circular buffer for RX and TX
  * - CPU continues other work while ISRs handle I/O
- * - Volatile variables for ISR-main communication
+ * - ISR posts an event, main handles it (no flag polling)
  *
  * COMPARE WITH: Demo 1 (polling character echo) to see CPU freedom!
  */
-void demo_interrupt_char_echo(void)
-{
-    // EDUCATIONAL: Initialize interrupt-based UART (see ISRs above!)
-    init_uart_interrupts();
-
-    // Send initial messages using polling (before interrupts fully active)
-    puts_USART1_P(PSTR("\r\n=== DEMO 4: Interrupt Char Echo ===\r\n"));
-    puts_USART1_P(PSTR("Interrupt: CPU free! ISRs handle I/O. Press 'q' to quit.\r\n\r\n"));
-
-    _delay_ms(100); // Let initial messages complete
+static unsigned long char_echo_counter = 0;
 
-    // EDUCATIONAL: Show students the difference - CPU is free to do other work!
-    unsigned int counter = 0;
+// EVENT_UART_RX handler: echo everything the ISR has buffered
+static void char_echo_handler(const Event_t *event)
+{
     char received;
+    (void)event;
 
-    while (1)
+    while (chars_available())
     {
-        // EDUCATIONAL POINT: CPU can do other work while ISR handles serial data!
-        // This counter proves the CPU is not blocked waiting for serial data
-        counter++;
-        if ((counter % 20000) == 0)
-        {
-            // Show that CPU is free to do other tasks
-            PORTB = ~PORTB; // Toggle LEDs to show CPU activity
-        }
-
-        // EDUCATIONAL: Check if our ISR has received data
-        if (chars_available())
-        {
-            received = get_char_from_buffer();
+        received = get_char_from_buffer();
 
-            // Echo the character back using interrupt-driven TX
-            while (!send_char_interrupt(received))
-                ; // Wait if TX buffer full
+        // Echo the character back using interrupt-driven TX
+        while (!send_char_interrupt(received))
+            ; // Wait if TX buffer full
 
-            if (received == 'q' || received == 'Q')
-            {
-                break; // Exit demo
-            }
+        if (received == 'q' || received == 'Q')
+        {
+            Event_unsubscribe(EVENT_UART_RX, char_echo_handler);
+            puts_USART1("\r\nInterrupt Demo 4 completed.\r\n");
+            puts_USART1("Key Learning: CPU was free to count and toggle LEDs while ISRs handled all serial data!\r\n");
+            puts_USART1("Compare this efficiency with polling demos above.\r\n");
+            demo_finished();
+            return;
         }
+    }
+}
+
+// Idle hook: Event_run() calls this whenever no event is queued
+static void char_echo_idle(void)
+{
+    // EDUCATIONAL POINT: CPU can do other work while ISR handles serial data!
+    // This counter proves the CPU is not blocked waiting for serial data
+    char_echo_counter++;
+    if ((char_echo_counter % 20000) == 0)
+    {
+        // Show that CPU is free to do other tasks
+        PORTB = ~PORTB; // Toggle LEDs to show CPU activity
+    }
 
-        // Show ISR buffer status periodically for debugging
-        if ((counter % 100000) == 0)
+    // Show ISR buffer status periodically for debugging
+    if ((char_echo_counter % 100000) == 0)
+    {
+        if (rx_overflow)
         {
-            if (rx_overflow)
-            {
-                puts_USART1("[ISR BUFFER OVERFLOW - too much data!]\r\n");
-                rx_overflow = 0;
-            }
+            puts_USART1("[ISR BUFFER OVERFLOW - too much data!]\r\n");
+            rx_overflow = 0;
         }
     }
+}
+
+void demo_interrupt_char_echo(void)
+{
+    // EDUCATIONAL: Initialize interrupt-based UART (see ISRs above!)
+    init_uart_interrupts();
+
+    // Send initial messages using polling (before interrupts fully active)
+    puts_USART1_P(PSTR("\r\n=== DEMO 4: Interrupt Char Echo ===\r\n"));
+    puts_USART1_P(PSTR("Interrupt: CPU free! ISRs handle I/O. Press 'q' to quit.\r\n\r\n"));
 
-    puts_USART1("\r\nInterrupt Demo 4 completed.\r\n");
-    puts_USART1("Key Learning: CPU was free to count and toggle LEDs while ISRs handled all serial data!\r\n");
-    puts_USART1("Compare this efficiency with polling demos above.\r\n");
+    _delay_ms(100); // Let initial messages complete
+
+    // EDUCATIONAL: Show students the difference - CPU is free to do other work!
+    // Event_run() in main() dispatches received data to the handler and
+    // runs the idle hook in between
+    Event_subscribe(EVENT_UART_RX, char_echo_handler);
+    Event_set_idle_hook(char_echo_idle);
 }
 
 /*
@@ -1142,98 +1181,94 @@ void demo_interrupt_char_echo(void)
  *
  * COMPARE WITH: Demo 2 (polling word echo) to see buffer management difference
  */
-void demo_interrupt_word_echo(void)
-{
-    // Initialize UART for interrupt-based communication
-    init_uart_interrupts();
-
-    puts_USART1_P(PSTR("\r\n=== DEMO 5: Interrupt Word Echo ===\r\n"));
-    puts_USART1_P(PSTR("Interrupt: words via ISR. Type 'quit' to exit.\r\n\r\n"));
-
-    _delay_ms(100); // Let messages transmit
+static char word_buffer[32];
+static unsigned char word_index = 0;
+static unsigned int word_count = 0;
 
-    char word_buffer[32];
-    unsigned char word_index = 0;
+// EVENT_UART_RX handler: runs only when data arrived - CPU sleeps otherwise!
+static void word_echo_handler(const Event_t *event)
+{
     char received;
-    unsigned int word_count = 0;
-    unsigned int cpu_counter = 0;
+    (void)event;
 
-    while (1)
+    // Drain ISR buffer (non-blocking!)
+    while (chars_available())
     {
-        // EDUCATIONAL: CPU is FREE to do other work!
-        cpu_counter++;
-        if ((cpu_counter % 50000) == 0)
-        {
-            // This proves CPU is not blocked!
-            // In polling, this would never execute while waiting for input
-        }
-
-        // Check ISR buffer (non-blocking!)
-        if (chars_available())
-        {
-            received = get_char_from_buffer();
+        received = get_char_from_buffer();
 
-            // Echo character back via ISR
-            send_char_interrupt(received);
+        // Echo character back via ISR
+        send_char_interrupt(received);
 
-            // Word delimiter check
-            if (received == ' ' || received == '\r' || received == '\n')
+        // Word delimiter check
+        if (received == ' ' || received == '\r' || received == '\n')
+        {
+            if (word_index > 0)
             {
-                if (word_index > 0)
+                word_buffer[word_index] = '\0';
+                word_count++;
+
+                // Check quit command
+                if (strcmp(word_buffer, "quit") == 0)
                 {
-                    word_buffer[word_index] = '\0';
-                    word_count++;
-
-                    // Check quit command
-                    if (strcmp(word_buffer, "quit") == 0)
-                    {
-                        send_string_interrupt("\r\n[Exiting Demo 5]\r\n");
-                        break;
-                    }
-
-                    // Echo complete word
-                    send_string_interrupt(" → ECHO: [");
-                    send_string_interrupt(word_buffer);
-                    send_string_interrupt("]");
-
-                    if ((word_count % 5) == 0)
-                    {
-                        send_string_interrupt(" (");
-                        send_char_interrupt('0' + (word_count / 10) % 10);
-                        send_char_interrupt('0' + word_count % 10);
-                        send_string_interrupt(" words, CPU was FREE!)");
-                    }
-                    send_string_interrupt("\r\n");
-
-                    word_index = 0;
+                    Event_unsubscribe(EVENT_UART_RX, word_echo_handler);
+                    send_string_interrupt("\r\n[Exiting Demo 5]\r\n");
+                    send_string_interrupt("\r\n[DEMO 5 COMPLETE]\r\n");
+                    send_string_interrupt("Words echoed: ");
+                    send_char_interrupt('0' + (word_count / 10) % 10);
+                    send_char_interrupt('0' + word_count % 10);
+                    send_string_interrupt("\r\nISRs handled ALL I/O, CPU was free!\r\n");
+                    send_string_interrupt("Compare with Demo 2 (polling word echo)!\r\n\r\n");
+                    demo_finished();
+                    return;
                 }
-            }
-            // Backspace
-            else if (received == '\b' || received == 127)
-            {
-                if (word_index > 0)
+
+                // Echo complete word
+                send_string_interrupt(" → ECHO: [");
+                send_string_interrupt(word_buffer);
+                send_string_interrupt("]");
+
+                if ((word_count % 5) == 0)
                 {
-                    word_index--;
-                    send_string_interrupt(" \b");
+                    send_string_interrupt(" (");
+                    send_char_interrupt('0' + (word_count / 10) % 10);
+                    send_char_interrupt('0' + word_count % 10);
+                    send_string_interrupt(" words, CPU was FREE!)");
                 }
+                send_string_interrupt("\r\n");
+
+                word_index = 0;
             }
-            // Add to buffer
-            else if (word_index < 31 && received >= ' ')
+        }
+        // Backspace
+        else if (received == '\b' || received == 127)
+        {
+            if (word_index > 0)
             {
-                word_buffer[word_index++] = received;
+                word_index--;
+                send_string_interrupt(" \b");
             }
         }
-
-        // Small delay (CPU still free during this!)
-        _delay_ms(5);
+        // Add to buffer
+        else if (word_index < 31 && received >= ' ')
+        {
+            word_buffer[word_index++] = received;
+        }
     }
+}
 
-    send_string_interrupt("\r\n[DEMO 5 COMPLETE]\r\n");
-    send_string_interrupt("Words echoed: ");
-    send_char_interrupt('0' + (word_count / 10) % 10);
-    send_char_interrupt('0' + word_count % 10);
-    send_string_interrupt("\r\nISRs handled ALL I/O, CPU was free!\r\n");
-    send_string_interrupt("Compare with Demo 2 (polling word echo)!\r\n\r\n");
+void demo_interrupt_word_echo(void)
+{
+    // Initialize UART for interrupt-based communication
+    init_uart_interrupts();
+
+    puts_USART1_P(PSTR("\r\n=== DEMO 5: Interrupt Word Echo ===\r\n"));
+    puts_USART1_P(PSTR("Interrupt: words via ISR. Type 'quit' to exit.\r\n\r\n"));
+
+    _delay_ms(100); // Let messages transmit
+
+    word_index = 0;
+    word_count = 0;
+    Event_subscribe(EVENT_UART_RX, word_echo_handler);
 }
 
 /*
@@ -1251,104 +1286,125 @@ void demo_interrupt_word_echo(void)
  *
  * COMPARE WITH: Demo 3 (polling sentence echo) for maximum efficiency gain
  */
-void demo_interrupt_sentence_echo(void)
-{
-    // Initialize UART for interrupt-based communication
-    init_uart_interrupts();
-
-    puts_USART1_P(PSTR("\r\n=== DEMO 6: Interrupt Sentence Echo ===\r\n"));
-    puts_USART1_P(PSTR("Interrupt: sentences via ISR. Type 'quit' to exit.\r\n\r\n"));
-
-    _delay_ms(100);
+static char line_buffer[64];
+static unsigned char line_index = 0;
+static unsigned int line_count = 0;
 
-    char line_buffer[64];
-    unsigned char line_index = 0;
+// EVENT_UART_RX handler: runs only when data arrived - CPU sleeps otherwise!
+static void sentence_echo_handler(const Event_t *event)
+{
     char received;
-    unsigned int line_count = 0;
-    unsigned int cpu_counter = 0;
-
-    send_string_interrupt("Type sentence> ");
+    (void)event;
 
-    while (1)
+    // Drain ISR buffer (non-blocking!)
+    while (chars_available())
     {
-        // EDUCATIONAL: CPU is FREE to do other work!
-        cpu_counter++;
-        if ((cpu_counter % 50000) == 0)
-        {
-            // CPU continues working while ISRs handle I/O
-        }
-
-        // Check ISR buffer (non-blocking!)
-        if (chars_available())
-        {
-            received = get_char_from_buffer();
+        received = get_char_from_buffer();
 
-            // Echo via ISR
-            send_char_interrupt(received);
+        // Echo via ISR
+        send_char_interrupt(received);
 
-            // Line delimiter check
-            if (received == '\r' || received == '\n')
+        // Line delimiter check
+        if (received == '\r' || received == '\n')
+        {
+            if (line_index > 0)
             {
-                if (line_index > 0)
+                line_buffer[line_index] = '\0';
+                line_count++;
+
+                // Check quit
+                if (strcmp(line_buffer, "quit") == 0)
                 {
-                    line_buffer[line_index] = '\0';
-                    line_count++;
-
-                    // Check quit
-                    if (strcmp(line_buffer, "quit") == 0)
-                    {
-                        send_string_interrupt("\r\n[Exiting Demo 6]\r\n");
-                        break;
-                    }
-
-                    // Echo complete sentence
-                    send_string_interrupt("\r\n→ SENTENCE ECHO: \"");
-                    send_string_interrupt(line_buffer);
-                    send_string_interrupt("\"\r\n");
-
-                    if ((line_count % 3) == 0)
-                    {
-                        send_string_interrupt("   [");
-                        send_char_interrupt('0' + (line_count / 10) % 10);
-                        send_char_interrupt('0' + line_count % 10);
-                        send_string_interrupt(" sentences, CPU was FREE!]\r\n");
-                    }
-
-                    send_string_interrupt("Type sentence> ");
-                    line_index = 0;
+                    Event_unsubscribe(EVENT_UART_RX, sentence_echo_handler);
+                    send_string_interrupt("\r\n[Exiting Demo 6]\r\n");
+                    send_string_interrupt("\r\n[DEMO 6 COMPLETE]\r\n");
+                    send_string_interrupt("Sentences echoed: ");
+                    send_char_interrupt('0' + (line_count / 10) % 10);
+                    send_char_interrupt('0' + line_count % 10);
+                    send_string_interrupt("\r\nFull duplex ISR: Maximum efficiency!\r\n");
+                    send_string_interrupt("Compare with Demo 3 (polling sentence)!\r\n\r\n");
+                    demo_finished();
+                    return;
                 }
-            }
-            // Backspace
-            else if (received == '\b' || received == 127)
-            {
-                if (line_index > 0)
+
+                // Echo complete sentence
+                send_string_interrupt("\r\n→ SENTENCE ECHO: \"");
+                send_string_interrupt(line_buffer);
+                send_string_interrupt("\"\r\n");
+
+                if ((line_count % 3) == 0)
                 {
-                    line_index--;
-                    send_string_interrupt(" \b");
+                    send_string_interrupt("   [");
+                    send_char_interrupt('0' + (line_count / 10) % 10);
+                    send_char_interrupt('0' + line_count % 10);
+                    send_string_interrupt(" sentences, CPU was FREE!]\r\n");
                 }
+
+                send_string_interrupt("Type sentence> ");
+                line_index = 0;
             }
-            // Add to buffer
-            else if (line_index < 63 && received >= ' ')
-            {
-                line_buffer[line_index++] = received;
-            }
-            // Buffer full
-            else if (line_index >= 63)
+        }
+        // Backspace
+        else if (received == '\b' || received == 127)
+        {
+            if (line_index > 0)
             {
-                send_string_interrupt("\r\n[BUFFER FULL - Press Enter]\r\n");
+                line_index--;
+                send_string_interrupt(" \b");
             }
         }
-
-        // Small delay (CPU still free!)
-        _delay_ms(5);
+        // Add to buffer
+        else if (line_index < 63 && received >= ' ')
+        {
+            line_buffer[line_index++] = received;
+        }
+        // Buffer full
+        else if (line_index >= 63)
+        {
+            send_string_interrupt("\r\n[BUFFER FULL - Press Enter]\r\n");
+        }
     }
+}
+
+void demo_interrupt_sentence_echo(void)
+{
+    // Initialize UART for interrupt-based communication
+    init_uart_interrupts();
+
+    puts_USART1_P(PSTR("\r\n=== DEMO 6: Interrupt Sentence Echo ===\r\n"));
+    puts_USART1_P(PSTR("Interrupt: sentences via ISR. Type 'quit' to exit.\r\n\r\n"));
+
+    _delay_ms(100);
+
+    line_index = 0;
+    line_count = 0;
+    send_string_interrupt("Type sentence> ");
+    Event_subscribe(EVENT_UART_RX, sentence_echo_handler);
+}
 
-    send_string_interrupt("\r\n[DEMO 6 COMPLETE]\r\n");
-    send_string_interrupt("Sentences echoed: ");
-    send_char_interrupt('0' + (line_count / 10) % 10);
-    send_char_interrupt('0' + line_count % 10);
-    send_string_interrupt("\r\nFull duplex ISR: Maximum efficiency!\r\n");
-    send_string_interrupt("Compare with Demo 3 (polling sentence)!\r\n\r\n");
+/*
+ * =============================================================================
+ * SUMMARY (EVENT_DEMO_DONE handler)
+ * =============================================================================
+ */
+
+// Idle hook after the demo: keep LED blinking to show program is running
+static void blink_led(void)
+{
+    PORTB ^= 0x01; // Toggle LED to show CPU is free
+    _delay_ms(500);
+}
+
+static void summary_handler(const Event_t *event)
+{
+    (void)event;
+
+    puts_USART1_P(PSTR("\r\n=== SUMMARY ===\r\n"));
+    puts_USART1_P(PSTR("Polling: Simple but blocks CPU\r\n"));
+    puts_USART1_P(PSTR("Interrupt: Complex but CPU-efficient\r\n"));
+    puts_USART1_P(PSTR("Learn 1-3 first, then 4-6. Compare pairs.\r\n"));
+
+    Event_set_idle_hook(blink_led);
 }
 
 /*
@@ -1362,6 +1418,10 @@ int main(void)
     // Initialize basic system (each demo will initialize its own UART)
     simple_init_serial();
 
+    // Event bus first: demos subscribe to it, the summary runs from it
+    Event_init();
+    Event_subscribe(EVENT_DEMO_DONE, summary_handler);
+
     // Wait a moment for system stability
     _delay_ms(1000);
 
@@ -1403,17 +1463,10 @@ int main(void)
     // demo_interrupt_word_echo(); // Demo 5: Interrupt word echo (NEW!)
     demo_interrupt_sentence_echo(); // Demo 6: Interrupt sentence echo
 
-    puts_USART1_P(PSTR("\r\n=== SUMMARY ===\r\n"));
-    puts_USART1_P(PSTR("Polling: Simple but blocks CPU\r\n"));
-    puts_USART1_P(PSTR("Interrupt: Complex but CPU-efficient\r\n"));
-    puts_USART1_P(PSTR("Learn 1-3 first, then 4-6. Compare pairs.\r\n"));
-
-    // Keep LED blinking to show program is running
-    while (1)
-    {
-        PORTB ^= 0x01; // Toggle LED to show CPU is free
-        _delay_ms(500);
-    }
+    // Polling demos return after 'quit' and post EVENT_DEMO_DONE; interrupt
+    // demos subscribe their handler and return at once. The event loop
+    // then dispatches received data and the summary, sleeping in between.
+    Event_run(); // Never returns
 
     return 0;
 }
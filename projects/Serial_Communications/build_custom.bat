@@ -2,7 +2,7 @@
 REM Custom build script for Serial_interrupt project (without UART library)
 echo Building Serial_interrupt project for ATmega128 with custom startup...
 
-"..\..\tools\avr-toolchain\bin\avr-gcc.exe" -mmcu=atmega128 -DF_CPU=16000000UL -DBAUD=9600 -O1 -Wall -I. -I../../shared_libs -nostartfiles minimal_startup.c Main.c ../../shared_libs/_port.c -lm -lgcc -o Main.elf
+"..\..\tools\avr-toolchain\bin\avr-gcc.exe" -mmcu=atmega128 -DF_CPU=16000000UL -DBAUD=9600 -DEVENT_BUS_ENABLED -O1 -Wall -I. -I../../shared_libs -nostartfiles minimal_startup.c Main.c ../../shared_libs/_port.c ../../shared_libs/_event.c -lm -lgcc -o Main.elf
 
 if %ERRORLEVEL% EQU 0 (
     echo Build successful! Creating HEX file...
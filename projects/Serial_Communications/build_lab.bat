@@ -3,7 +3,7 @@ REM Build script for Serial Communications Lab.c
 REM This builds the interrupt-based Q&A system with LCD display
 echo Building Serial Communications Lab for ATmega128...
 
-"..\..\tools\avr-toolchain\bin\avr-gcc.exe" -mmcu=atmega128 -DF_CPU=16000000UL -DBAUD=9600 -O3 -Wall -I. -I../../shared_libs -funsigned-char -funsigned-bitfields -ffunction-sections -fdata-sections -fpack-struct -fshort-enums -mrelax Lab.c ../../shared_libs/_glcd.c ../../shared_libs/_port.c -lm -o Lab.elf
+"..\..\tools\avr-toolchain\bin\avr-gcc.exe" -mmcu=atmega128 -DF_CPU=16000000UL -DBAUD=9600 -O3 -Wall -I. -I../../shared_libs -funsigned-char -funsigned-bitfields -ffunction-sections -fdata-sections -fpack-struct -fshort-enums -mrelax Lab.c ../../shared_libs/_glcd.c ../../shared_libs/_raster.c ../../shared_libs/_port.c -lm -o Lab.elf
 
 if %ERRORLEVEL% EQU 0 (
     echo Build successful! Creating HEX file...
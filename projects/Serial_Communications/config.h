@@ -29,6 +29,7 @@
 #include <util/delay.h>
 #include <string.h>
 #include <stdio.h>
+#include "../../shared_libs/_event.h"
 
 // Provide optional include of shared port helpers if present
 // Path is relative to this project directory: ../../shared_libs
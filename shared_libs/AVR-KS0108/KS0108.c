@@ -1,131 +1,68 @@
-// --- Educational Graphics Primitives: Minimal Implementations ---
-#include <stdint.h>
 #include "KS0108.h"
+#include "../_glcd.h"
+#include "../_bitmap.h"
+#include "../_text.h"
 
-#include <stdlib.h>
-
-void GLCD_DrawLine(uint8_t X1, uint8_t Y1, uint8_t X2, uint8_t Y2, enum Color_t Color) {
-	// Bresenham's line algorithm (integer only)
-	int dx = abs(X2 - X1), sx = X1 < X2 ? 1 : -1;
-	int dy = -abs(Y2 - Y1), sy = Y1 < Y2 ? 1 : -1;
-	int err = dx + dy, e2;
-	while (1) {
-		GLCD_SetPixel(X1, Y1, Color);
-		if (X1 == X2 && Y1 == Y2) break;
-		e2 = 2 * err;
-		if (e2 >= dy) { err += dy; X1 += sx; }
-		if (e2 <= dx) { err += dx; Y1 += sy; }
-	}
-}
-
-void GLCD_DrawRectangle(const uint8_t X1, const uint8_t Y1, const uint8_t X2, const uint8_t Y2, enum Color_t Color) {
-	GLCD_DrawLine(X1, Y1, X2, Y1, Color);
-	GLCD_DrawLine(X2, Y1, X2, Y2, Color);
-	GLCD_DrawLine(X2, Y2, X1, Y2, Color);
-	GLCD_DrawLine(X1, Y2, X1, Y1, Color);
-}
-
-void GLCD_FillRectangle(uint8_t X1, uint8_t Y1, uint8_t X2, uint8_t Y2, enum Color_t Color) {
-	if (X2 < X1) { uint8_t t = X1; X1 = X2; X2 = t; }
-	if (Y2 < Y1) { uint8_t t = Y1; Y1 = Y2; Y2 = t; }
-	for (uint8_t y = Y1; y <= Y2; ++y) {
-		GLCD_DrawLine(X1, y, X2, y, Color);
-	}
-}
-
-void GLCD_DrawCircle(const uint8_t CenterX, const uint8_t CenterY, const uint8_t Radius, enum Color_t Color) {
-	int x = Radius, y = 0, err = 0;
-	while (x >= y) {
-		GLCD_SetPixel(CenterX + x, CenterY + y, Color);
-		GLCD_SetPixel(CenterX + y, CenterY + x, Color);
-		GLCD_SetPixel(CenterX - y, CenterY + x, Color);
-		GLCD_SetPixel(CenterX - x, CenterY + y, Color);
-		GLCD_SetPixel(CenterX - x, CenterY - y, Color);
-		GLCD_SetPixel(CenterX - y, CenterY - x, Color);
-		GLCD_SetPixel(CenterX + y, CenterY - x, Color);
-		GLCD_SetPixel(CenterX + x, CenterY - y, Color);
-		y++;
-		if (err <= 0) { err += 2 * y + 1; }
-		if (err > 0) { x--; err -= 2 * x + 1; }
-	}
-}
-
-void GLCD_FillCircle(const uint8_t CenterX, const uint8_t CenterY, const uint8_t Radius, enum Color_t Color) {
-	for (int y = -Radius; y <= Radius; y++) {
-		for (int x = -Radius; x <= Radius; x++) {
-			if (x * x + y * y <= Radius * Radius) {
-				GLCD_SetPixel(CenterX + x, CenterY + y, Color);
-			}
-		}
-	}
-}
-#include "KS0108.h"
+//The parallel backend (the default) must use this driver's pins, RST and
+//busy-flag setting from KS0108_Settings.h; host builds have no pins.
+#if !defined(GLCD_BACKEND) && !defined(GLCD_PINS_AVR_KS0108)
+#error "AVR-KS0108: build every file with -DGLCD_PINS_AVR_KS0108 (pin map in KS0108_Settings.h)"
+#endif
 
 //----- Auxiliary data ------//
-uint8_t __GLCD_Buffer[__GLCD_Screen_Width][__GLCD_Screen_Lines];
+//The frame buffer, dirty tracking, bus and busy-flag handling are those of
+//the shared core (../_glcd.c with the backend of ../_glcd_backend.h).
+//This file keeps the API: buffer byte (X, Line) is ScreenBuffer[Line][X].
 GLCD_t __GLCD;
 
-#define __GLCD_XtoChip(X)		((X < (__GLCD_Screen_Width / __GLCD_Screen_Chips)) ? Chip_1 : Chip_2)
-#define __GLCD_Min(X, Y)		((X < Y) ? X : Y)
-#define __GLCD_AbsDiff(X, Y)	((X > Y) ? (X - Y) : (Y - X))
-#define __GLCD_Swap(X, Y)		do { typeof(X) t = X; X = Y; Y = t; } while (0)
+//Bus transactions of the last GLCD_Render()
+static uint16_t __GLCD_RenderWrites;
 //---------------------------//
 
 //----- Prototypes ----------------------------//
-static void GLCD_Send(const uint8_t Data);
-static void GLCD_WaitBusy(enum Chip_t Chip);
+static void __GLCD_SetCursor(const uint8_t X, const uint8_t Y);
 static void GLCD_BufferWrite(const uint8_t X, const uint8_t Y, const uint8_t Data);
 static uint8_t GLCD_BufferRead(const uint8_t X, const uint8_t Y);
-static void GLCD_SelectChip(enum Chip_t Chip);
 static void __GLCD_GotoX(const uint8_t X);
 static void __GLCD_GotoY(const uint8_t Y);
-static void GLCD_DrawHLine(uint8_t X1, uint8_t X2, const uint8_t Y, enum Color_t Color);
-static void GLCD_DrawVLine(uint8_t Y1, uint8_t Y2, const uint8_t X, enum Color_t Color);
 static void Int2bcd(int32_t Value, char BCD[]);
-static inline void Pulse_En(void);
 //---------------------------------------------//
 
+//Shared integer rasterizers (../_raster.c) draw through the core's buffer
+#define __GLCD_Raster				GLCD_raster
+#define __GLCD_RasterColor(Color)	((Color == GLCD_Black) ? RASTER_SET : RASTER_CLEAR)
+
 //----- Functions -------------//
 void GLCD_SendCommand(const uint8_t Command, enum Chip_t Chip)
 {
-	//Check if busy
-	if (Chip != Chip_All)
-	{
-		GLCD_WaitBusy(Chip);
-	}
-	else
+	switch (Chip)
 	{
-		GLCD_WaitBusy(Chip_1);
-		GLCD_WaitBusy(Chip_2);
+		case Chip_1:
+			cmndl(Command);
+			break;
+		case Chip_2:
+			cmndr(Command);
+			break;
+		case Chip_All:
+			cmnda(Command);
+			break;
 	}
-	GLCD_SelectChip(Chip);
-
-	DigitalWrite(GLCD_DI, Low);      //RS = 0
-	DigitalWrite(GLCD_RW, Low);      //RW = 0
-	
-	//Send data
-	GLCD_Send(Command);
 }
 
 void GLCD_SendData(const uint8_t Data, enum Chip_t Chip)
 {
-	//Check if busy
-	if (Chip != Chip_All)
-	{
-		GLCD_WaitBusy(Chip);
-	}
-	else
+	switch (Chip)
 	{
-		GLCD_WaitBusy(Chip_1);
-		GLCD_WaitBusy(Chip_2);
+		case Chip_1:
+			datal(Data);
+			break;
+		case Chip_2:
+			datar(Data);
+			break;
+		case Chip_All:
+			dataa(Data);
+			break;
 	}
-	GLCD_SelectChip(Chip);
-
-	DigitalWrite(GLCD_DI, High);     //RS = 1
-	DigitalWrite(GLCD_RW, Low);      //RW = 0
-
-	//Send data
-	GLCD_Send(__GLCD.Mode == GLCD_Non_Inverted ? Data : ~Data);
 	
 	__GLCD.X++;
 	if (__GLCD.X == (__GLCD_Screen_Width / __GLCD_Screen_Chips))
@@ -136,35 +73,11 @@ void GLCD_SendData(const uint8_t Data, enum Chip_t Chip)
 
 void GLCD_Setup(void)
 {
-	//Setup pins
-	PinMode(GLCD_D0, Output);	//GLCD pins = Outputs
-	PinMode(GLCD_D1, Output);
-	PinMode(GLCD_D2, Output);
-	PinMode(GLCD_D3, Output);
-	PinMode(GLCD_D4, Output);
-	PinMode(GLCD_D5, Output);
-	PinMode(GLCD_D6, Output);
-	PinMode(GLCD_D7, Output);
-
-	PinMode(GLCD_CS1, Output);
-	PinMode(GLCD_CS2, Output);
-	PinMode(GLCD_DI, Output);
-	PinMode(GLCD_EN, Output);
-	PinMode(GLCD_RW, Output);
-	PinMode(GLCD_RST, Output);
-
-	DigitalWrite(GLCD_DI, Low);		//GLCD pins = 0
-	DigitalWrite(GLCD_RW, Low);
-	DigitalWrite(GLCD_EN, Low);
-	
-	DigitalWrite(GLCD_RST, Low);	//!RST
-	_delay_ms(5);
-	DigitalWrite(GLCD_RST, High);
-	_delay_ms(50);
+	//Pins, display on, start line 0 and a cleared panel (shared core)
+	lcd_init();
 
-	//Initialize chips
-	GLCD_SendCommand(__GLCD_Command_On, Chip_All);
-	GLCD_SendCommand(__GLCD_Command_Display_Start, Chip_All);
+	//Drawing goes to the buffer, GLCD_Render() sends the changes
+	GLCD_Set_render_mode(GLCD_RENDER_DEFERRED);
 
 	//Go to 0,0
 	GLCD_GotoXY(0, 0);
@@ -172,19 +85,23 @@ void GLCD_Setup(void)
 	//Reset GLCD structure
 	__GLCD.Mode = GLCD_Non_Inverted;
 	__GLCD.X = __GLCD.Y = __GLCD.Font.Width = __GLCD.Font.Height = __GLCD.Font.Lines = 0;
+	GLCD_Set_inverted(0);
 }
 
 void GLCD_Render(void)
 {
-	uint8_t i, j;
-	
-	for (j = 0 ; j < __GLCD_Screen_Height ; j += __GLCD_Screen_Line_Height)
-	{
-		__GLCD_GotoX(0);
-		__GLCD_GotoY(j);
-		for (i = 0 ; i < __GLCD_Screen_Width ; i++)
-			GLCD_SendData(GLCD_BufferRead(i, __GLCD.Y), __GLCD_XtoChip(i));
-	}
+	GLCD_bus_stats_t before, after;
+
+	GLCD_Get_bus_stats(&before);
+	GLCD_Flush();
+	GLCD_Get_bus_stats(&after);
+
+	__GLCD_RenderWrites = (after.commands + after.data_bytes) - (before.commands + before.data_bytes);
+}
+
+uint16_t GLCD_GetRenderWrites(void)
+{
+	return __GLCD_RenderWrites;
 }
 
 void GLCD_InvertMode(void)
@@ -193,6 +110,9 @@ void GLCD_InvertMode(void)
 		__GLCD.Mode = GLCD_Non_Inverted;
 	else
 		__GLCD.Mode = GLCD_Inverted;
+
+	//Every byte on the panel changes on the next Render
+	GLCD_Set_inverted(__GLCD.Mode == GLCD_Inverted);
 }
 
 void GLCD_Clear(void)
@@ -208,7 +128,7 @@ void GLCD_ClearLine(const uint8_t Line)
 		i = 0;
 		color = __GLCD.Mode == GLCD_Non_Inverted ? GLCD_White : GLCD_Black;
 
-		GLCD_GotoXY(0, Line * __GLCD_Screen_Line_Height);
+		__GLCD_SetCursor(0, Line * __GLCD_Screen_Line_Height);
 		for (i = 0 ; i < __GLCD_Screen_Width ; i++)
 			GLCD_BufferWrite(i, __GLCD.Y, color);	
 	}
@@ -265,8 +185,8 @@ void GLCD_SetPixel(const uint8_t X, const uint8_t Y, enum Color_t Color)
 	{
 		uint8_t data;
 		
-		//Go to the pixel location
-		GLCD_GotoXY(X, Y);
+		//Go to the pixel location (buffer only, no bus traffic)
+		__GLCD_SetCursor(X, Y);
 		
 		//Read byte
 		data = GLCD_BufferRead(__GLCD.X, __GLCD.Y);
@@ -289,7 +209,78 @@ void GLCD_FillScreen(enum Color_t Color)
 	
 	for (i = 0; i < __GLCD_Screen_Width; i++)
 		for (j = 0; j < __GLCD_Screen_Lines; j++)
-			__GLCD_Buffer[i][j] = data;
+			GLCD_BufferWrite(i, j * __GLCD_Screen_Line_Height, data);
+}
+
+void GLCD_SetPixels(uint8_t X1, uint8_t Y1, uint8_t X2, uint8_t Y2, enum Color_t Color)
+{
+	Raster_fill_rect(&__GLCD_Raster, X1, Y1, X2, Y2, __GLCD_RasterColor(Color));
+}
+
+void GLCD_InvertPixel(const uint8_t X, const uint8_t Y)
+{
+	Raster_pixel(&__GLCD_Raster, X, Y, RASTER_XOR);
+}
+
+void GLCD_InvertPixels(uint8_t X1, uint8_t Y1, uint8_t X2, uint8_t Y2)
+{
+	Raster_fill_rect(&__GLCD_Raster, X1, Y1, X2, Y2, RASTER_XOR);
+}
+
+void GLCD_InvertScreen(void)
+{
+	GLCD_InvertPixels(0, 0, __GLCD_Screen_Width - 1, __GLCD_Screen_Height - 1);
+}
+
+void GLCD_DrawBitmap(const uint8_t *Bitmap, const uint8_t Width, const uint8_t Height, enum PrintMode_t Mode)
+{
+	//Page data from flash at the cursor, shifted across lines if needed
+	Bitmap_blit(&__GLCD_Raster, __GLCD.X, __GLCD.Y, Width, Height, Bitmap, BITMAP_RAW,
+				(Mode == GLCD_Merge) ? BITMAP_OR : BITMAP_COPY);
+}
+
+void GLCD_DrawLine(uint8_t X1, uint8_t Y1, uint8_t X2, uint8_t Y2, enum Color_t Color)
+{
+	//Bresenham, horizontal and vertical lines as page spans
+	Raster_line(&__GLCD_Raster, X1, Y1, X2, Y2, __GLCD_RasterColor(Color));
+}
+
+void GLCD_DrawRectangle(const uint8_t X1, const uint8_t Y1, const uint8_t X2, const uint8_t Y2, enum Color_t Color)
+{
+	Raster_rect(&__GLCD_Raster, X1, Y1, X2, Y2, __GLCD_RasterColor(Color));
+}
+
+void GLCD_FillRectangle(uint8_t X1, uint8_t Y1, uint8_t X2, uint8_t Y2, enum Color_t Color)
+{
+	Raster_fill_rect(&__GLCD_Raster, X1, Y1, X2, Y2, __GLCD_RasterColor(Color));
+}
+
+void GLCD_InvertRectangle(uint8_t X1, uint8_t Y1, uint8_t X2, uint8_t Y2)
+{
+	//Outline only; GLCD_InvertPixels() inverts the area
+	Raster_rect(&__GLCD_Raster, X1, Y1, X2, Y2, RASTER_XOR);
+}
+
+void GLCD_DrawCircle(const uint8_t CenterX, const uint8_t CenterY, const uint8_t Radius, enum Color_t Color)
+{
+	//Midpoint circle
+	Raster_circle(&__GLCD_Raster, CenterX, CenterY, Radius, __GLCD_RasterColor(Color));
+}
+
+void GLCD_FillCircle(const uint8_t CenterX, const uint8_t CenterY, const uint8_t Radius, enum Color_t Color)
+{
+	Raster_fill_circle(&__GLCD_Raster, CenterX, CenterY, Radius, __GLCD_RasterColor(Color));
+}
+
+void GLCD_DrawEllipse(const uint8_t CenterX, const uint8_t CenterY, const uint8_t RadiusX, const uint8_t RadiusY, enum Color_t Color)
+{
+	//Midpoint ellipse
+	Raster_ellipse(&__GLCD_Raster, CenterX, CenterY, RadiusX, RadiusY, __GLCD_RasterColor(Color));
+}
+
+void GLCD_FillEllipse(const uint8_t CenterX, const uint8_t CenterY, const uint8_t RadiusX, const uint8_t RadiusY, enum Color_t Color)
+{
+	Raster_fill_ellipse(&__GLCD_Raster, CenterX, CenterY, RadiusX, RadiusY, __GLCD_RasterColor(Color));
 }
 
 void GLCD_SetFont(const uint8_t *Name, const uint8_t Width, const uint8_t Height, enum PrintMode_t Mode)
@@ -340,116 +331,27 @@ uint16_t GLCD_GetWidthString_P(const char *Text)
 
 void GLCD_PrintChar(char Character)
 {
-	uint16_t fontStart, fontRead, fontReadPrev;
-	uint8_t x, y, y2, i, j, width, lines, overflow, data, dataPrev;
-	fontStart = fontRead = fontReadPrev = x = y = y2 = i = j = width = lines = overflow = data = dataPrev = 0;
-	
+	uint16_t fontStart;
+	uint8_t x, y, width;
+
 	//#1 - Save current position
 	x = __GLCD.X;
-	y = y2 = __GLCD.Y;
-	
-	//#2 - Remove leading empty characters
-	Character -= 32;														//32 is the ASCII of the first printable character
-	
-	//#3 - Find the start of the character in the font array
-	fontStart = Character * (__GLCD.Font.Width * __GLCD.Font.Lines + 1);		//+1 due to first byte of each array line being the width
-	
-	//#4 - Update width - First byte of each line is the width of the character
-	width = pgm_read_byte(&(__GLCD.Font.Name[fontStart++]));
-	data = __GLCD.X + width;											//"data" is used temporarily
-	//If character exceed screen bounds, reduce
-	if (data >= __GLCD_Screen_Width)
-		width -= data-__GLCD_Screen_Width;
-	
-	//#5 - Update lines
-	lines = __GLCD.Font.Lines;
-	data = __GLCD.Y / __GLCD_Screen_Line_Height + lines;				//"data" is used temporarily
-	//If character exceed screen bounds, reduce
-	if (data > __GLCD_Screen_Lines)
-		lines -= data - __GLCD_Screen_Lines;
-	
-	//#6 - Calculate overflowing bits
-	overflow = __GLCD.Y % __GLCD_Screen_Line_Height;
-		
-	//#7 - Print the character
-	//Scan the lines needed
-	for (j = 0 ; j < lines ; j++)
-	{
-		//Go to the start of the line
-		GLCD_GotoXY(x, y);
-		
-		//Update the indices for reading the line
-		fontRead = fontStart + j * width;
-		fontReadPrev = fontRead - width;		//Previous = fontStart + (j - 1) * width = fontRead - width
+	y = __GLCD.Y;
 
-		//Scan bytes of selected line
-		for (i = 0 ; i < width ; i++)
-		{
-			//Read byte
-			data = pgm_read_byte(&(__GLCD.Font.Name[fontRead++]));
-			
-			//Shift byte
-			data <<= overflow;
-			
-			//Merge byte with previous one
-			if (j > 0)
-			{
-				dataPrev = pgm_read_byte(&(__GLCD.Font.Name[fontReadPrev++]));
-				dataPrev >>= __GLCD_Screen_Line_Height - overflow;
-				data |= dataPrev;
-			}
-			//Edit byte depending on the mode
-			if (__GLCD.Font.Mode == GLCD_Merge)
-				data |= GLCD_BufferRead(__GLCD.X, __GLCD.Y);
-			
-			//Send byte
-			GLCD_BufferWrite(__GLCD.X++, __GLCD.Y, data);
-		}
-		//Send an empty column of 1px in the end
-		if (__GLCD.Font.Mode == GLCD_Overwrite)
-			data = GLCD_White;
-		else
-			data = GLCD_BufferRead(__GLCD.X, __GLCD.Y);
-		GLCD_BufferWrite(__GLCD.X, __GLCD.Y, data);
-		
-		//Increase line counter
-		y += __GLCD_Screen_Line_Height;
-	}
+	//#2 - Find the start of the character in the font array
+	//32 is the ASCII of the first printable character, +1 due to first byte of each array line being the width
+	fontStart = (Character - 32) * (__GLCD.Font.Width * __GLCD.Font.Lines + 1);
 
-	//#8 - Update last line, if needed
-	if (lines > 1)
-	{
-		//Go to the start of the line
-		GLCD_GotoXY(x, y);
-		
-		//Update the index for reading the last printed line
-		fontReadPrev = fontStart + j - 1;
+	//#3 - Width is the first byte of the array line, glyph lines follow (page-major)
+	width = pgm_read_byte(&(__GLCD.Font.Name[fontStart++]));
 
-		//Scan bytes of selected line
-		for (i = 0 ; i < width ; i++)
-		{
-			//Read byte
-			data = GLCD_BufferRead(__GLCD.X, __GLCD.Y);
-			
-			//Merge byte with previous one
-			dataPrev = pgm_read_byte(&(__GLCD.Font.Name[fontReadPrev]));
-			fontReadPrev++;
-			dataPrev >>= __GLCD_Screen_Line_Height - overflow;
-			data |= dataPrev;
-			
-			//Send byte
-			GLCD_BufferWrite(__GLCD.X++, __GLCD.Y, data);
-		}
-		//Send an empty column of 1px in the end
-		if (__GLCD.Font.Mode == GLCD_Overwrite)
-			data = GLCD_White;
-		else
-			data = GLCD_BufferRead(__GLCD.X, __GLCD.Y);
-		GLCD_BufferWrite(__GLCD.X, __GLCD.Y, data);
-	}
+	//#4 - Print the character and 1px of spacing through the shared text renderer
+	//(page-aligned Overwrite is a straight copy, anything else a shifted blit)
+	Text_glyph(&__GLCD_Raster, x, y, &(__GLCD.Font.Name[fontStart]), width, __GLCD.Font.Lines * __GLCD_Screen_Line_Height, 1,
+			   (__GLCD.Font.Mode == GLCD_Merge) ? BITMAP_OR : BITMAP_COPY);
 
 	//Set cursor to the end of the printed character
-	GLCD_GotoXY(x + width + 1, y2);
+	__GLCD_SetCursor(x + width + 1, y);
 }
 
 void GLCD_PrintString(const char *Text)
@@ -524,129 +426,47 @@ void GLCD_PrintDouble(double Value, const uint32_t Tens)
 	}
 }
 
-static void GLCD_Send(const uint8_t Data)
-{
-	//Send nibble
-	DigitalWrite(GLCD_D0, BitCheck(Data, 0));
-	DigitalWrite(GLCD_D1, BitCheck(Data, 1));
-	DigitalWrite(GLCD_D2, BitCheck(Data, 2));
-	DigitalWrite(GLCD_D3, BitCheck(Data, 3));
-	DigitalWrite(GLCD_D4, BitCheck(Data, 4));
-	DigitalWrite(GLCD_D5, BitCheck(Data, 5));
-	DigitalWrite(GLCD_D6, BitCheck(Data, 6));
-	DigitalWrite(GLCD_D7, BitCheck(Data, 7));
-	Pulse_En();
-}
-
-static void GLCD_WaitBusy(enum Chip_t Chip)
+static void GLCD_BufferWrite(const uint8_t X, const uint8_t Y, const uint8_t Data)
 {
-	uint8_t status = 0;
-	
-	GLCD_SelectChip(Chip);
-	
-	//Busy pin = Input
-	PinMode(GLCD_D7, Input);
+	if (X >= __GLCD_Screen_Width)
+		return;
 
-	DigitalWrite(GLCD_DI, Low);
-	DigitalWrite(GLCD_RW, High);
-	DigitalWrite(GLCD_EN, Low);
-	_delay_us(__GLCD_Pulse_En);
-	
-	//Send Enable pulse and wait till busy flag goes Low
-	do
+	//a>>3 = a/8
+	if (ScreenBuffer[Y>>3][X] != Data)
 	{
-		DigitalWrite(GLCD_EN, High);
-		_delay_us(__GLCD_Pulse_En);
-		status = DigitalRead(GLCD_D7) << 7;
-		
-		DigitalWrite(GLCD_EN, Low);
-		_delay_us(__GLCD_Pulse_En<<3);
+		ScreenBuffer[Y>>3][X] = Data;
+		GLCD_Mark_dirty(Y>>3, X, X);
 	}
-	while(BitCheck(status, __GLCD_BUSY_FLAG));
-
-	DigitalWrite(GLCD_RW, Low);
-	
-	//Busy pin = Output
-	PinMode(GLCD_D7, Output);
-}
-
-static void GLCD_BufferWrite(const uint8_t X, const uint8_t Y, const uint8_t Data)
-{
-	//a>>3 = a/8
-	__GLCD_Buffer[X][Y>>3] = Data;
 }
 
 static uint8_t GLCD_BufferRead(const uint8_t X, const uint8_t Y)
 {
 	//a>>3 = a/8
-	return (__GLCD_Buffer[X][Y>>3]);
+	return (ScreenBuffer[Y>>3][X]);
 }
 
-static void GLCD_SelectChip(enum Chip_t Chip)
+static void __GLCD_SetCursor(const uint8_t X, const uint8_t Y)
 {
-	uint8_t on, off;
-
-	#if (GLCD_Active_Low != 0)
-		on = 0;
-		off = 1;
-	#else
-		on = 1;
-		off = 0;
-	#endif
-
-	switch (Chip)
-	{
-		case Chip_1:
-		{
-			DigitalWrite(GLCD_CS1, on);
-			DigitalWrite(GLCD_CS2, off);
-			break;
-		}
-		case Chip_2:
-		{
-			DigitalWrite(GLCD_CS1, off);
-			DigitalWrite(GLCD_CS2, on);
-			break;
-		}
-		case Chip_All:
-		{
-			DigitalWrite(GLCD_CS1, on);
-			DigitalWrite(GLCD_CS2, on);
-			break;
-		}
-	}
+	//Same bounds as GLCD_GotoXY(), but only the buffer cursor moves
+	if (X < __GLCD_Screen_Width)
+		__GLCD.X = X;
+	if (Y < __GLCD_Screen_Height)
+		__GLCD.Y = Y;
 }
 
 static void __GLCD_GotoX(const uint8_t X)
 {
 	uint8_t cmd;
-	uint8_t chip1, chip2;
-	
-	//Determine which chips to set
-	chip1 = X;
-	chip2 = X;
-	
-	if (X >= (__GLCD_Screen_Width / __GLCD_Screen_Chips))
-	{
-		chip1 = __GLCD_Screen_Width;
-		chip2 = X - (__GLCD_Screen_Width / __GLCD_Screen_Chips);
-	}
-	else
-	{
-		chip2 = __GLCD_Screen_Width;
-	}
 	
-	//Set address command for chip 1
-	if (chip1 < (__GLCD_Screen_Width / __GLCD_Screen_Chips))
+	//Set address command for the chip that holds column X
+	if (X < (__GLCD_Screen_Width / __GLCD_Screen_Chips))
 	{
-		cmd = __GLCD_Command_Set_Address | (chip1 % (__GLCD_Screen_Width / __GLCD_Screen_Chips));
+		cmd = __GLCD_Command_Set_Address | X;
 		GLCD_SendCommand(cmd, Chip_1);
 	}
-	
-	//Set address command for chip 2
-	if (chip2 < (__GLCD_Screen_Width / __GLCD_Screen_Chips))
+	else
 	{
-		cmd = __GLCD_Command_Set_Address | (chip2 % (__GLCD_Screen_Width / __GLCD_Screen_Chips));
+		cmd = __GLCD_Command_Set_Address | (X - (__GLCD_Screen_Width / __GLCD_Screen_Chips));
 		GLCD_SendCommand(cmd, Chip_2);
 	}
 }
@@ -668,38 +488,6 @@ static void __GLCD_GotoY(const uint8_t Y)
 	}
 }
 
-static inline void GLCD_DrawHLine(uint8_t X1, uint8_t X2, const uint8_t Y, enum Color_t Color)
-{
-	if (X1 > X2)
-		__GLCD_Swap(X1, X2);
-	
-	while (X1 <= X2)
-	{
-		GLCD_SetPixel(X1, Y, Color);
-		X1++;
-	}
-}
-
-static inline void GLCD_DrawVLine(uint8_t Y1, uint8_t Y2, const uint8_t X, enum Color_t Color)
-{
-	if (Y1 > Y2)
-		__GLCD_Swap(Y1, Y2);
-	
-	while (Y1 <= Y2)
-	{
-		GLCD_SetPixel(X, Y1, Color);
-		Y1++;
-	}
-}
-
-static inline void Pulse_En(void)
-{
-	DigitalWrite(GLCD_EN, High);
-	_delay_us(__GLCD_Pulse_En);
-	DigitalWrite(GLCD_EN, Low);
-	_delay_us(__GLCD_Pulse_En);
-}
-
 static void Int2bcd(int32_t Value, char BCD[])
 {
 	uint8_t isNegative = 0;
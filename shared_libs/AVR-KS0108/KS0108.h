@@ -22,8 +22,6 @@
 //--------------------------//
 
 //----- Auxiliary data ---------------------------//
-#define __GLCD_Pulse_En					1
-
 #define __GLCD_Command_On				0x3F
 #define __GLCD_Command_Off				0x3E
 #define __GLCD_Command_Set_Address		0x40
@@ -36,8 +34,6 @@
 #define __GLCD_Screen_Lines				__GLCD_Screen_Height / __GLCD_Screen_Line_Height
 #define __GLCD_Screen_Chips				2
 
-#define __GLCD_BUSY_FLAG				7
-
 enum Chip_t
 {
 	Chip_1,
@@ -89,6 +85,8 @@ void GLCD_SendCommand(const uint8_t Command, enum Chip_t Chip);
 void GLCD_SendData(const uint8_t Data, enum Chip_t Chip);
 void GLCD_Setup(void);
 void GLCD_Render(void);
+void GLCD_Invalidate(void);
+uint16_t GLCD_GetRenderWrites(void);
 void GLCD_InvertMode(void);
 
 void GLCD_Clear(void);
@@ -117,6 +115,8 @@ void GLCD_DrawRoundRectangle(const uint8_t X1, const uint8_t Y1, const uint8_t X
 void GLCD_FillRoundRectangle(const uint8_t X1, const uint8_t Y1, const uint8_t X2, const uint8_t Y2, const uint8_t Radius, enum Color_t Color);
 void GLCD_DrawCircle(const uint8_t CenterX, const uint8_t CenterY, const uint8_t Radius, enum Color_t Color);
 void GLCD_FillCircle(const uint8_t CenterX, const uint8_t CenterY, const uint8_t Radius, enum Color_t Color);
+void GLCD_DrawEllipse(const uint8_t CenterX, const uint8_t CenterY, const uint8_t RadiusX, const uint8_t RadiusY, enum Color_t Color);
+void GLCD_FillEllipse(const uint8_t CenterX, const uint8_t CenterY, const uint8_t RadiusX, const uint8_t RadiusY, enum Color_t Color);
 void GLCD_DrawTriangle(const uint8_t X1, const uint8_t Y1, const uint8_t X2, const uint8_t y2, const uint8_t X3, const uint8_t Y3, enum Color_t Color);
 void GLCD_FillTriangle(uint8_t X1, uint8_t Y1, uint8_t X2, uint8_t y2, uint8_t X3, uint8_t Y3, enum Color_t Color);
 
@@ -13,24 +13,32 @@
 */
 
 //----- Configuration -------------//
+//The driver runs on the shared GLCD core (../_glcd.c) and its parallel
+//backend (../_glcd_parallel.h). Build every file with
+//-DGLCD_PINS_AVR_KS0108 so the backend uses the settings below.
+
 //Chip Enable Pin
-#define GLCD_Active_Low		0
+#define GLCD_CS_ACTIVE_LOW	0
+
+//R/W is wired (GLCD_PIN_RW): pace the bus with the busy flag
+#define GLCD_BUSY_POLL
+#define GLCD_BUSY_TIMEOUT	200		//Status reads before giving up
 
 //GLCD pins					PORT, PIN
-#define GLCD_D0				A, 0
-#define GLCD_D1				A, 1
-#define GLCD_D2				A, 2
-#define GLCD_D3				A, 3
-#define GLCD_D4				A, 4
-#define GLCD_D5				A, 5
-#define GLCD_D6				A, 6
-#define GLCD_D7				A, 7
+#define GLCD_PIN_D0			A, 0
+#define GLCD_PIN_D1			A, 1
+#define GLCD_PIN_D2			A, 2
+#define GLCD_PIN_D3			A, 3
+#define GLCD_PIN_D4			A, 4
+#define GLCD_PIN_D5			A, 5
+#define GLCD_PIN_D6			A, 6
+#define GLCD_PIN_D7			A, 7
 
-#define GLCD_DI				B, 0
-#define GLCD_RW				B, 1
-#define GLCD_EN				B, 2
-#define GLCD_CS1			B, 3
-#define GLCD_CS2			B, 4
-#define GLCD_RST			B, 5
+#define GLCD_PIN_RS			B, 0	//DI
+#define GLCD_PIN_RW			B, 1
+#define GLCD_PIN_E			B, 2	//EN
+#define GLCD_PIN_CS1		B, 3
+#define GLCD_PIN_CS2		B, 4
+#define GLCD_PIN_RST		B, 5
 //---------------------------------//
 #endif
\ No newline at end of file
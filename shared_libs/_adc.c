@@ -48,6 +48,13 @@
 #endif
 #include "_main.h"
 #include "_adc.h"
+#include "_atomic.h"
+#ifdef EVENT_BUS_ENABLED
+#include "_event.h"
+#endif
+#ifdef JOYSTICK_ENABLED
+#include "_joystick.h"
+#endif
 
 // Only compile ADC functions if not using self-contained assembly example
 #ifndef ASSEMBLY_BLINK_BASIC
@@ -378,11 +385,25 @@ unsigned char Adc_Self_Test(void)
  */
 volatile unsigned char adc_interrupt_complete = 0;
 
+static volatile unsigned char adc_scan_mask = 0;    // Channels scanned in background (0 = off)
+static volatile unsigned char adc_scan_channel = 0; // Channel being converted
+static volatile unsigned int adc_scan_results[8];   // Latest result per channel
+
+static void adc_scan_next(unsigned int value);
+
 ISR(ADC_vect)
 {
 	/* Read conversion result */
 	adc_result = ADCL + (ADCH << 8);
+	if (adc_scan_mask)
+	{
+		adc_scan_next(adc_result);
+		return;
+	}
 	adc_interrupt_complete = 1;
+#ifdef EVENT_BUS_ENABLED
+	Event_post(EVENT_ADC_COMPLETE, EVENT_PRIORITY_NORMAL, adc_result);
+#endif
 }
 
 /*
@@ -417,4 +438,100 @@ unsigned char Is_Adc_Complete(void)
 	return adc_interrupt_complete;
 }
 
+/*
+ * EDUCATIONAL FUNCTION: Read Interrupt Result
+ *
+ * PURPOSE: Copy the 16-bit result written by ISR(ADC_vect) in one piece
+ * LEARNING: Reading adc_result directly may mix bytes of two conversions
+ */
+unsigned int Get_Adc_Result(void)
+{
+	return Atomic_read_u16(&adc_result);
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Background Channel Scan
+ *
+ * PURPOSE: Convert the channels in channel_mask round-robin, forever,
+ *          without the main program waiting. Each ADC interrupt starts
+ *          the next channel first, so the conversion (13 ADC clocks,
+ *          about 1700 CPU cycles at prescaler 128) runs while the ISR
+ *          stores the finished one.
+ * LEARNING: Read_Adc_Data(), Start_Adc_Interrupt() and Adc_init() rewrite
+ *           ADCSRA/ADMUX; stop the scan before using them.
+ *
+ * RATE: F_CPU / 128 / 13 conversions per second, shared by the channels
+ *       (7.3728MHz: about 4400/s, 2200/s each for two channels)
+ */
+void Adc_scan_start(unsigned char channel_mask)
+{
+	unsigned char channel = 0;
+
+	if (!channel_mask)
+	{
+		Adc_scan_stop();
+		return;
+	}
+	while (!(channel_mask & (1 << channel)))
+	{
+		channel++;
+	}
+
+	unsigned char sreg_backup = SREG;
+	cli();
+
+	adc_scan_mask = channel_mask;
+	adc_scan_channel = channel;
+	ADMUX = channel | ADC_AVCC_TYPE;
+	ADCSRA = (1 << ADEN) | (1 << ADIE) | (1 << ADIF) | ADC_PRESCALE_128; // ADIF: clear stale flag
+	ADCSRA |= (1 << ADSC);
+
+	SREG = sreg_backup;
+}
+
+void Adc_scan_stop(void)
+{
+	unsigned char sreg_backup = SREG;
+	cli();
+	adc_scan_mask = 0;
+	ADCSRA &= ~(1 << ADIE);
+	SREG = sreg_backup;
+
+	while (ADCSRA & (1 << ADSC))
+		; // Let a running conversion finish before the next user
+}
+
+/*
+ * Scan step (runs inside ISR(ADC_vect))
+ */
+static void adc_scan_next(unsigned int value)
+{
+	unsigned char done = adc_scan_channel;
+	unsigned char channel = done;
+
+	do
+	{
+		channel = (channel + 1) & 0x07;
+	} while (!(adc_scan_mask & (1 << channel)));
+
+	ADMUX = channel | ADC_AVCC_TYPE;
+	ADCSRA |= (1 << ADSC);
+	adc_scan_channel = channel;
+
+	adc_scan_results[done] = value;
+#ifdef JOYSTICK_ENABLED
+	Joystick_adc_sample(done, value);
+#endif
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Latest Scanned Value
+ *
+ * RETURNS: Last result of the channel (0 before its first conversion)
+ */
+unsigned int Adc_scan_get(unsigned char channel)
+{
+	return Atomic_read_u16(&adc_scan_results[channel & 0x07]);
+}
+
 #endif // !ASSEMBLY_BLINK_BASIC
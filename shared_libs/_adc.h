@@ -32,6 +32,15 @@ unsigned char Adc_Self_Test(void); // ADC functionality verification
  */
 void Start_Adc_Interrupt(unsigned char adc_input); // Start non-blocking conversion
 unsigned char Is_Adc_Complete(void);               // Check conversion status
+unsigned int Get_Adc_Result(void);                 // Atomic copy of adc_result
+
+/*
+ * Background Scan (ISR converts the masked channels round-robin)
+ * Build with -DJOYSTICK_ENABLED to feed every result to _joystick.c
+ */
+void Adc_scan_start(unsigned char channel_mask);   // Bit n = ADCn
+void Adc_scan_stop(void);
+unsigned int Adc_scan_get(unsigned char channel);  // Latest result, few cycles
 
 /*
  * Global Variables for Educational Use
@@ -0,0 +1,101 @@
+/*
+ * _atomic.h - ATmega128 Atomic Access Helpers
+ * Educational Version for Assembly→C→Python Learning Progression
+ *
+ * PURPOSE:
+ * The AVR core reads and writes memory one byte at a time. A 16-bit or
+ * 32-bit variable updated by an ISR can therefore be read "half old, half
+ * new" by the main program. These helpers copy multi-byte values with
+ * interrupts blocked and restore the previous interrupt state afterwards,
+ * so they are also safe to call from inside an ISR.
+ *
+ * EXAMPLE:
+ *   unsigned long now = Atomic_read_u32(&system_milliseconds);
+ *
+ * ASSEMBLY EQUIVALENT:
+ *   IN   R0, SREG     ; Save interrupt state
+ *   CLI               ; Block interrupts
+ *   LDS  R24, var     ; Copy all bytes
+ *   LDS  R25, var+1
+ *   OUT  SREG, R0     ; Restore interrupt state
+ *
+ * NOTE: Single-byte variables never need these helpers.
+ */
+
+#ifndef _ATOMIC_H_
+#define _ATOMIC_H_
+
+#include <stdint.h>
+#include <util/atomic.h>
+
+static inline uint16_t Atomic_read_u16(const volatile uint16_t *var)
+{
+	uint16_t value;
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		value = *var;
+	}
+	return value;
+}
+
+static inline void Atomic_write_u16(volatile uint16_t *var, uint16_t value)
+{
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		*var = value;
+	}
+}
+
+static inline uint32_t Atomic_read_u32(const volatile uint32_t *var)
+{
+	uint32_t value;
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		value = *var;
+	}
+	return value;
+}
+
+static inline void Atomic_write_u32(volatile uint32_t *var, uint32_t value)
+{
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		*var = value;
+	}
+}
+
+/*
+ * Read-modify-write helpers: "counter++" on a shared variable is a load,
+ * an add and a store - an ISR between them loses its own update.
+ */
+static inline void Atomic_add_u16(volatile uint16_t *var, uint16_t delta)
+{
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		*var += delta;
+	}
+}
+
+static inline uint8_t Atomic_test_and_clear_u8(volatile uint8_t *flag)
+{
+	uint8_t value;
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		value = *flag;
+		*flag = 0;
+	}
+	return value;
+}
+
+static inline uint16_t Atomic_test_and_clear_u16(volatile uint16_t *flag)
+{
+	uint16_t value;
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		value = *flag;
+		*flag = 0;
+	}
+	return value;
+}
+
+#endif // _ATOMIC_H_
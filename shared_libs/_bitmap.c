@@ -0,0 +1,192 @@
+/*
+ * _bitmap.c - Bitmap and Sprite Blitter for Page-Organized Displays
+ * Part of Assembly → C → Python Learning Progression
+ *
+ * EDUCATIONAL OBJECTIVES:
+ * 1. Byte-wise blits: 8 pixels per write, shifted across page borders
+ * 2. Raster operations (OR/AND/XOR/copy/mask) as span masks
+ * 3. Streaming decompression: RLE is decoded byte by byte from flash,
+ *    no RAM copy of the image is ever made
+ *
+ * COST:
+ * Per image byte: one or two span callbacks (two when y is not a multiple
+ * of 8, copy/masked modes may need a clear and a set). Nothing per pixel.
+ */
+
+#include "_bitmap.h"
+
+/*
+ * Sequential reader for raw or RLE page data in flash
+ */
+typedef struct
+{
+	const uint8_t *p;
+	uint8_t format;
+	uint8_t left;   // Bytes left in the current RLE run
+	uint8_t repeat; // 1 = run of value, 0 = literal bytes
+	uint8_t value;
+} bitmap_reader_t;
+
+static void bitmap_reader_init(bitmap_reader_t *r, const uint8_t *data, uint8_t format)
+{
+	r->p = data;
+	r->format = format;
+	r->left = 0;
+}
+
+static uint8_t bitmap_next(bitmap_reader_t *r)
+{
+	uint8_t control;
+
+	if (r->format == BITMAP_RAW)
+	{
+		return pgm_read_byte(r->p++);
+	}
+
+	if (r->left == 0)
+	{
+		control = pgm_read_byte(r->p++);
+		if (control & 0x80)
+		{
+			r->repeat = 1;
+			r->left = control - 126;
+			r->value = pgm_read_byte(r->p++);
+		}
+		else
+		{
+			r->repeat = 0;
+			r->left = control + 1;
+		}
+	}
+	r->left--;
+	return r->repeat ? r->value : pgm_read_byte(r->p++);
+}
+
+/*
+ * One destination byte: bits = image pixels, keep = pixels the image covers
+ */
+static void bitmap_byte(const Raster_target_t *t, uint8_t page, uint8_t x, uint8_t bits, uint8_t keep, uint8_t mode)
+{
+	uint8_t clear = keep & (uint8_t)~bits;
+
+	switch (mode)
+	{
+	case BITMAP_OR:
+		if (bits)
+			t->span(page, x, x, bits, RASTER_SET);
+		break;
+	case BITMAP_XOR:
+		if (bits)
+			t->span(page, x, x, bits, RASTER_XOR);
+		break;
+	case BITMAP_AND:
+		if (clear)
+			t->span(page, x, x, clear, RASTER_CLEAR);
+		break;
+	default: // BITMAP_COPY
+		if (clear)
+			t->span(page, x, x, clear, RASTER_CLEAR);
+		if (bits)
+			t->span(page, x, x, bits, RASTER_SET);
+		break;
+	}
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Blit
+ *
+ * PURPOSE: Walk the source in storage order (page, then column) so RLE
+ *          streams decode in one pass; clipped bytes are read and dropped.
+ *          mask == 0: the image covers its whole rectangle.
+ */
+static void bitmap_blit(const Raster_target_t *t, int16_t x, int16_t y, uint8_t width, uint8_t height,
+						bitmap_reader_t *image, bitmap_reader_t *mask, uint8_t mode)
+{
+	uint8_t pages = (height + 7) >> 3;
+	uint8_t screen_pages = t->height >> 3;
+	uint8_t shift = y & 7;
+	int16_t page = (y - shift) / 8; // exact: also correct for y < 0
+	uint8_t sp, col, valid, bits, keep;
+	int16_t cx;
+
+	if ((x >= t->width) || (x + width <= 0) || (y >= t->height) || (y + height <= 0))
+	{
+		return;
+	}
+
+	for (sp = 0; sp < pages; sp++, page++)
+	{
+		valid = ((sp == pages - 1) && (height & 7)) ? (0xFF >> (8 - (height & 7))) : 0xFF;
+
+		for (col = 0, cx = x; col < width; col++, cx++)
+		{
+			bits = bitmap_next(image) & valid;
+			keep = mask ? (bitmap_next(mask) & valid) : valid;
+			bits &= keep;
+
+			if ((cx < 0) || (cx >= t->width))
+			{
+				continue;
+			}
+			if ((page >= 0) && (page < screen_pages))
+			{
+				bitmap_byte(t, (uint8_t)page, (uint8_t)cx, (uint8_t)(bits << shift), (uint8_t)(keep << shift), mode);
+			}
+			if (shift && (page + 1 >= 0) && (page + 1 < screen_pages))
+			{
+				bitmap_byte(t, (uint8_t)(page + 1), (uint8_t)cx, bits >> (8 - shift), keep >> (8 - shift), mode);
+			}
+		}
+
+		// Below the screen: nothing more to draw, the rest need not be decoded
+		if (page + 1 >= screen_pages)
+		{
+			break;
+		}
+	}
+}
+
+void Bitmap_blit(const Raster_target_t *t, int16_t x, int16_t y, uint8_t width, uint8_t height,
+				 const uint8_t *data, uint8_t format, uint8_t mode)
+{
+	bitmap_reader_t image;
+
+	bitmap_reader_init(&image, data, format);
+	bitmap_blit(t, x, y, width, height, &image, 0, mode);
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Draw Image
+ *
+ * PURPOSE: Image with BITMAP_HEADER, any format, any mode
+ */
+void Bitmap_draw(const Raster_target_t *t, int16_t x, int16_t y, const uint8_t *bmp, uint8_t mode)
+{
+	Bitmap_blit(t, x, y, pgm_read_byte(&bmp[0]), pgm_read_byte(&bmp[1]), &bmp[3], pgm_read_byte(&bmp[2]), mode);
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Transparent Sprite
+ *
+ * PURPOSE: Copy the image where the mask has 1 bits, leave the background
+ *          elsewhere. Image and mask must have the same size (formats may
+ *          differ: an RLE mask next to a raw image is fine).
+ */
+void Bitmap_draw_masked(const Raster_target_t *t, int16_t x, int16_t y, const uint8_t *bmp, const uint8_t *mask)
+{
+	bitmap_reader_t image, cover;
+
+	bitmap_reader_init(&image, &bmp[3], pgm_read_byte(&bmp[2]));
+	bitmap_reader_init(&cover, &mask[3], pgm_read_byte(&mask[2]));
+	bitmap_blit(t, x, y, pgm_read_byte(&bmp[0]), pgm_read_byte(&bmp[1]), &image, &cover, BITMAP_COPY);
+}
+
+uint8_t Bitmap_width(const uint8_t *bmp)
+{
+	return pgm_read_byte(&bmp[0]);
+}
+
+uint8_t Bitmap_height(const uint8_t *bmp)
+{
+	return pgm_read_byte(&bmp[1]);
+}
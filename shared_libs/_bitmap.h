@@ -0,0 +1,79 @@
+/*
+ * _bitmap.h - Bitmap and Sprite Blitter for Page-Organized Displays
+ * Educational Version for Assembly→C→Python Learning Progression
+ *
+ * PURPOSE:
+ * Copy PROGMEM images of any size to any pixel position through the same
+ * Raster_target_t as the shape primitives (_raster.h). Erasing a sprite is
+ * one more blit instead of redrawing the background pixel by pixel.
+ *
+ * IMAGE LAYOUT (same as the KS0108 display RAM and the fonts):
+ * One byte = 8 vertical pixels, bit 0 on top. Bytes are stored page by
+ * page (rows 0-7 of every column, then rows 8-15, ...). The last page of
+ * an image whose height is not a multiple of 8 uses only its low bits.
+ *
+ *   const uint8_t ball[] PROGMEM = {
+ *       BITMAP_HEADER(8, 8, BITMAP_RAW),
+ *       0x3C, 0x7E, 0xFF, 0xFF, 0xFF, 0xFF, 0x7E, 0x3C};
+ *
+ * RLE FORMAT (BITMAP_RLE, PackBits style, decoded during the blit):
+ *   control 0x00..0x7F: the next control+1 bytes are literal
+ *   control 0x80..0xFF: the next byte repeats control-126 times (2..129)
+ * Runs may cross page boundaries. Blank and solid areas of a full-screen
+ * image shrink from 1024 bytes to a few dozen.
+ *
+ * PAGE STRADDLING:
+ * At y = 8*page + s every image byte is split into (byte << s) on one
+ * page and (byte >> (8 - s)) on the next - two masked writes, no per-pixel
+ * work. y = multiple of 8 needs only one.
+ *
+ * MODES:
+ *   BITMAP_OR   set the image's 1 bits (draw on top)
+ *   BITMAP_AND  clear where the image has 0 bits
+ *   BITMAP_XOR  invert the image's 1 bits (drawing twice erases)
+ *   BITMAP_COPY image replaces the covered rectangle
+ *   Bitmap_draw_masked(): copy only where the mask has 1 bits
+ *                         (transparent sprite over any background)
+ *
+ * COORDINATES: x = column, y = row (as in _raster.h), clipped.
+ */
+
+#ifndef _BITMAP_H_
+#define _BITMAP_H_
+
+#include <stdint.h>
+#include <avr/pgmspace.h>
+#include "_raster.h"
+
+/*
+ * Image formats
+ */
+#define BITMAP_RAW 0
+#define BITMAP_RLE 1
+
+// First three bytes of every image: width, height (pixels), format
+#define BITMAP_HEADER(width, height, format) (width), (height), (format)
+
+/*
+ * Blit modes
+ */
+#define BITMAP_OR 0
+#define BITMAP_AND 1
+#define BITMAP_XOR 2
+#define BITMAP_COPY 3
+
+/*
+ * Images with header (PROGMEM)
+ */
+void Bitmap_draw(const Raster_target_t *t, int16_t x, int16_t y, const uint8_t *bmp, uint8_t mode);
+void Bitmap_draw_masked(const Raster_target_t *t, int16_t x, int16_t y, const uint8_t *bmp, const uint8_t *mask);
+uint8_t Bitmap_width(const uint8_t *bmp);
+uint8_t Bitmap_height(const uint8_t *bmp);
+
+/*
+ * Headerless page data (PROGMEM), e.g. for driver APIs with their own sizes
+ */
+void Bitmap_blit(const Raster_target_t *t, int16_t x, int16_t y, uint8_t width, uint8_t height,
+				 const uint8_t *data, uint8_t format, uint8_t mode);
+
+#endif // _BITMAP_H_
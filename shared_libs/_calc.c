@@ -0,0 +1,433 @@
+/*
+ * _calc.c - Expression Calculator Engine (Integer and Q16.16 Fixed Point)
+ * Part of Assembly → C → Python Learning Progression
+ *
+ * EDUCATIONAL OBJECTIVES:
+ * 1. Operator precedence without recursion (shunting-yard, two stacks)
+ * 2. Fixed-point arithmetic: Q16.16 multiply, divide and decimal input
+ * 3. Overflow detection before it happens, not after the value wrapped
+ * 4. Number formatting without sprintf() or division
+ *
+ * COST (see Keypad_Calculator_App demo 5 for measured cycles):
+ * Integer + - are a few dozen cycles with their checks, * needs one
+ * 32x32->64 bit multiply. The Q16.16 divide is one 32-bit division for
+ * the integer part plus 16 shift-subtract steps for the fraction,
+ * avoiding the much slower 64-bit library division.
+ */
+
+#include <avr/pgmspace.h>
+#include "_calc.h"
+
+#define CALC_INT_MAX 2147483647L
+#define CALC_INT_MIN (-CALC_INT_MAX - 1)
+#define CALC_OP_NEGATE 'n' // unary minus on the operator stack
+
+/*
+ * Evaluation State (lives on the caller's stack)
+ */
+typedef struct
+{
+	int32_t value[CALC_STACK_DEPTH];
+	char op[CALC_STACK_DEPTH];
+	uint8_t values;
+	uint8_t ops;
+	uint8_t mode;
+} Calc_stack_t;
+
+static const uint32_t calc_powers[] PROGMEM = {
+	1000000000UL, 100000000UL, 10000000UL, 1000000UL, 100000UL, 10000UL, 1000UL, 100UL, 10UL};
+
+#define CALC_POWER_1000 6 // index of 1000 in calc_powers
+
+static uint8_t calc_precedence(char op)
+{
+	if (op == CALC_OP_NEGATE)
+		return 3;
+	if ((op == '*') || (op == '/'))
+		return 2;
+	if ((op == '+') || (op == '-'))
+		return 1;
+	return 0; // '('
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Checked Arithmetic
+ *
+ * PURPOSE: Test the operands against the limits first. Signed overflow
+ *          is undefined behavior in C, so checking the wrapped result
+ *          afterwards is not allowed.
+ */
+static uint8_t calc_add(int32_t a, int32_t b, int32_t *r)
+{
+	if (((b > 0) && (a > CALC_INT_MAX - b)) || ((b < 0) && (a < CALC_INT_MIN - b)))
+		return CALC_ERR_OVERFLOW;
+	*r = a + b;
+	return CALC_OK;
+}
+
+static uint8_t calc_sub(int32_t a, int32_t b, int32_t *r)
+{
+	if (((b < 0) && (a > CALC_INT_MAX + b)) || ((b > 0) && (a < CALC_INT_MIN + b)))
+		return CALC_ERR_OVERFLOW;
+	*r = a - b;
+	return CALC_OK;
+}
+
+static uint8_t calc_mul(int32_t a, int32_t b, uint8_t mode, int32_t *r)
+{
+	int64_t p = (int64_t)a * b;
+
+	if (mode == CALC_MODE_FIXED)
+		p = (p + 0x8000) >> 16; // Q32.32 -> Q16.16, rounded
+	if ((p > CALC_INT_MAX) || (p < CALC_INT_MIN))
+		return CALC_ERR_OVERFLOW;
+	*r = (int32_t)p;
+	return CALC_OK;
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Q16.16 Division
+ *
+ * PURPOSE: (a << 16) / b without 64-bit arithmetic. The integer part is
+ *          an ordinary 32-bit division; each fraction bit is one step of
+ *          long division: double the remainder, subtract b if it fits.
+ *          "rem >= b - rem" tests 2 * rem >= b without overflowing.
+ */
+static uint8_t calc_div_fixed(int32_t a, int32_t b, int32_t *r)
+{
+	uint8_t negative = (a < 0) != (b < 0);
+	uint32_t ua = (a < 0) ? 0UL - (uint32_t)a : (uint32_t)a;
+	uint32_t ub = (b < 0) ? 0UL - (uint32_t)b : (uint32_t)b;
+	uint32_t q = ua / ub;
+	uint32_t rem = ua % ub;
+	uint8_t bit;
+
+	if (q > 0x8000UL)
+		return CALC_ERR_OVERFLOW;
+	for (bit = 0; bit < 16; bit++)
+	{
+		q <<= 1;
+		if (rem >= ub - rem)
+		{
+			rem -= ub - rem;
+			q |= 1;
+		}
+		else
+		{
+			rem <<= 1;
+		}
+	}
+	if (q > (negative ? 0x80000000UL : 0x7FFFFFFFUL))
+		return CALC_ERR_OVERFLOW;
+	*r = negative ? (int32_t)(0UL - q) : (int32_t)q;
+	return CALC_OK;
+}
+
+static uint8_t calc_div(int32_t a, int32_t b, uint8_t mode, int32_t *r)
+{
+	if (b == 0)
+		return CALC_ERR_DIV_ZERO;
+	if (mode == CALC_MODE_FIXED)
+		return calc_div_fixed(a, b, r);
+	if ((a == CALC_INT_MIN) && (b == -1))
+		return CALC_ERR_OVERFLOW;
+	*r = a / b;
+	return CALC_OK;
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Apply One Operator
+ *
+ * PURPOSE: Pop the operands, push the result (in place of the first).
+ */
+static uint8_t calc_apply(Calc_stack_t *s, char op)
+{
+	int32_t a, b;
+	int32_t *top;
+
+	if (op == CALC_OP_NEGATE)
+	{
+		if (s->values < 1)
+			return CALC_ERR_SYNTAX;
+		top = &s->value[s->values - 1];
+		if (*top == CALC_INT_MIN)
+			return CALC_ERR_OVERFLOW;
+		*top = -*top;
+		return CALC_OK;
+	}
+
+	if (s->values < 2)
+		return CALC_ERR_SYNTAX;
+	b = s->value[--s->values];
+	top = &s->value[s->values - 1];
+	a = *top;
+
+	switch (op)
+	{
+	case '+':
+		return calc_add(a, b, top);
+	case '-':
+		return calc_sub(a, b, top);
+	case '*':
+		return calc_mul(a, b, s->mode, top);
+	default:
+		return calc_div(a, b, s->mode, top);
+	}
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Read a Number
+ *
+ * PURPOSE: Decimal digits with a range check per digit. Both limits
+ *          (32767 and 2147483647) end in 7, so "whole > limit / 10, or
+ *          equal and digit > 7" catches the overflow before it happens.
+ *          FIXED mode converts up to 4 decimals: frac * 65536 / 10^n.
+ */
+static uint8_t calc_parse_number(const char **text, uint8_t mode, int32_t *value)
+{
+	const char *p = *text;
+	uint32_t tenth = (mode == CALC_MODE_FIXED) ? 3276UL : 214748364UL;
+	uint32_t whole = 0;
+	uint32_t frac = 0;
+	uint32_t scale = 1;
+	uint8_t digits = 0;
+	uint8_t digit;
+
+	for (; (*p >= '0') && (*p <= '9'); p++, digits++)
+	{
+		digit = *p - '0';
+		if ((whole > tenth) || ((whole == tenth) && (digit > 7)))
+			return CALC_ERR_OVERFLOW;
+		whole = whole * 10 + digit;
+	}
+
+	if (*p == '.')
+	{
+		if (mode != CALC_MODE_FIXED)
+			return CALC_ERR_SYNTAX;
+		for (p++; (*p >= '0') && (*p <= '9'); p++, digits++)
+		{
+			if (scale < 10000UL) // further decimals are below the resolution
+			{
+				frac = frac * 10 + (*p - '0');
+				scale *= 10;
+			}
+		}
+	}
+	if (!digits)
+		return CALC_ERR_SYNTAX; // a lone '.'
+
+	if (mode == CALC_MODE_FIXED)
+		*value = (int32_t)((whole << 16) + ((frac << 16) + scale / 2) / scale);
+	else
+		*value = (int32_t)whole;
+	*text = p;
+	return CALC_OK;
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Evaluate an Expression
+ *
+ * PURPOSE: Shunting-yard in one pass. expect_operand tells a unary sign
+ *          from a binary operator and finds missing operands.
+ * RETURNS: CALC_OK and *result, or a CALC_ERR_* code (*result unchanged)
+ */
+uint8_t Calc_eval(const char *expr, uint8_t mode, int32_t *result)
+{
+	Calc_stack_t s;
+	uint8_t expect_operand = 1;
+	uint8_t err;
+	int32_t number;
+	char c;
+
+	s.values = 0;
+	s.ops = 0;
+	s.mode = mode;
+
+	while ((c = *expr) != '\0')
+	{
+		if (c == ' ')
+		{
+			expr++;
+		}
+		else if (((c >= '0') && (c <= '9')) || (c == '.'))
+		{
+			if (!expect_operand)
+				return CALC_ERR_SYNTAX;
+			if ((err = calc_parse_number(&expr, mode, &number)) != CALC_OK)
+				return err;
+			if (s.values >= CALC_STACK_DEPTH)
+				return CALC_ERR_DEPTH;
+			s.value[s.values++] = number;
+			expect_operand = 0;
+		}
+		else if (c == '(')
+		{
+			if (!expect_operand)
+				return CALC_ERR_SYNTAX;
+			if (s.ops >= CALC_STACK_DEPTH)
+				return CALC_ERR_DEPTH;
+			s.op[s.ops++] = '(';
+			expr++;
+		}
+		else if (c == ')')
+		{
+			if (expect_operand)
+				return CALC_ERR_SYNTAX;
+			while (s.ops && (s.op[s.ops - 1] != '('))
+			{
+				if ((err = calc_apply(&s, s.op[--s.ops])) != CALC_OK)
+					return err;
+			}
+			if (!s.ops)
+				return CALC_ERR_PAREN;
+			s.ops--; // the '('
+			expr++;
+		}
+		else if ((c == '+') || (c == '-') || (c == '*') || (c == '/'))
+		{
+			if (expect_operand)
+			{
+				// sign: '-' waits for its operand, '+' changes nothing
+				if ((c == '*') || (c == '/'))
+					return CALC_ERR_SYNTAX;
+				if (c == '-')
+				{
+					if (s.ops >= CALC_STACK_DEPTH)
+						return CALC_ERR_DEPTH;
+					s.op[s.ops++] = CALC_OP_NEGATE;
+				}
+			}
+			else
+			{
+				// left to right: first apply what binds at least as tightly
+				while (s.ops && (calc_precedence(s.op[s.ops - 1]) >= calc_precedence(c)))
+				{
+					if ((err = calc_apply(&s, s.op[--s.ops])) != CALC_OK)
+						return err;
+				}
+				if (s.ops >= CALC_STACK_DEPTH)
+					return CALC_ERR_DEPTH;
+				s.op[s.ops++] = c;
+				expect_operand = 1;
+			}
+			expr++;
+		}
+		else
+		{
+			return CALC_ERR_SYNTAX;
+		}
+	}
+
+	if (expect_operand)
+		return CALC_ERR_SYNTAX; // empty, or ends with an operator
+	while (s.ops)
+	{
+		c = s.op[--s.ops];
+		if (c == '(')
+			return CALC_ERR_PAREN;
+		if ((err = calc_apply(&s, c)) != CALC_OK)
+			return err;
+	}
+	if (s.values != 1)
+		return CALC_ERR_SYNTAX;
+
+	*result = s.value[0];
+	return CALC_OK;
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Digits by Subtraction
+ *
+ * PURPOSE: Count how often each power of ten fits, starting at
+ *          calc_powers[first]. At most 9 subtractions per digit, no
+ *          division. keep_zeros writes leading zeros too (fractions).
+ */
+static uint8_t calc_digits(uint32_t n, uint8_t first, uint8_t keep_zeros, char *buf)
+{
+	uint8_t len = 0;
+	uint8_t i;
+	uint32_t power;
+	char digit;
+
+	for (i = first; i < sizeof(calc_powers) / sizeof(calc_powers[0]); i++)
+	{
+		power = pgm_read_dword(&calc_powers[i]);
+		digit = '0';
+		while (n >= power)
+		{
+			n -= power;
+			digit++;
+		}
+		if (len || keep_zeros || (digit != '0'))
+			buf[len++] = digit;
+	}
+	buf[len++] = '0' + (char)n;
+	return len;
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Format a Result
+ *
+ * PURPOSE: INT mode prints the integer. FIXED mode rounds to 4 decimals
+ *          and drops trailing zeros: 3.125, 2, -0.5.
+ * RETURNS: String length (buf is '\0' terminated)
+ */
+uint8_t Calc_format(int32_t value, uint8_t mode, char *buf)
+{
+	char *p = buf;
+	uint32_t magnitude = (value < 0) ? 0UL - (uint32_t)value : (uint32_t)value;
+	uint32_t whole, frac;
+
+	if (value < 0)
+		*p++ = '-';
+
+	if (mode != CALC_MODE_FIXED)
+	{
+		p += calc_digits(magnitude, 0, 0, p);
+		*p = '\0';
+		return p - buf;
+	}
+
+	whole = magnitude >> 16;
+	frac = ((magnitude & 0xFFFFUL) * 10000UL + 0x8000UL) >> 16;
+	if (frac >= 10000UL)
+	{
+		whole++;
+		frac -= 10000UL;
+	}
+	if (!whole && !frac)
+		p = buf; // no "-0" for tiny negative values
+
+	p += calc_digits(whole, 0, 0, p);
+	if (frac)
+	{
+		*p++ = '.';
+		p += calc_digits(frac, CALC_POWER_1000, 1, p);
+		while (p[-1] == '0')
+			p--;
+	}
+	*p = '\0';
+	return p - buf;
+}
+
+const char *Calc_error_P(uint8_t error)
+{
+	switch (error)
+	{
+	case CALC_OK:
+		return PSTR("OK");
+	case CALC_ERR_SYNTAX:
+		return PSTR("Syntax error");
+	case CALC_ERR_PAREN:
+		return PSTR("Parenthesis");
+	case CALC_ERR_DIV_ZERO:
+		return PSTR("Divide by zero");
+	case CALC_ERR_OVERFLOW:
+		return PSTR("Overflow");
+	case CALC_ERR_DEPTH:
+		return PSTR("Too complex");
+	default:
+		return PSTR("Error");
+	}
+}
@@ -0,0 +1,65 @@
+/*
+ * _calc.h - Expression Calculator Engine (Integer and Q16.16 Fixed Point)
+ * Educational Version for Assembly→C→Python Learning Progression
+ *
+ * PURPOSE:
+ * Evaluate a whole typed expression instead of one "a op b" pair:
+ *
+ *   Calc_eval("(12+3)*-4/5", CALC_MODE_INT, &result)    -> -12
+ *   Calc_eval("2.5*(1.5-0.25)", CALC_MODE_FIXED, &result) -> 3.125 (Q16.16)
+ *
+ * GRAMMAR:
+ *   numbers   123, in FIXED mode also 1.25 (up to 4 decimals are used)
+ *   binary    + - (lowest), * / (higher), left to right
+ *   unary     - and + in front of a number or '('
+ *   groups    ( ... ), nested up to the stack depth
+ *   spaces are ignored
+ *
+ * PARSING (shunting-yard):
+ * One pass, no recursion: numbers go to a value stack, operators wait on
+ * an operator stack until an operator of lower or equal precedence (or
+ * ')' or the end) arrives, then they are applied to the top values.
+ * Memory is fixed: CALC_STACK_DEPTH entries on each stack, on the C stack
+ * of the caller (about 90 bytes), nothing static.
+ *
+ * ARITHMETIC:
+ *   CALC_MODE_INT    int32_t, division truncates toward zero
+ *   CALC_MODE_FIXED  Q16.16 in an int32_t: value = raw / 65536,
+ *                    range -32768 .. 32767.99998, resolution 0.000015
+ * Every operation checks its result; anything outside int32_t stops the
+ * evaluation with CALC_ERR_OVERFLOW instead of wrapping around.
+ *
+ * DISPLAY:
+ * Calc_format() converts without sprintf() and without 32-bit division:
+ * each digit is found by subtracting a power of ten from a PROGMEM table.
+ */
+
+#ifndef _CALC_H_
+#define _CALC_H_
+
+#include <stdint.h>
+
+#ifndef CALC_STACK_DEPTH
+#define CALC_STACK_DEPTH 16 // values / operators pending at once
+#endif
+
+#define CALC_MODE_INT 0
+#define CALC_MODE_FIXED 1
+
+#define CALC_FIXED_ONE 65536L // 1.0 in Q16.16
+#define CALC_FIXED_DECIMALS 4 // digits after the point that are parsed and shown
+#define CALC_FORMAT_SIZE 13   // "-2147483648" or "-32767.9999" plus '\0'
+
+// Result codes
+#define CALC_OK 0
+#define CALC_ERR_SYNTAX 1   // unexpected character, missing operand
+#define CALC_ERR_PAREN 2    // unbalanced parentheses
+#define CALC_ERR_DIV_ZERO 3
+#define CALC_ERR_OVERFLOW 4 // result or number outside the mode's range
+#define CALC_ERR_DEPTH 5    // more than CALC_STACK_DEPTH pending
+
+uint8_t Calc_eval(const char *expr, uint8_t mode, int32_t *result);
+uint8_t Calc_format(int32_t value, uint8_t mode, char *buf); // returns length, buf >= CALC_FORMAT_SIZE
+const char *Calc_error_P(uint8_t error);                      // message in PROGMEM (Lcd_puts_P)
+
+#endif // _CALC_H_
@@ -0,0 +1,480 @@
+/*
+ * _capture.c - ATmega128 Input Capture Timestamping Service
+ * Part of Assembly → C → Python Learning Progression
+ *
+ * EDUCATIONAL OBJECTIVES:
+ * 1. Understand hardware input capture (ICR latches TCNT at the edge)
+ * 2. Extend a 16-bit timer to 32 bits with an overflow counter
+ * 3. Resolve the "capture vs. overflow" race correctly
+ * 4. Measure period, frequency and duty cycle without CPU polling
+ *
+ * REGISTERS USED:
+ * - TCCR1B/TCCR3B: ICNCn (noise canceler), ICESn (edge select), CSn2:0
+ * - ICR1/ICR3: Captured counter value
+ * - TIMSK (TICIE1, TOIE1), ETIMSK (TICIE3, TOIE3): interrupt enables
+ * - TIFR (ICF1, TOV1), ETIFR (ICF3, TOV3): interrupt flags
+ * - SFIOR (TSM, PSR321): prescaler halt used to synchronize Timer1/Timer3
+ *   (only while Timer2 is stopped, see Capture_init)
+ *
+ * OVERFLOW RACE:
+ * TIMER1_CAPT has a higher vector priority than TIMER1_OVF. If the counter
+ * overflowed just before the edge, the capture ISR runs first and the
+ * overflow counter is one too small. A pending TOV flag together with a
+ * small captured value (below 0x8000) means the capture happened after
+ * the overflow, so the high word is incremented for this timestamp.
+ */
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include "_main.h"
+#include "_capture.h"
+#include "_spsc.h" // SPSC_BARRIER
+
+#if (CAPTURE_EVENT_RING_SIZE & (CAPTURE_EVENT_RING_SIZE - 1)) != 0
+#error "CAPTURE_EVENT_RING_SIZE must be a power of two"
+#endif
+
+#if CAPTURE_TICKS_PER_SECOND > 4294967UL
+#error "CAPTURE_TICKS_PER_SECOND too high for millihertz arithmetic"
+#endif
+
+#define CAPTURE_RING_MASK (CAPTURE_EVENT_RING_SIZE - 1)
+
+/*
+ * Per-Channel State
+ */
+typedef struct
+{
+	volatile uint16_t overflow_high; // Upper 16 bits of the timer
+	volatile uint8_t mode;			 // CAPTURE_EDGE_* (0xFF = disabled)
+	volatile uint32_t last_rise;	 // Timestamp of last rising edge
+	volatile uint32_t last_fall;	 // Timestamp of last falling edge
+	volatile uint32_t last_edge;	 // Timestamp of last edge of any kind
+	volatile uint32_t period;		 // Last measured period
+	volatile uint32_t high_time;	 // Last measured high time
+	volatile uint8_t have_reference; // A previous edge exists
+	Capture_event_t ring[CAPTURE_EVENT_RING_SIZE];
+	volatile uint8_t head; // Written by ISR only
+	volatile uint8_t tail; // Written by main program only
+	volatile uint16_t overruns;
+} Capture_channel_t;
+
+static Capture_channel_t channels[CAPTURE_CHANNELS] = {
+	{.mode = 0xFF},
+	{.mode = 0xFF}};
+
+static uint8_t clock_running = 0;
+
+/*
+ * EDUCATIONAL FUNCTION: Start Shared Clock
+ *
+ * PURPOSE: Run Timer1 free in normal mode at F_CPU/8 with overflow
+ *          interrupt, giving a 32-bit tick counter
+ */
+void Capture_clock_init(void)
+{
+	if (clock_running)
+	{
+		return;
+	}
+
+	unsigned char sreg_backup = SREG;
+	cli();
+
+	TCCR1A = 0x00;		   // Normal mode, output compare pins disconnected
+	TCCR1B = (1 << CS11);  // Prescaler 8
+	TCNT1 = 0;
+	channels[CAPTURE_CH1].overflow_high = 0;
+	TIFR = (1 << TOV1) | (1 << ICF1); // Clear stale flags (write one)
+	TIMSK |= (1 << TOIE1);
+	clock_running = 1;
+
+	SREG = sreg_backup;
+}
+
+/*
+ * Read a 32-bit timestamp of a running timer (interrupts must be off)
+ */
+static uint32_t capture_read_timer(uint16_t count, uint16_t high, uint8_t tov_pending)
+{
+	if (tov_pending && count < 0x8000)
+	{
+		high++; // Overflow happened but its ISR has not run yet
+	}
+	return ((uint32_t)high << 16) | count;
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Read Shared Clock
+ *
+ * RETURNS: Ticks (CAPTURE_TICKS_PER_US per microsecond) since clock start
+ */
+uint32_t Capture_get_ticks(void)
+{
+	unsigned char sreg_backup = SREG;
+	cli();
+
+	uint16_t count = TCNT1;
+	uint32_t ticks = capture_read_timer(count, channels[CAPTURE_CH1].overflow_high,
+										TIFR & (1 << TOV1));
+
+	SREG = sreg_backup;
+	return ticks;
+}
+
+uint32_t Capture_get_micros(void)
+{
+#if (CAPTURE_TICKS_PER_US * 1000000UL) == CAPTURE_TICKS_PER_SECOND
+	return Capture_get_ticks() / CAPTURE_TICKS_PER_US;
+#else
+	return (uint32_t)(((uint64_t)Capture_get_ticks() * 1000000UL) / CAPTURE_TICKS_PER_SECOND);
+#endif
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Enable Capture Channel
+ *
+ * PARAMETERS:
+ *   channel        - CAPTURE_CH1 (ICP1/PD4) or CAPTURE_CH3 (ICP3/PE7)
+ *   edge_mode      - CAPTURE_EDGE_RISING, _FALLING or _BOTH
+ *   noise_canceler - 1 = require 4 equal samples (adds 4 CPU clocks delay)
+ *
+ * NOTE: Channel 3 is synchronized to Timer1 so both channels share one
+ *       time base. Timer1, Timer2 and Timer3 share one prescaler, and
+ *       TSM/PSR321 halts and resets all three. That would make the Timer2
+ *       system_milliseconds clock drift, so the halt is only used while
+ *       Timer2 is stopped. Otherwise TCNT1 is copied on the fly and
+ *       Timer3 may lag by one count (8 CPU clocks, about 1 us).
+ */
+void Capture_init(uint8_t channel, uint8_t edge_mode, uint8_t noise_canceler)
+{
+	if (channel >= CAPTURE_CHANNELS)
+	{
+		return;
+	}
+
+	Capture_clock_init();
+
+	unsigned char sreg_backup = SREG;
+	cli();
+
+	Capture_channel_t *ch = &channels[channel];
+	ch->mode = edge_mode;
+	ch->have_reference = 0;
+	ch->period = 0;
+	ch->high_time = 0;
+	ch->head = 0;
+	ch->tail = 0;
+	ch->overruns = 0;
+
+	uint8_t control = (1 << CS11); // CS11 and CS31 are the same bit
+	if (noise_canceler)
+	{
+		control |= (1 << ICNC1);
+	}
+	if (edge_mode != CAPTURE_EDGE_FALLING)
+	{
+		control |= (1 << ICES1); // Rising first (also for BOTH)
+	}
+
+	if (channel == CAPTURE_CH1)
+	{
+		DDRD &= ~(1 << PD4); // ICP1 as input
+		TCCR1B = control;
+		TIFR = (1 << ICF1);
+		TIMSK |= (1 << TICIE1);
+	}
+	else
+	{
+		DDRE &= ~(1 << PE7); // ICP3 as input
+
+		/* Halt prescaler (not when it also clocks Timer2), copy Timer1
+		 * state to Timer3, release */
+		uint8_t halt = !(TCCR2 & ((1 << CS22) | (1 << CS21) | (1 << CS20)));
+		if (halt)
+		{
+			SFIOR |= (1 << TSM) | (1 << PSR321);
+		}
+		TCCR3A = 0x00;
+		TCCR3B = control;
+		TCNT3 = TCNT1;
+		ch->overflow_high = channels[CAPTURE_CH1].overflow_high;
+		if ((TIFR & (1 << TOV1)) && TCNT1 < 0x8000)
+		{
+			ch->overflow_high++;
+		}
+		ETIFR = (1 << ICF3) | (1 << TOV3);
+		if (halt)
+		{
+			SFIOR &= ~(1 << TSM);
+		}
+
+		ETIMSK |= (1 << TICIE3) | (1 << TOIE3);
+	}
+
+	SREG = sreg_backup;
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Disable Capture Channel
+ * NOTE: Timer1 keeps running as the shared clock
+ */
+void Capture_stop(uint8_t channel)
+{
+	unsigned char sreg_backup = SREG;
+	cli();
+
+	if (channel == CAPTURE_CH1)
+	{
+		TIMSK &= ~(1 << TICIE1);
+	}
+	else if (channel == CAPTURE_CH3)
+	{
+		ETIMSK &= ~((1 << TICIE3) | (1 << TOIE3));
+		TCCR3B = 0x00;
+	}
+	if (channel < CAPTURE_CHANNELS)
+	{
+		channels[channel].mode = 0xFF;
+	}
+
+	SREG = sreg_backup;
+}
+
+/*
+ * Common capture processing (runs inside the capture ISRs)
+ */
+static void capture_record(uint8_t channel, uint32_t timestamp, uint8_t edge)
+{
+	Capture_channel_t *ch = &channels[channel];
+
+	if (ch->have_reference)
+	{
+		if (edge == CAPTURE_EDGE_RISING)
+		{
+			if (ch->mode != CAPTURE_EDGE_FALLING)
+			{
+				ch->period = timestamp - ch->last_rise;
+			}
+		}
+		else
+		{
+			if (ch->mode == CAPTURE_EDGE_FALLING)
+			{
+				ch->period = timestamp - ch->last_fall;
+			}
+			else
+			{
+				ch->high_time = timestamp - ch->last_rise;
+			}
+		}
+	}
+
+	if (edge == CAPTURE_EDGE_RISING)
+	{
+		ch->last_rise = timestamp;
+		ch->have_reference = 1;
+	}
+	else
+	{
+		ch->last_fall = timestamp;
+		if (ch->mode == CAPTURE_EDGE_FALLING)
+		{
+			ch->have_reference = 1;
+		}
+	}
+	ch->last_edge = timestamp;
+
+	/* Event ring: ISR owns head, main program owns tail */
+	uint8_t head = ch->head;
+	if ((uint8_t)(head - ch->tail) < CAPTURE_EVENT_RING_SIZE)
+	{
+		Capture_event_t *event = &ch->ring[head & CAPTURE_RING_MASK];
+		event->timestamp = timestamp;
+		event->channel = channel;
+		event->edge = edge;
+		SPSC_BARRIER(); // slot written before it is published
+		ch->head = head + 1;
+	}
+	else
+	{
+		ch->overruns++;
+	}
+}
+
+/*
+ * Interrupt Service Routines
+ */
+ISR(TIMER1_OVF_vect)
+{
+	channels[CAPTURE_CH1].overflow_high++;
+}
+
+ISR(TIMER1_CAPT_vect)
+{
+	uint16_t icr = ICR1;
+	uint8_t edge = (TCCR1B & (1 << ICES1)) ? CAPTURE_EDGE_RISING : CAPTURE_EDGE_FALLING;
+	uint32_t timestamp = capture_read_timer(icr, channels[CAPTURE_CH1].overflow_high,
+											TIFR & (1 << TOV1));
+
+	if (channels[CAPTURE_CH1].mode == CAPTURE_EDGE_BOTH)
+	{
+		TCCR1B ^= (1 << ICES1); // Wait for the opposite edge next
+		TIFR = (1 << ICF1);		// Edge change may set ICF1 spuriously
+	}
+
+	capture_record(CAPTURE_CH1, timestamp, edge);
+}
+
+ISR(TIMER3_OVF_vect)
+{
+	channels[CAPTURE_CH3].overflow_high++;
+}
+
+ISR(TIMER3_CAPT_vect)
+{
+	uint16_t icr = ICR3;
+	uint8_t edge = (TCCR3B & (1 << ICES3)) ? CAPTURE_EDGE_RISING : CAPTURE_EDGE_FALLING;
+	uint32_t timestamp = capture_read_timer(icr, channels[CAPTURE_CH3].overflow_high,
+											ETIFR & (1 << TOV3));
+
+	if (channels[CAPTURE_CH3].mode == CAPTURE_EDGE_BOTH)
+	{
+		TCCR3B ^= (1 << ICES3);
+		ETIFR = (1 << ICF3);
+	}
+
+	capture_record(CAPTURE_CH3, timestamp, edge);
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Read Next Edge Event
+ *
+ * RETURNS: 1 if an event was copied, 0 if the ring is empty
+ * LEARNING: Index-only ring - no interrupt disabling needed
+ */
+uint8_t Capture_get_event(uint8_t channel, Capture_event_t *event)
+{
+	if (channel >= CAPTURE_CHANNELS)
+	{
+		return 0;
+	}
+
+	Capture_channel_t *ch = &channels[channel];
+	uint8_t tail = ch->tail;
+
+	if (tail == ch->head)
+	{
+		return 0;
+	}
+
+	*event = ch->ring[tail & CAPTURE_RING_MASK];
+	SPSC_BARRIER(); // slot copied before it is released
+	ch->tail = tail + 1;
+	return 1;
+}
+
+uint8_t Capture_events_pending(uint8_t channel)
+{
+	if (channel >= CAPTURE_CHANNELS)
+	{
+		return 0;
+	}
+	return (uint8_t)(channels[channel].head - channels[channel].tail);
+}
+
+uint16_t Capture_get_overruns(uint8_t channel)
+{
+	uint16_t overruns = 0;
+
+	if (channel < CAPTURE_CHANNELS)
+	{
+		unsigned char sreg_backup = SREG;
+		cli();
+		overruns = channels[channel].overruns;
+		SREG = sreg_backup;
+	}
+	return overruns;
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Period and High Time
+ *
+ * PURPOSE: Atomic copies of the 32-bit values maintained by the ISR.
+ *          Both return 0 if no edge was seen for CAPTURE_SIGNAL_TIMEOUT_TICKS
+ *          (stopped signal), so a stale measurement is never reported.
+ */
+static uint32_t capture_read_measurement(uint8_t channel, uint8_t high_time)
+{
+	if (channel >= CAPTURE_CHANNELS)
+	{
+		return 0;
+	}
+
+	uint32_t now = Capture_get_ticks();
+
+	unsigned char sreg_backup = SREG;
+	cli();
+	uint32_t value = high_time ? channels[channel].high_time : channels[channel].period;
+	uint32_t last_edge = channels[channel].last_edge;
+	uint8_t valid = channels[channel].have_reference;
+	SREG = sreg_backup;
+
+	if (!valid || (now - last_edge) > CAPTURE_SIGNAL_TIMEOUT_TICKS)
+	{
+		return 0;
+	}
+	return value;
+}
+
+uint32_t Capture_get_period_ticks(uint8_t channel)
+{
+	return capture_read_measurement(channel, 0);
+}
+
+uint32_t Capture_get_high_ticks(uint8_t channel)
+{
+	return capture_read_measurement(channel, 1);
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Frequency in Millihertz
+ *
+ * CALCULATION: f = ticks_per_second / period_ticks
+ * Millihertz keeps three decimals without floating point:
+ *   1000 Hz -> 1000000, 0.5 Hz -> 500
+ */
+uint32_t Capture_get_frequency_mhz(uint8_t channel)
+{
+	uint32_t period = Capture_get_period_ticks(channel);
+
+	if (period == 0)
+	{
+		return 0;
+	}
+	return (CAPTURE_TICKS_PER_SECOND * 1000UL) / period;
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Duty Cycle
+ *
+ * RETURNS: High time as permille of period (BOTH edge mode only)
+ */
+uint16_t Capture_get_duty_permille(uint8_t channel)
+{
+	uint32_t period = Capture_get_period_ticks(channel);
+	uint32_t high = Capture_get_high_ticks(channel);
+
+	if (period == 0 || high > period)
+	{
+		return 0;
+	}
+
+	/* Scale down long periods first so high * 1000 fits in 32 bits */
+	while (period > 4000000UL)
+	{
+		period >>= 1;
+		high >>= 1;
+	}
+	return (uint16_t)((high * 1000UL) / period);
+}
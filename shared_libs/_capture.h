@@ -0,0 +1,93 @@
+/*
+ * _capture.h - ATmega128 Input Capture Timestamping Service Header
+ * Educational Version for Assembly→C→Python Learning Progression
+ *
+ * PURPOSE:
+ * Hardware timestamps for digital edges using the 16-bit Timer1 (ICP1/PD4)
+ * and Timer3 (ICP3/PE7) input capture units. The counter value is latched
+ * by hardware at the edge, so the timestamp does not depend on interrupt
+ * latency. A software overflow counter extends the timers to 32 bits.
+ *
+ * TIME BASE:
+ * F_CPU / 8 -> 0.5us per tick at 16MHz (CAPTURE_TICKS_PER_US = 2)
+ * 32-bit range: about 35 minutes before the timestamp wraps
+ *
+ * SHARED CLOCK:
+ * Capture_clock_init() starts Timer1 free-running. Capture_get_ticks() is
+ * then available as a system-wide sub-microsecond clock, even if no
+ * capture channel is enabled.
+ *
+ * RESOURCES USED:
+ * Timer1 (and Timer3 when channel 3 is enabled) in normal mode; their
+ * CAPT and OVF vectors are defined in _capture.c.
+ */
+
+#ifndef _CAPTURE_H_
+#define _CAPTURE_H_
+
+#include <stdint.h>
+
+#ifndef F_CPU
+#define F_CPU 16000000UL
+#endif
+
+/*
+ * Time Base Configuration
+ */
+#define CAPTURE_PRESCALER 8
+#define CAPTURE_TICKS_PER_US (F_CPU / CAPTURE_PRESCALER / 1000000UL)
+#define CAPTURE_TICKS_PER_SECOND (F_CPU / CAPTURE_PRESCALER)
+
+/*
+ * Channels and Edge Modes
+ */
+#define CAPTURE_CH1 0 // Timer1, ICP1 = PD4
+#define CAPTURE_CH3 1 // Timer3, ICP3 = PE7
+#define CAPTURE_CHANNELS 2
+
+#define CAPTURE_EDGE_FALLING 0
+#define CAPTURE_EDGE_RISING 1
+#define CAPTURE_EDGE_BOTH 2
+
+#define CAPTURE_EVENT_RING_SIZE 16 // Events buffered per channel (power of two)
+#define CAPTURE_SIGNAL_TIMEOUT_TICKS (CAPTURE_TICKS_PER_SECOND / 2) // No edge -> 0 Hz
+
+/*
+ * Edge Event Record
+ */
+typedef struct
+{
+	uint32_t timestamp; // Capture time in ticks (shared clock)
+	uint8_t channel;    // CAPTURE_CH1 / CAPTURE_CH3
+	uint8_t edge;       // CAPTURE_EDGE_RISING / CAPTURE_EDGE_FALLING
+} Capture_event_t;
+
+/*
+ * Clock Functions
+ */
+void Capture_clock_init(void);      // Start 32-bit shared clock on Timer1
+uint32_t Capture_get_ticks(void);   // Current time in ticks
+uint32_t Capture_get_micros(void);  // Current time in microseconds
+
+/*
+ * Channel Control
+ */
+void Capture_init(uint8_t channel, uint8_t edge_mode, uint8_t noise_canceler);
+void Capture_stop(uint8_t channel);
+
+/*
+ * Event Ring (one producer ISR per channel, consumer = main program)
+ */
+uint8_t Capture_get_event(uint8_t channel, Capture_event_t *event); // 1 if event copied
+uint8_t Capture_events_pending(uint8_t channel);
+uint16_t Capture_get_overruns(uint8_t channel);                    // Events lost (ring full)
+
+/*
+ * Measurement API (updated in the ISR on every edge)
+ */
+uint32_t Capture_get_period_ticks(uint8_t channel);   // Rising-to-rising (or edge-to-edge)
+uint32_t Capture_get_high_ticks(uint8_t channel);     // Rising-to-falling (BOTH mode)
+uint32_t Capture_get_frequency_mhz(uint8_t channel);  // Frequency in millihertz (0 = no signal)
+uint16_t Capture_get_duty_permille(uint8_t channel);  // High time / period (BOTH mode)
+
+#endif // _CAPTURE_H_
@@ -0,0 +1,280 @@
+/*
+ * _chart.c - Hardware-Scrolled Strip Chart for the KS0108 GLCD
+ * Part of Assembly → C → Python Learning Progression
+ *
+ * EDUCATIONAL OBJECTIVES:
+ * 1. Scroll with the display start line instead of copying pixels
+ * 2. Ring buffer thinking: the RAM row that scrolls off the top is reused
+ *    for the newest row at the bottom
+ * 3. Fixed-point scaling: 16.16 multiply instead of a division per sample
+ * 4. Min/max decimation for sample rates above the row rate
+ */
+
+#include <string.h>
+#include "_chart.h"
+#include "_glcd.h"
+
+#define CHART_WIDTH 128
+#define CHART_ROWS 64
+
+typedef struct
+{
+	int16_t lo, hi;                // value range mapped to columns 0..127
+	uint32_t scale;                // columns per value unit, 16.16 fixed point
+	uint8_t autoscale;             // 1 = follow the data
+	uint8_t empty;                 // 1 = no sample seen yet
+	int16_t seen_lo, seen_hi;      // values during the current screen
+	int16_t block_min, block_max;  // decimation block
+	int16_t last;                  // newest sample
+	uint8_t last_col;              // column of the previous row's last sample
+} chart_trace_t;
+
+static chart_trace_t chart_traces[CHART_MAX_TRACES];
+static uint8_t chart_trace_count;
+static uint8_t chart_decimation;
+static uint8_t chart_block;
+static uint8_t chart_top;  // RAM row at the top of the panel = next row to reuse
+static uint16_t chart_rows;
+
+// Span of each trace in each RAM row (lo > hi: nothing drawn)
+static uint8_t chart_row_lo[CHART_ROWS][CHART_MAX_TRACES];
+static uint8_t chart_row_hi[CHART_ROWS][CHART_MAX_TRACES];
+
+static void chart_set_scale(chart_trace_t *tr, int16_t lo, int16_t hi)
+{
+	uint16_t span;
+
+	if (hi <= lo)
+	{
+		hi = lo + 1;
+	}
+	span = (uint16_t)(hi - lo);
+	tr->lo = lo;
+	tr->hi = hi;
+	tr->scale = ((uint32_t)(CHART_WIDTH - 1) << 16) / span;
+}
+
+// widen the range around a value with 1/8 headroom, so it does not grow every row
+static void chart_grow(chart_trace_t *tr, int16_t lo, int16_t hi)
+{
+	int16_t margin = (int16_t)(((int32_t)hi - lo) >> 3) + 1;
+
+	lo = ((int32_t)lo - margin < INT16_MIN) ? INT16_MIN : lo - margin;
+	hi = ((int32_t)hi + margin > INT16_MAX) ? INT16_MAX : hi + margin;
+	chart_set_scale(tr, lo, hi);
+}
+
+static uint8_t chart_column(const chart_trace_t *tr, int16_t value)
+{
+	uint32_t col;
+
+	if (value <= tr->lo)
+	{
+		return 0;
+	}
+	if (value >= tr->hi)
+	{
+		return CHART_WIDTH - 1;
+	}
+	col = ((uint32_t)(uint16_t)(value - tr->lo) * tr->scale) >> 16;
+	return (uint8_t)col;
+}
+
+void Chart_set_range(uint8_t trace, int16_t lo, int16_t hi)
+{
+	if (trace < CHART_MAX_TRACES)
+	{
+		chart_traces[trace].autoscale = 0;
+		chart_set_scale(&chart_traces[trace], lo, hi);
+	}
+}
+
+void Chart_set_autoscale(uint8_t trace)
+{
+	if (trace < CHART_MAX_TRACES)
+	{
+		chart_traces[trace].autoscale = 1;
+		chart_traces[trace].empty = 1;
+	}
+}
+
+void Chart_init(uint8_t traces, uint8_t decimation)
+{
+	uint8_t i;
+
+	chart_trace_count = (traces > CHART_MAX_TRACES) ? CHART_MAX_TRACES : traces;
+	chart_decimation = decimation ? decimation : 1;
+	chart_block = 0;
+	chart_top = 0;
+	chart_rows = 0;
+
+	for (i = 0; i < CHART_MAX_TRACES; i++)
+	{
+		chart_set_scale(&chart_traces[i], 0, 1023); // ADC range until set otherwise
+		Chart_set_autoscale(i);
+	}
+	memset(chart_row_lo, 0xFF, sizeof(chart_row_lo));
+	memset(chart_row_hi, 0x00, sizeof(chart_row_hi));
+
+	lcd_clear(); // blank panel and ScreenBuffer
+	GLCD_Set_start_line(0);
+}
+
+// send a trace's old and new span: once if they touch, else both
+static void chart_send(uint8_t page, uint8_t old_lo, uint8_t old_hi, uint8_t new_lo, uint8_t new_hi)
+{
+	if (old_lo > old_hi)
+	{
+		GLCD_Flush_span(page, new_lo, new_hi);
+	}
+	else if ((old_lo <= new_hi + 1) && (new_lo <= old_hi + 1))
+	{
+		GLCD_Flush_span(page, (old_lo < new_lo) ? old_lo : new_lo, (old_hi > new_hi) ? old_hi : new_hi);
+	}
+	else
+	{
+		GLCD_Flush_span(page, old_lo, old_hi);
+		GLCD_Flush_span(page, new_lo, new_hi);
+	}
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Draw One Row
+ *
+ * PURPOSE: Reuse RAM row chart_top: erase what it showed one screen ago,
+ *          draw the new spans, send only those bytes, then move the start
+ *          line so this row becomes the bottom line of the panel.
+ */
+static void chart_draw_row(void)
+{
+	uint8_t row = chart_top;
+	uint8_t page = row >> 3;
+	uint8_t bit = 1 << (row & 7);
+	uint8_t old_lo[CHART_MAX_TRACES], old_hi[CHART_MAX_TRACES];
+	uint8_t t, c, c1, c2;
+	chart_trace_t *tr;
+
+	// 1. Erase the old content of this row (all traces before any new bit)
+	for (t = 0; t < chart_trace_count; t++)
+	{
+		old_lo[t] = chart_row_lo[row][t];
+		old_hi[t] = chart_row_hi[row][t];
+		for (c = old_lo[t]; (c <= old_hi[t]) && (c < CHART_WIDTH); c++)
+		{
+			ScreenBuffer[page][c] &= (uint8_t)~bit;
+		}
+	}
+
+	// 2. One span per trace: block min..max, joined to the previous row
+	for (t = 0; t < chart_trace_count; t++)
+	{
+		tr = &chart_traces[t];
+		if (tr->autoscale && ((tr->block_min < tr->lo) || (tr->block_max > tr->hi)))
+		{
+			chart_grow(tr, (tr->block_min < tr->lo) ? tr->block_min : tr->lo,
+					   (tr->block_max > tr->hi) ? tr->block_max : tr->hi);
+		}
+
+		c1 = chart_column(tr, tr->block_min);
+		c2 = chart_column(tr, tr->block_max);
+		if (chart_rows != 0)
+		{
+			if (tr->last_col < c1)
+				c1 = tr->last_col;
+			if (tr->last_col > c2)
+				c2 = tr->last_col;
+		}
+		tr->last_col = chart_column(tr, tr->last);
+
+		for (c = c1; c <= c2; c++)
+		{
+			ScreenBuffer[page][c] |= bit;
+		}
+		chart_row_lo[row][t] = c1;
+		chart_row_hi[row][t] = c2;
+	}
+
+	// 3. Send the changed bytes, then scroll by one line
+	for (t = 0; t < chart_trace_count; t++)
+	{
+		chart_send(page, old_lo[t], old_hi[t], chart_row_lo[row][t], chart_row_hi[row][t]);
+	}
+	chart_top = (chart_top + 1) & (CHART_ROWS - 1);
+	GLCD_Set_start_line(chart_top);
+	chart_rows++;
+
+	// 4. Every full screen: shrink autoscaled ranges to what was seen
+	if ((chart_rows & (CHART_ROWS - 1)) == 0)
+	{
+		for (t = 0; t < chart_trace_count; t++)
+		{
+			tr = &chart_traces[t];
+			if (tr->autoscale && !tr->empty)
+			{
+				chart_grow(tr, tr->seen_lo, tr->seen_hi);
+				tr->seen_lo = tr->seen_hi = tr->last;
+			}
+		}
+	}
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Add a Sample
+ *
+ * PURPOSE: Collect min/max over the decimation block, draw a row when the
+ *          block is complete. values[] holds one sample per trace.
+ */
+uint8_t Chart_sample(const int16_t *values)
+{
+	uint8_t t;
+	int16_t v;
+	chart_trace_t *tr;
+
+	for (t = 0; t < chart_trace_count; t++)
+	{
+		tr = &chart_traces[t];
+		v = values[t];
+
+		if (tr->empty) // first sample: centre an autoscaled range on it
+		{
+			tr->empty = 0;
+			tr->seen_lo = tr->seen_hi = v;
+			tr->last_col = 0;
+			if (tr->autoscale)
+			{
+				chart_grow(tr, v, v);
+			}
+		}
+		if (chart_block == 0)
+		{
+			tr->block_min = tr->block_max = v;
+		}
+		if (v < tr->block_min)
+			tr->block_min = v;
+		if (v > tr->block_max)
+			tr->block_max = v;
+		if (v < tr->seen_lo)
+			tr->seen_lo = v;
+		if (v > tr->seen_hi)
+			tr->seen_hi = v;
+		tr->last = v;
+	}
+
+	if (++chart_block < chart_decimation)
+	{
+		return 0;
+	}
+	chart_block = 0;
+	chart_draw_row();
+	return 1;
+}
+
+uint16_t Chart_rows(void)
+{
+	return chart_rows;
+}
+
+void Chart_stop(void)
+{
+	GLCD_Set_start_line(0);
+}
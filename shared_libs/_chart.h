@@ -0,0 +1,59 @@
+/*
+ * _chart.h - Hardware-Scrolled Strip Chart for the KS0108 GLCD
+ * Educational Version for Assembly→C→Python Learning Progression
+ *
+ * PURPOSE:
+ * Plot live samples (ADC, sensors) without redrawing the screen. The
+ * KS0108 "display start line" command chooses which RAM row appears at the
+ * top of the panel, so the picture can be scrolled by one command.
+ *
+ * LAYOUT (waterfall):
+ * The start line scrolls vertically only, so time runs from top to bottom
+ * and the value is the column (0..127). Each plotted row is a new RAM row;
+ * the newest row is always at the bottom of the panel.
+ *
+ *   top (oldest) +--------------------------------+
+ *                |      \                         |
+ *                |       |     trace 0            |
+ *                |      /         \ trace 1       |
+ *   bottom (new) +--------------------------------+
+ *                 column = value, row = time
+ *
+ * COST PER ROW:
+ * Only the bytes of each trace's new span and the span it replaces (the
+ * row that scrolled off) are sent, with GLCD_Flush_span(): one page and
+ * one column command, a few data bytes, plus one start line command. A
+ * slowly moving trace costs 4 to 12 bus writes per row, independent of
+ * screen size and of how far apart the traces are.
+ *
+ * DECIMATION:
+ * With decimation N, N samples are combined into one row drawn as a
+ * min..max span, so short spikes stay visible at any sample rate.
+ *
+ * SCALING:
+ * Each trace maps a fixed range (Chart_set_range) or autoscales: the range
+ * grows at once when a sample falls outside it and shrinks to the values
+ * seen during the last full screen. The mapping is one 32-bit multiply
+ * per row; the division happens only when the range changes.
+ *
+ * The chart owns the whole display while it runs (text and other drawing
+ * would scroll with it). Chart_stop() returns the panel to start line 0.
+ */
+
+#ifndef _CHART_H_
+#define _CHART_H_
+
+#include <stdint.h>
+
+#ifndef CHART_MAX_TRACES
+#define CHART_MAX_TRACES 2 // 128 bytes of span memory per trace
+#endif
+
+void Chart_init(uint8_t traces, uint8_t decimation); /* clears the screen */
+void Chart_set_range(uint8_t trace, int16_t lo, int16_t hi); /* after Chart_init: fixed scale */
+void Chart_set_autoscale(uint8_t trace);
+uint8_t Chart_sample(const int16_t *values); /* one value per trace; 1 = a row was drawn */
+uint16_t Chart_rows(void);                    /* rows drawn since Chart_init */
+void Chart_stop(void);
+
+#endif // _CHART_H_
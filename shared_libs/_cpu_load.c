@@ -0,0 +1,329 @@
+/*
+ * _cpu_load.c - ATmega128 CPU Load and Latency Monitor
+ * Part of Assembly → C → Python Learning Progression
+ *
+ * EDUCATIONAL OBJECTIVES:
+ * 1. Understand CPU utilization as active time versus idle time
+ * 2. Measure main loop latency instead of guessing it
+ * 3. See how much time each interrupt service routine consumes
+ * 4. Size sampling rates and baud rates from measured headroom
+ *
+ * MEASUREMENT PRINCIPLE:
+ * - Every timestamp comes from Timer2_get_ticks() (one TCNT2 count)
+ * - Idle time = time between CpuLoad_idle_enter() and CpuLoad_idle_exit()
+ *   minus the ISR time that ran while the CPU was "idle"
+ * - Active time = window length - idle time
+ * - Load (permille) = active time * 1000 / window length
+ *
+ * WINDOW HANDLING:
+ * Counters accumulate for 1 second and are then copied into a snapshot,
+ * so readers always see a complete, consistent window.
+ */
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/sleep.h>
+#include <stdio.h>
+#include <string.h>
+#include "_main.h"
+#include "_timer2.h"
+#include "_cpu_load.h"
+
+/*
+ * Accumulators for the window in progress
+ * ISR-side counters are updated inside interrupts, so the main program
+ * reads and clears them with interrupts disabled.
+ */
+static volatile unsigned long win_idle_ticks = 0;		   // Idle time in current window
+static volatile unsigned long win_isr_idle_ticks = 0;	   // ISR time that ran during idle
+static volatile unsigned long win_isr_ticks[CPU_LOAD_MAX_ISR];
+static volatile unsigned int win_isr_calls[CPU_LOAD_MAX_ISR];
+static volatile unsigned char in_idle = 0;				   // 1 while main program is idle
+static unsigned long window_start = 0;					   // Window start timestamp
+static unsigned long idle_start = 0;					   // Current idle section start
+static unsigned long loop_start = 0;					   // Current loop iteration start
+static unsigned int win_loop_count = 0;					   // Iterations in current window
+static unsigned long loop_max_ticks = 0;				   // Worst iteration since reset
+static unsigned long isr_total_ticks[CPU_LOAD_MAX_ISR];	   // Cumulative ISR time
+
+/* Snapshot of the last completed window */
+static CpuLoad_stats_t last_window;
+
+/*
+ * EDUCATIONAL FUNCTION: Safe Tick Difference
+ *
+ * PURPOSE: now - start with unsigned arithmetic wraps to ~4e9 if "now" is
+ *          ever behind "start"; such a reading counts as 0 ticks instead
+ *          of corrupting a whole window of statistics
+ */
+static unsigned long CpuLoad_elapsed(unsigned long now, unsigned long start)
+{
+	unsigned long elapsed = now - start;
+
+	if ((long)elapsed < 0)
+	{
+		return 0; // Clock behind the start mark
+	}
+	return elapsed;
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Close Window When 1 Second Has Elapsed
+ *
+ * PURPOSE: Move accumulated counters into the published snapshot
+ * LEARNING: Shows atomic hand-over of data shared with ISRs
+ */
+static void CpuLoad_update(unsigned long now)
+{
+	unsigned long elapsed = CpuLoad_elapsed(now, window_start);
+	unsigned char i;
+
+	if (elapsed < CPU_LOAD_WINDOW_TICKS)
+	{
+		return; // Window still open
+	}
+
+	unsigned char sreg_backup = SREG;
+	cli();
+
+	unsigned long idle = win_idle_ticks - win_isr_idle_ticks;
+	if (win_isr_idle_ticks > win_idle_ticks)
+	{
+		idle = 0;
+	}
+	for (i = 0; i < CPU_LOAD_MAX_ISR; i++)
+	{
+		last_window.isr_ticks[i] = win_isr_ticks[i];
+		last_window.isr_calls[i] = win_isr_calls[i];
+		isr_total_ticks[i] += win_isr_ticks[i];
+		last_window.isr_total_ticks[i] = isr_total_ticks[i];
+		win_isr_ticks[i] = 0;
+		win_isr_calls[i] = 0;
+	}
+	win_idle_ticks = 0;
+	win_isr_idle_ticks = 0;
+
+	SREG = sreg_backup;
+
+	if (idle > elapsed)
+	{
+		idle = elapsed;
+	}
+
+	last_window.idle_ticks = idle;
+	last_window.active_ticks = elapsed - idle;
+	/* Divide first: 1000 * ticks would overflow 32 bits for long windows */
+	last_window.load_permille = (unsigned int)(last_window.active_ticks / (elapsed / 1000UL));
+	if (last_window.load_permille > 1000)
+	{
+		last_window.load_permille = 1000;
+	}
+	last_window.loop_count = win_loop_count;
+	last_window.loop_max_ticks = loop_max_ticks;
+	last_window.windows++;
+
+	win_loop_count = 0;
+	window_start = now;
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Initialize Load Monitor
+ *
+ * PURPOSE: Clear all counters and start the first measurement window
+ * NOTE: Call after Timer2_init() so timestamps are advancing
+ */
+void CpuLoad_init(void)
+{
+	unsigned char sreg_backup = SREG;
+	cli();
+
+	win_idle_ticks = 0;
+	win_isr_idle_ticks = 0;
+	memset((void *)win_isr_ticks, 0, sizeof(win_isr_ticks));
+	memset((void *)win_isr_calls, 0, sizeof(win_isr_calls));
+	memset(isr_total_ticks, 0, sizeof(isr_total_ticks));
+	memset(&last_window, 0, sizeof(last_window));
+	in_idle = 0;
+	win_loop_count = 0;
+	loop_max_ticks = 0;
+
+	SREG = sreg_backup;
+
+	window_start = Timer2_get_ticks();
+	loop_start = window_start;
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Mark End of Main Loop Iteration
+ *
+ * PURPOSE: Track worst-case main loop latency (time between two marks)
+ * LEARNING: Latency of the loop = worst reaction time to a polled event
+ */
+void CpuLoad_loop_mark(void)
+{
+	unsigned long now = Timer2_get_ticks();
+	unsigned long iteration = CpuLoad_elapsed(now, loop_start);
+
+	if (iteration > loop_max_ticks)
+	{
+		loop_max_ticks = iteration;
+	}
+	loop_start = now;
+	win_loop_count++;
+
+	CpuLoad_update(now);
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Begin Idle Section
+ *
+ * PURPOSE: Mark the start of time the main program spends waiting
+ * USE CASE: Busy-wait loops that cannot use sleep mode
+ */
+void CpuLoad_idle_enter(void)
+{
+	idle_start = Timer2_get_ticks();
+	in_idle = 1;
+}
+
+/*
+ * EDUCATIONAL FUNCTION: End Idle Section
+ *
+ * PURPOSE: Add the waited time to the idle counter of the current window
+ */
+void CpuLoad_idle_exit(void)
+{
+	unsigned long now = Timer2_get_ticks();
+
+	unsigned char sreg_backup = SREG;
+	cli();
+	in_idle = 0;
+	win_idle_ticks += CpuLoad_elapsed(now, idle_start);
+	SREG = sreg_backup;
+
+	CpuLoad_update(now);
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Sleep Until Next Interrupt
+ *
+ * PURPOSE: Idle hook for the main loop - stops the CPU core in IDLE sleep
+ *          mode (peripherals keep running) until any interrupt occurs
+ * NOTE: The Timer2 tick guarantees wake-up at least every 1ms
+ *
+ * ASSEMBLY EQUIVALENT:
+ *   SEI          ; Next instruction executes before any interrupt
+ *   SLEEP        ; So no wake-up event can be lost in between
+ */
+void CpuLoad_idle(void)
+{
+	CpuLoad_idle_enter();
+
+	set_sleep_mode(SLEEP_MODE_IDLE);
+	cli();
+	sleep_enable();
+	sei();
+	sleep_cpu();
+	sleep_disable();
+
+	CpuLoad_idle_exit();
+}
+
+/*
+ * EDUCATIONAL FUNCTION: ISR Entry Timestamp
+ *
+ * PURPOSE: Record ISR start time; keep the result in a local variable so
+ *          nested interrupts each measure their own duration
+ */
+unsigned long CpuLoad_isr_enter(void)
+{
+	return Timer2_get_ticks();
+}
+
+/*
+ * EDUCATIONAL FUNCTION: ISR Exit Accounting
+ *
+ * PURPOSE: Add this ISR's duration to its slot. Time spent in an ISR while
+ *          the main program was idle is active time, not idle time.
+ */
+void CpuLoad_isr_exit(unsigned char isr_id, unsigned long start_ticks)
+{
+	if (isr_id >= CPU_LOAD_MAX_ISR)
+	{
+		return;
+	}
+
+	unsigned char sreg_backup = SREG;
+	cli();
+
+	unsigned long duration = CpuLoad_elapsed(Timer2_get_ticks(), start_ticks);
+	win_isr_ticks[isr_id] += duration;
+	win_isr_calls[isr_id]++;
+	if (in_idle)
+	{
+		win_isr_idle_ticks += duration;
+	}
+
+	SREG = sreg_backup;
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Get Load Statistics
+ *
+ * PURPOSE: Copy the snapshot of the last completed 1 second window
+ */
+void CpuLoad_get_statistics(CpuLoad_stats_t *stats)
+{
+	*stats = last_window;
+	stats->loop_max_ticks = loop_max_ticks;
+}
+
+unsigned int CpuLoad_get_load_permille(void)
+{
+	return last_window.load_permille;
+}
+
+void CpuLoad_reset_peak(void)
+{
+	loop_max_ticks = 0;
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Format Telemetry Line
+ *
+ * PURPOSE: Build one machine-readable line for the serial telemetry channel
+ * FORMAT: $LOAD,<permille>,<loops>,<loop_max_us>,<isr0_us>,...,<isr7_us>\r\n
+ *
+ * RETURNS: Number of characters written (0 if buffer too small)
+ *
+ * EXAMPLE:
+ *   char line[96];
+ *   if (CpuLoad_format_report(line, sizeof(line)))
+ *       puts_USART1(line);
+ */
+unsigned char CpuLoad_format_report(char *buffer, unsigned char size)
+{
+	unsigned char i;
+	int length = snprintf(buffer, size, "$LOAD,%u,%u,%lu",
+						  last_window.load_permille,
+						  last_window.loop_count,
+						  TIMER2_TICKS_TO_US(loop_max_ticks));
+
+	for (i = 0; i < CPU_LOAD_MAX_ISR && length > 0 && length < size; i++)
+	{
+		length += snprintf(buffer + length, size - length, ",%lu",
+						   TIMER2_TICKS_TO_US(last_window.isr_ticks[i]));
+	}
+
+	if (length > 0 && length < size)
+	{
+		length += snprintf(buffer + length, size - length, "\r\n");
+	}
+
+	if (length <= 0 || length >= size)
+	{
+		buffer[0] = '\0';
+		return 0;
+	}
+	return (unsigned char)length;
+}
@@ -0,0 +1,92 @@
+/*
+ * _cpu_load.h - ATmega128 CPU Load and Latency Monitor Header
+ * Educational Version for Assembly→C→Python Learning Progression
+ *
+ * PURPOSE:
+ * Measures how busy the CPU really is. The main loop reports when it is
+ * idle (sleeping or waiting) and when each iteration ends; ISRs report
+ * their entry and exit. Every 1 second window the monitor publishes:
+ * - Load: active time versus idle time (0-1000 permille)
+ * - Worst-case main loop iteration time
+ * - Cumulative execution time per registered ISR
+ *
+ * TIME BASE:
+ * Timer2_get_ticks(): one TCNT2 count (TIMER2_PRESCALER / F_CPU, 4us at
+ * 16MHz, 8.68us at 7.3728MHz). Timer2_init() must be running and the
+ * application ISR(TIMER2_OVF_vect) must call Timer2_ovf_handler().
+ * Reports convert ticks with TIMER2_TICKS_TO_US().
+ */
+
+#ifndef _CPU_LOAD_H_
+#define _CPU_LOAD_H_
+
+#include "_timer2.h"
+
+/*
+ * Monitor Configuration
+ */
+#define CPU_LOAD_MAX_ISR 8 // Number of ISR slots tracked
+#define CPU_LOAD_WINDOW_TICKS ((unsigned long)TIMER2_INTERVAL_1SEC * TIMER2_1MS_TICKS) // 1000 system ticks (~1 second)
+
+/*
+ * ISR Slot Identifiers (pass to CpuLoad_isr_exit)
+ */
+#define CPU_LOAD_ISR_TIMER2 0 // TIMER2_OVF_vect (system tick)
+#define CPU_LOAD_ISR_INT0 1   // INT0_vect
+#define CPU_LOAD_ISR_INT1 2   // INT1_vect
+#define CPU_LOAD_ISR_UART_RX 3 // USART1_RX_vect
+#define CPU_LOAD_ISR_UART_TX 4 // USART1_UDRE_vect
+#define CPU_LOAD_ISR_ADC 5    // ADC_vect
+#define CPU_LOAD_ISR_USER0 6  // Application defined
+#define CPU_LOAD_ISR_USER1 7  // Application defined
+
+/*
+ * Statistics Snapshot (values of the last completed 1 second window)
+ */
+typedef struct
+{
+	unsigned int load_permille;                   // Active share of window (1000 = 100%)
+	unsigned long idle_ticks;                     // Idle time in window
+	unsigned long active_ticks;                   // Active time in window (incl. ISRs)
+	unsigned int loop_count;                      // Main loop iterations in window
+	unsigned long loop_max_ticks;                 // Worst iteration since last peak reset
+	unsigned long isr_ticks[CPU_LOAD_MAX_ISR];    // Time spent in each ISR in window
+	unsigned int isr_calls[CPU_LOAD_MAX_ISR];     // Calls of each ISR in window
+	unsigned long isr_total_ticks[CPU_LOAD_MAX_ISR]; // Cumulative ISR time since init
+	unsigned int windows;                         // Completed windows since init
+} CpuLoad_stats_t;
+
+/*
+ * Core Functions
+ */
+void CpuLoad_init(void);      // Reset all counters and start first window
+void CpuLoad_loop_mark(void); // Call once per main loop iteration
+
+/*
+ * Idle Accounting
+ */
+void CpuLoad_idle(void);       // Sleep (idle mode) until next interrupt, counted as idle
+void CpuLoad_idle_enter(void); // Mark start of a custom idle/wait section
+void CpuLoad_idle_exit(void);  // Mark end of a custom idle/wait section
+
+/*
+ * ISR Accounting - call from application ISRs:
+ *   ISR(TIMER2_OVF_vect)
+ *   {
+ *       unsigned long t = CpuLoad_isr_enter();
+ *       Timer2_ovf_handler();
+ *       CpuLoad_isr_exit(CPU_LOAD_ISR_TIMER2, t);
+ *   }
+ */
+unsigned long CpuLoad_isr_enter(void);
+void CpuLoad_isr_exit(unsigned char isr_id, unsigned long start_ticks);
+
+/*
+ * Reporting Functions
+ */
+void CpuLoad_get_statistics(CpuLoad_stats_t *stats); // Copy last window snapshot
+unsigned int CpuLoad_get_load_permille(void);        // Load of last window only
+void CpuLoad_reset_peak(void);                       // Clear worst-case loop time
+unsigned char CpuLoad_format_report(char *buffer, unsigned char size); // Telemetry line
+
+#endif // _CPU_LOAD_H_
@@ -0,0 +1,215 @@
+/*
+ * _debounce.c - Vertical-Counter Debouncing for Buttons and Switches
+ * Part of Assembly → C → Python Learning Progression
+ *
+ * EDUCATIONAL OBJECTIVES:
+ * 1. Bit-parallel ("vertical") counters: 8 debouncers in a few instructions
+ * 2. Sampling from a periodic tick instead of waiting with _delay_ms()
+ * 3. Edge latches shared between an ISR and the main program
+ *
+ * COST:
+ * One channel sample is about 25 byte operations, independent of how many
+ * of its 8 inputs are bouncing. Ticks between samples only count down.
+ *
+ * ASSEMBLY EQUIVALENT (one channel, r16 = raw, r17 = state):
+ *   EOR r16, r17         ; changed
+ *   AND r18, r16 / COM r18       ; ct0 = ~(ct0 & changed)
+ *   AND r19, r16 / EOR r19, r18  ; ct1 = ct0 ^ (ct1 & changed)
+ */
+
+#include <avr/io.h>
+#include <util/atomic.h>
+#include <string.h>
+#include "_debounce.h"
+
+#define DEBOUNCE_SAMPLE_US ((unsigned long)(DEBOUNCE_TICK_DIVIDER) * (DEBOUNCE_TICK_US))
+#define DEBOUNCE_MS_TO_SAMPLES(ms) (((ms) * 1000UL + DEBOUNCE_SAMPLE_US - 1) / DEBOUNCE_SAMPLE_US)
+#define DEBOUNCE_HOLD_SAMPLES DEBOUNCE_MS_TO_SAMPLES(DEBOUNCE_HOLD_MS)
+#define DEBOUNCE_REPEAT_DELAY_SAMPLES DEBOUNCE_MS_TO_SAMPLES(DEBOUNCE_REPEAT_DELAY_MS)
+#define DEBOUNCE_REPEAT_SAMPLES DEBOUNCE_MS_TO_SAMPLES(DEBOUNCE_REPEAT_MS)
+
+typedef char debounce_times_must_fit_counters
+	[(DEBOUNCE_TICK_DIVIDER >= 1 && DEBOUNCE_TICK_DIVIDER <= 255 && DEBOUNCE_HOLD_SAMPLES >= 1 &&
+	  DEBOUNCE_HOLD_SAMPLES <= 65535UL && DEBOUNCE_REPEAT_DELAY_SAMPLES >= 1 &&
+	  DEBOUNCE_REPEAT_DELAY_SAMPLES <= 255 && DEBOUNCE_REPEAT_SAMPLES >= 1 && DEBOUNCE_REPEAT_SAMPLES <= 255)
+		 ? 1
+		 : -1];
+
+// 32 inputs seen as one mask or as 4 channel bytes (AVR is little endian)
+typedef union
+{
+	uint32_t all;
+	uint8_t ch[DEBOUNCE_CHANNELS];
+} Debounce_bits_t;
+
+typedef struct
+{
+	volatile uint8_t *pin; // PINx register, 0 = channel unused
+	uint8_t mask;          // inputs of this channel
+	uint8_t invert;        // active LOW inputs
+	uint8_t ct0, ct1;      // vertical counter bits
+	uint16_t hold_count;   // samples since the last change
+	uint8_t repeat_count;  // samples until the next repeat
+} Debounce_channel_t;
+
+static Debounce_channel_t debounce_channel[DEBOUNCE_CHANNELS];
+static uint8_t debounce_divider;
+
+static volatile Debounce_bits_t debounce_state;
+static volatile Debounce_bits_t debounce_press;
+static volatile Debounce_bits_t debounce_release;
+static volatile Debounce_bits_t debounce_hold;
+static volatile Debounce_bits_t debounce_repeat;
+
+void Debounce_init(void)
+{
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		memset(debounce_channel, 0, sizeof(debounce_channel));
+		debounce_divider = 0;
+		debounce_state.all = 0;
+		debounce_press.all = 0;
+		debounce_release.all = 0;
+		debounce_hold.all = 0;
+		debounce_repeat.all = 0;
+	}
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Attach a Port to a Channel
+ *
+ * PURPOSE: pin is the PINx register, mask selects the inputs, active_low
+ *          marks inputs that read 0 when active (buttons to GND with
+ *          pull-ups). Pin direction and pull-ups stay the caller's job.
+ *          The debounced level starts at the current reading, so inputs
+ *          that are already active do not report a press.
+ * RETURNS: 1 on success, 0 for an invalid channel
+ */
+uint8_t Debounce_attach(uint8_t channel, volatile uint8_t *pin, uint8_t mask, uint8_t active_low)
+{
+	Debounce_channel_t *c;
+
+	if (channel >= DEBOUNCE_CHANNELS)
+		return 0;
+
+	c = &debounce_channel[channel];
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		c->pin = pin;
+		c->mask = mask;
+		c->invert = active_low & mask;
+		c->ct0 = 0xFF; // counters idle (11 = nothing changed)
+		c->ct1 = 0xFF;
+		c->hold_count = 0;
+		c->repeat_count = DEBOUNCE_REPEAT_DELAY_SAMPLES;
+		debounce_state.ch[channel] = pin ? (uint8_t)((*pin ^ c->invert) & mask) : 0;
+		debounce_press.ch[channel] = 0;
+		debounce_release.ch[channel] = 0;
+		debounce_hold.ch[channel] = 0;
+		debounce_repeat.ch[channel] = 0;
+	}
+	return 1;
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Sample One Channel
+ *
+ * PURPOSE: The vertical counter step from _debounce.h, then the shared
+ *          hold and repeat timers of the channel.
+ */
+static void debounce_sample(uint8_t channel)
+{
+	Debounce_channel_t *c = &debounce_channel[channel];
+	uint8_t state = debounce_state.ch[channel];
+	uint8_t changed, toggle;
+
+	changed = state ^ ((*c->pin ^ c->invert) & c->mask);
+	c->ct0 = ~(c->ct0 & changed);
+	c->ct1 = c->ct0 ^ (c->ct1 & changed);
+	toggle = changed & c->ct0 & c->ct1;
+	state ^= toggle;
+
+	debounce_state.ch[channel] = state;
+	debounce_press.ch[channel] |= state & toggle;
+	debounce_release.ch[channel] |= (uint8_t)~state & toggle;
+	debounce_repeat.ch[channel] |= state & toggle;
+
+	if (toggle || !state)
+	{
+		c->hold_count = 0;
+		c->repeat_count = DEBOUNCE_REPEAT_DELAY_SAMPLES;
+		return;
+	}
+	if ((c->hold_count < DEBOUNCE_HOLD_SAMPLES) && (++c->hold_count == DEBOUNCE_HOLD_SAMPLES))
+		debounce_hold.ch[channel] |= state;
+	if (--c->repeat_count == 0)
+	{
+		c->repeat_count = DEBOUNCE_REPEAT_SAMPLES;
+		debounce_repeat.ch[channel] |= state;
+	}
+}
+
+/*
+ * EDUCATIONAL FUNCTION: System Tick
+ *
+ * PURPOSE: Called from the periodic ISR. Every DEBOUNCE_TICK_DIVIDER-th
+ *          call samples all attached channels.
+ */
+void Debounce_tick(void)
+{
+	uint8_t channel;
+
+	if (++debounce_divider < DEBOUNCE_TICK_DIVIDER)
+		return;
+	debounce_divider = 0;
+
+	for (channel = 0; channel < DEBOUNCE_CHANNELS; channel++)
+	{
+		if (debounce_channel[channel].pin)
+			debounce_sample(channel);
+	}
+}
+
+uint32_t Debounce_state(void)
+{
+	uint32_t state;
+
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		state = debounce_state.all;
+	}
+	return state;
+}
+
+// read and clear latched edges; the ISR may set bits at any time
+static uint32_t debounce_take(volatile Debounce_bits_t *bits, uint32_t mask)
+{
+	uint32_t taken;
+
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		taken = bits->all & mask;
+		bits->all &= ~mask;
+	}
+	return taken;
+}
+
+uint32_t Debounce_get_press(uint32_t mask)
+{
+	return debounce_take(&debounce_press, mask);
+}
+
+uint32_t Debounce_get_release(uint32_t mask)
+{
+	return debounce_take(&debounce_release, mask);
+}
+
+uint32_t Debounce_get_hold(uint32_t mask)
+{
+	return debounce_take(&debounce_hold, mask);
+}
+
+uint32_t Debounce_get_repeat(uint32_t mask)
+{
+	return debounce_take(&debounce_repeat, mask);
+}
@@ -0,0 +1,92 @@
+/*
+ * _debounce.h - Vertical-Counter Debouncing for Buttons and Switches
+ * Educational Version for Assembly→C→Python Learning Progression
+ *
+ * PURPOSE:
+ * One shared input conditioner instead of _delay_ms(20) waits in every
+ * project. Up to 4 channels of 8 inputs (32 inputs) are sampled from the
+ * system tick; the program reads debounced levels and edges in O(1):
+ *
+ *   Debounce_attach(0, &PIND, 0xFF, 0xFF); // board buttons, active LOW
+ *   if (Debounce_get_press(DEBOUNCE_INPUT(0, 3))) ...  // PD3 was pressed
+ *
+ * VERTICAL COUNTERS:
+ * Instead of one counter per input, bit n of ct0 and ct1 together form a
+ * 2-bit counter for input n. Eight counters step with a handful of byte
+ * operations, no loop over the bits:
+ *
+ *   changed = state ^ raw      inputs that differ from the debounced level
+ *   ct0 = ~(ct0 & changed)     count (or reset where nothing changed)
+ *   ct1 = ct0 ^ (ct1 & changed)
+ *   toggle = changed & ct0 & ct1   stable for DEBOUNCE_SAMPLES samples
+ *   state ^= toggle
+ *
+ * An input must read the new level on 4 samples in a row; every sample
+ * that disagrees restarts its counter.
+ *
+ * Debounce_init() clears every channel; call it before Debounce_attach()
+ * (and before Port_init(), which attaches the buttons). Static storage is
+ * already cleared at reset, so it is only needed to start over.
+ *
+ * SYSTEM TICK:
+ * Build with -DDEBOUNCE_ENABLED (and link _debounce.c): Timer2_ovf_handler()
+ * calls Debounce_tick() every tick and _port.c's button functions read the
+ * debounced PORTD buttons. The tick period comes from the Timer2 setup
+ * (TIMER2_TICK_US), and every DEBOUNCE_TICK_DIVIDER-th tick is sampled.
+ * Without _timer2, call Debounce_tick() from any periodic ISR and set
+ * DEBOUNCE_TICK_US to its period.
+ *
+ * EDGES AND HOLD (latched until read, read-and-clear):
+ *   press     debounced inactive -> active
+ *   release   debounced active -> inactive
+ *   hold      inputs held DEBOUNCE_HOLD_MS (once per hold)
+ *   repeat    press, then after DEBOUNCE_REPEAT_DELAY_MS every
+ *             DEBOUNCE_REPEAT_MS while held
+ * Like the classic vertical-counter routine, the hold and repeat timers
+ * are shared by the inputs of a channel: they restart when any input of
+ * the channel changes. Single buttons are timed exactly, chords from
+ * their last change.
+ */
+
+#ifndef _DEBOUNCE_H_
+#define _DEBOUNCE_H_
+
+#include <stdint.h>
+
+#ifndef DEBOUNCE_TICK_US
+#include "_timer2.h"
+#define DEBOUNCE_TICK_US TIMER2_TICK_US // Timer2_ovf_handler() period (998us at 7.3728MHz)
+#endif
+#ifndef DEBOUNCE_SAMPLE_TARGET_US
+#define DEBOUNCE_SAMPLE_TARGET_US 5000 // about 5ms per sample: 4 samples = 20ms
+#endif
+#ifndef DEBOUNCE_TICK_DIVIDER
+#define DEBOUNCE_TICK_DIVIDER (((DEBOUNCE_SAMPLE_TARGET_US) + (DEBOUNCE_TICK_US) / 2) / (DEBOUNCE_TICK_US))
+#endif
+#ifndef DEBOUNCE_HOLD_MS
+#define DEBOUNCE_HOLD_MS 1000
+#endif
+#ifndef DEBOUNCE_REPEAT_DELAY_MS
+#define DEBOUNCE_REPEAT_DELAY_MS 500
+#endif
+#ifndef DEBOUNCE_REPEAT_MS
+#define DEBOUNCE_REPEAT_MS 100
+#endif
+
+#define DEBOUNCE_CHANNELS 4
+#define DEBOUNCE_SAMPLES 4 // 2-bit vertical counter
+
+// Input bit in the 32-bit masks: channel 0..3, bit 0..7
+#define DEBOUNCE_INPUT(channel, bit) ((uint32_t)1 << ((channel) * 8 + (bit)))
+
+void Debounce_init(void);
+uint8_t Debounce_attach(uint8_t channel, volatile uint8_t *pin, uint8_t mask, uint8_t active_low);
+void Debounce_tick(void); // from the system tick ISR
+
+uint32_t Debounce_state(void);                // debounced levels, 1 = active
+uint32_t Debounce_get_press(uint32_t mask);   // edges since the last call, cleared
+uint32_t Debounce_get_release(uint32_t mask);
+uint32_t Debounce_get_hold(uint32_t mask);
+uint32_t Debounce_get_repeat(uint32_t mask);
+
+#endif // _DEBOUNCE_H_
@@ -0,0 +1,307 @@
+/*
+ * _event.c - ATmega128 Event Queue and Publish/Subscribe Bus
+ * Part of Assembly → C → Python Learning Progression
+ *
+ * EDUCATIONAL OBJECTIVES:
+ * 1. Replace polled volatile flags with a message queue
+ * 2. Learn ISR-safe queue operations using short critical sections
+ * 3. Understand priority-ordered event dispatching
+ * 4. Practice the publish/subscribe design pattern in C
+ * 5. Use sleep mode to save power while waiting for events
+ *
+ * DESIGN:
+ * - One ring buffer per priority level, EVENT_QUEUE_SIZE entries each
+ * - Ring indices wrap with a mask (size is a power of two)
+ * - Posting disables interrupts for a few instructions only, so any ISR
+ *   and the main program may post at the same time
+ * - Dispatching runs in the main program and calls every handler
+ *   subscribed to the event type (or to EVENT_ANY)
+ *
+ * PYTHON EQUIVALENT:
+ *   queue.put((priority, event)); handler = subscribers[event.type]
+ */
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/sleep.h>
+#include "_main.h"
+#include "_event.h"
+
+#if (EVENT_QUEUE_SIZE & (EVENT_QUEUE_SIZE - 1)) != 0
+#error "EVENT_QUEUE_SIZE must be a power of two"
+#endif
+
+#define EVENT_QUEUE_MASK (EVENT_QUEUE_SIZE - 1)
+
+/*
+ * Queue Storage - one ring per priority level
+ * head: next write position (ISR/main post), tail: next read position
+ */
+static volatile Event_t event_queue[EVENT_PRIORITY_LEVELS][EVENT_QUEUE_SIZE];
+static volatile unsigned char event_head[EVENT_PRIORITY_LEVELS];
+static volatile unsigned char event_tail[EVENT_PRIORITY_LEVELS];
+static volatile unsigned int event_dropped = 0;
+
+/*
+ * Subscriber Table
+ */
+typedef struct
+{
+	unsigned char type;
+	Event_handler_t handler;
+} Event_subscriber_t;
+
+static Event_subscriber_t subscribers[EVENT_MAX_SUBSCRIBERS];
+static unsigned char subscriber_count = 0;
+static void (*idle_hook)(void) = 0;
+
+/*
+ * EDUCATIONAL FUNCTION: Initialize Event Bus
+ *
+ * PURPOSE: Empty all queues and remove all subscribers
+ */
+void Event_init(void)
+{
+	unsigned char i;
+	unsigned char sreg_backup = SREG;
+	cli();
+
+	for (i = 0; i < EVENT_PRIORITY_LEVELS; i++)
+	{
+		event_head[i] = 0;
+		event_tail[i] = 0;
+	}
+	event_dropped = 0;
+	subscriber_count = 0;
+	idle_hook = 0;
+
+	SREG = sreg_backup;
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Post Event
+ *
+ * PURPOSE: Queue an event; callable from ISRs and the main program
+ * RETURNS: 1 if queued, 0 if the queue of that priority was full
+ *
+ * LEARNING: Saving SREG instead of calling sei() keeps the function safe
+ *           inside ISRs, where interrupts must stay disabled.
+ */
+unsigned char Event_post(unsigned char type, unsigned char priority, unsigned int data)
+{
+	unsigned char result = 0;
+
+	if (priority >= EVENT_PRIORITY_LEVELS)
+	{
+		priority = EVENT_PRIORITY_LOW;
+	}
+
+	unsigned char sreg_backup = SREG;
+	cli();
+
+	unsigned char head = event_head[priority];
+	unsigned char next = (head + 1) & EVENT_QUEUE_MASK;
+
+	if (next != event_tail[priority])
+	{
+		event_queue[priority][head].type = type;
+		event_queue[priority][head].priority = priority;
+		event_queue[priority][head].data = data;
+		event_head[priority] = next;
+		result = 1;
+	}
+	else
+	{
+		event_dropped++;
+	}
+
+	SREG = sreg_backup;
+	return result;
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Get Next Event
+ *
+ * PURPOSE: Remove the oldest event of the highest non-empty priority
+ * RETURNS: 1 if an event was copied to *event, 0 if all queues are empty
+ */
+unsigned char Event_get(Event_t *event)
+{
+	unsigned char level;
+
+	for (level = 0; level < EVENT_PRIORITY_LEVELS; level++)
+	{
+		unsigned char sreg_backup = SREG;
+		cli();
+
+		unsigned char tail = event_tail[level];
+		if (tail != event_head[level])
+		{
+			event->type = event_queue[level][tail].type;
+			event->priority = event_queue[level][tail].priority;
+			event->data = event_queue[level][tail].data;
+			event_tail[level] = (tail + 1) & EVENT_QUEUE_MASK;
+			SREG = sreg_backup;
+			return 1;
+		}
+
+		SREG = sreg_backup;
+	}
+
+	return 0;
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Count Pending Events
+ */
+unsigned char Event_pending(void)
+{
+	unsigned char level;
+	unsigned char count = 0;
+
+	for (level = 0; level < EVENT_PRIORITY_LEVELS; level++)
+	{
+		count += (event_head[level] - event_tail[level]) & EVENT_QUEUE_MASK;
+	}
+	return count;
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Subscribe Handler
+ *
+ * PURPOSE: Register handler to be called for every event of this type
+ * RETURNS: 1 on success, 0 if the subscriber table is full
+ */
+unsigned char Event_subscribe(unsigned char type, Event_handler_t handler)
+{
+	if (subscriber_count >= EVENT_MAX_SUBSCRIBERS || handler == 0)
+	{
+		return 0;
+	}
+
+	subscribers[subscriber_count].type = type;
+	subscribers[subscriber_count].handler = handler;
+	subscriber_count++;
+	return 1;
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Unsubscribe Handler
+ *
+ * PURPOSE: Remove a type/handler registration (order of others is kept)
+ */
+void Event_unsubscribe(unsigned char type, Event_handler_t handler)
+{
+	unsigned char i, j;
+
+	for (i = 0; i < subscriber_count; i++)
+	{
+		if (subscribers[i].type == type && subscribers[i].handler == handler)
+		{
+			for (j = i; j + 1 < subscriber_count; j++)
+			{
+				subscribers[j] = subscribers[j + 1];
+			}
+			subscriber_count--;
+			return;
+		}
+	}
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Dispatch Pending Events
+ *
+ * PURPOSE: Deliver every queued event to its subscribers
+ * RETURNS: Number of events dispatched (saturates at 255)
+ *
+ * NOTE: Events posted by handlers are delivered in the same call
+ */
+unsigned char Event_dispatch(void)
+{
+	Event_t event;
+	unsigned char dispatched = 0;
+	unsigned char i;
+
+	while (Event_get(&event))
+	{
+		for (i = 0; i < subscriber_count; i++)
+		{
+			if (subscribers[i].type == event.type || subscribers[i].type == EVENT_ANY)
+			{
+				subscribers[i].handler(&event);
+			}
+		}
+
+		if (dispatched < 255)
+		{
+			dispatched++;
+		}
+	}
+
+	return dispatched;
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Wait For Event
+ *
+ * PURPOSE: Put the CPU into IDLE sleep while all queues are empty
+ *
+ * LEARNING: Checking "queue empty" and entering sleep must be atomic.
+ * Otherwise an ISR could post an event between the check and SLEEP, and
+ * the CPU would sleep with work pending. AVR executes the instruction
+ * after SEI before serving any interrupt, so "SEI; SLEEP" is safe.
+ *
+ * With an idle hook installed (e.g. CpuLoad_idle), the hook is called
+ * instead; the periodic system tick then bounds the wake-up delay.
+ */
+void Event_wait(void)
+{
+	if (idle_hook)
+	{
+		if (!Event_pending())
+		{
+			idle_hook();
+		}
+		return;
+	}
+
+	set_sleep_mode(SLEEP_MODE_IDLE);
+	cli();
+	if (!Event_pending())
+	{
+		sleep_enable();
+		sei();
+		sleep_cpu();
+		sleep_disable();
+	}
+	sei();
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Run Event Loop
+ *
+ * PURPOSE: Complete main loop - dispatch events, sleep when idle
+ * NOTE: Never returns; subscribe all handlers before calling
+ */
+void Event_run(void)
+{
+	while (1)
+	{
+		Event_dispatch();
+		Event_wait();
+	}
+}
+
+void Event_set_idle_hook(void (*hook)(void))
+{
+	idle_hook = hook;
+}
+
+unsigned int Event_get_dropped(void)
+{
+	unsigned char sreg_backup = SREG;
+	cli();
+	unsigned int dropped = event_dropped;
+	SREG = sreg_backup;
+	return dropped;
+}
@@ -0,0 +1,90 @@
+/*
+ * _event.h - ATmega128 Event Queue and Publish/Subscribe Bus Header
+ * Educational Version for Assembly→C→Python Learning Progression
+ *
+ * PURPOSE:
+ * Replaces "one volatile flag per module" signalling with a single queue.
+ * ISRs and drivers post small typed events; the main loop dispatches them
+ * to subscribed handlers and sleeps when nothing is pending. Main loop
+ * work becomes proportional to the number of events, not to the number
+ * of modules that have to be polled.
+ *
+ * DRIVER INTEGRATION:
+ * Build with -DEVENT_BUS_ENABLED (and link _event.c) to make _uart.c,
+ * _adc.c, _timer2.c, _keypad.c and Interrupt_notify() post their events. Legacy
+ * flags (uart_rx_flag, adc_interrupt_complete, TaskN_Of_Timer2) are still
+ * maintained so older examples keep working.
+ */
+
+#ifndef _EVENT_H_
+#define _EVENT_H_
+
+/*
+ * Queue Configuration
+ */
+#define EVENT_QUEUE_SIZE 16     // Events per priority level (power of two)
+#define EVENT_MAX_SUBSCRIBERS 16 // Total handler registrations
+
+/*
+ * Priority Levels (lower number = dispatched first)
+ */
+#define EVENT_PRIORITY_HIGH 0
+#define EVENT_PRIORITY_NORMAL 1
+#define EVENT_PRIORITY_LOW 2
+#define EVENT_PRIORITY_LEVELS 3
+
+/*
+ * Event Types Posted by Shared Library Drivers
+ */
+#define EVENT_NONE 0
+#define EVENT_TIMER2_TASK1 1 // Timer2 task 1 interval elapsed
+#define EVENT_TIMER2_TASK2 2 // Timer2 task 2 interval elapsed
+#define EVENT_TIMER2_TASK3 3 // Timer2 task 3 interval elapsed
+#define EVENT_UART_RX 4      // UART1 byte received (data = byte)
+#define EVENT_ADC_COMPLETE 5 // ADC conversion done (data = result)
+#define EVENT_INT0 6         // External interrupt n = 0..7 (EVENT_INT0 + n), data:
+#define EVENT_INT7 13        //   _interrupt.c: trigger count of line n, _extint.c: EXTINT_EDGE_*
+#define EVENT_KEYPAD 14      // Keypad event (data = key | KEYPAD_* type << 8)
+#define EVENT_USER 32        // First event type free for applications
+#define EVENT_ANY 0xFF       // Subscribe to every event type
+
+/*
+ * Event Record (4 bytes)
+ */
+typedef struct
+{
+	unsigned char type;     // EVENT_* identifier
+	unsigned char priority; // EVENT_PRIORITY_* it was posted with
+	unsigned int data;      // Event specific payload
+} Event_t;
+
+typedef void (*Event_handler_t)(const Event_t *event);
+
+/*
+ * Core Queue Functions (Event_post is safe from ISRs and main program)
+ */
+void Event_init(void);
+unsigned char Event_post(unsigned char type, unsigned char priority, unsigned int data);
+unsigned char Event_get(Event_t *event); // Non-blocking, highest priority first
+unsigned char Event_pending(void);       // Number of queued events
+
+/*
+ * Publish/Subscribe Functions
+ */
+unsigned char Event_subscribe(unsigned char type, Event_handler_t handler);
+void Event_unsubscribe(unsigned char type, Event_handler_t handler);
+
+/*
+ * Dispatcher Functions
+ */
+unsigned char Event_dispatch(void);              // Deliver all pending events
+void Event_wait(void);                           // Sleep until an event is queued
+void Event_run(void);                            // Dispatch forever (never returns)
+void Event_set_idle_hook(void (*hook)(void));    // Replace default idle sleep
+
+/*
+ * Diagnostics
+ */
+unsigned int Event_get_dropped(void); // Events lost because a queue was full
+
+#endif // _EVENT_H_
@@ -0,0 +1,467 @@
+/*
+ * _extint.c - ATmega128 External Interrupt Edge Service
+ * Part of Assembly → C → Python Learning Progression
+ *
+ * EDUCATIONAL OBJECTIVES:
+ * 1. Configure INT0..INT7 sense control (EICRA/EICRB) from one table
+ * 2. Emulate "both edges" on INT0..3 by re-arming the opposite edge
+ * 3. Timestamp edges with the shared clock and queue them for main
+ * 4. Protect the CPU from a stuck or oscillating line (interrupt storm)
+ *
+ * REGISTERS USED:
+ * - EICRA (ISC0..ISC3), EICRB (ISC4..ISC7): 2 sense bits per line
+ *     00 low level, 01 any change (INT4..7 only), 10 falling, 11 rising
+ * - EIMSK (INTn): enable, EIFR (INTFn): flags, cleared by writing one
+ * - PIND (PD0..3), PINE (PE4..7): level check
+ *
+ * ONE RING, EIGHT PRODUCERS:
+ * Every INTn ISR writes the same event ring. AVR ISRs do not nest (the
+ * I flag is cleared on entry and no ISR here sets it), so only one
+ * producer runs at a time and the head/tail scheme of _capture.c still
+ * needs no lock. It does need the ordering rule of _spsc.h: the slot is
+ * written (or copied) before the index that hands it over is stored,
+ * with SPSC_BARRIER() in between so the compiler cannot move the
+ * non-volatile slot access across the volatile index.
+ */
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <util/atomic.h>
+#include <string.h>
+#include "_extint.h"
+#include "_capture.h"
+#include "_spsc.h" // SPSC_BARRIER
+#ifdef EVENT_BUS_ENABLED
+#include "_event.h"
+#endif
+
+#if (EXTINT_RING_SIZE & (EXTINT_RING_SIZE - 1)) != 0
+#error "EXTINT_RING_SIZE must be a power of two"
+#endif
+
+#define EXTINT_RING_MASK (EXTINT_RING_SIZE - 1)
+#define EXTINT_TICKS_PER_MS (CAPTURE_TICKS_PER_SECOND / 1000UL)
+#define EXTINT_STORM_WINDOW_TICKS ((uint32_t)EXTINT_STORM_WINDOW_MS * EXTINT_TICKS_PER_MS)
+#define EXTINT_STORM_HOLDOFF_TICKS ((uint32_t)EXTINT_STORM_HOLDOFF_MS * EXTINT_TICKS_PER_MS)
+
+typedef char extint_storm_limit_must_fit_8bit[(EXTINT_STORM_LIMIT >= 1 && EXTINT_STORM_LIMIT <= 254) ? 1 : -1];
+
+// ISCn1:ISCn0 values
+#define EXTINT_SENSE_CHANGE 0x01
+#define EXTINT_SENSE_FALLING 0x02
+#define EXTINT_SENSE_RISING 0x03
+
+/*
+ * Per-Line State (written by its ISR while the line is enabled)
+ */
+typedef struct
+{
+	uint8_t mode;            // EXTINT_EDGE_* (0xFF = disabled)
+	uint8_t level;           // last pin level seen, accepted or not
+	uint8_t have_reference;  // last_accept is valid
+	uint8_t storm_count;     // interrupts in the current window
+	uint32_t glitch_ticks;   // minimum spacing of accepted edges
+	uint32_t last_accept;    // timestamp of the last accepted edge
+	uint32_t window_start;   // start of the storm window
+	uint32_t masked_since;   // when the storm guard masked the line
+	ExtInt_stats_t stats;
+} ExtInt_line_t;
+
+static volatile ExtInt_line_t lines[EXTINT_LINES];
+static volatile uint8_t stormed; // bit n = INTn masked by the storm guard
+
+static ExtInt_event_t ring[EXTINT_RING_SIZE];
+static volatile uint8_t ring_head; // Written by ISRs only
+static volatile uint8_t ring_tail; // Written by main program only
+
+static uint8_t extint_read_pin(uint8_t line)
+{
+	// INTn sits on bit n of its port: PD0..PD3, PE4..PE7
+	return ((line < 4) ? PIND : PINE) & (1 << line) ? 1 : 0;
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Program Sense Control
+ *
+ * PURPOSE: Write the 2 ISC bits of one line. INT0..3 are in EICRA,
+ *          INT4..7 in EICRB, both at bit position 2 * (n % 4).
+ *          A sense change can raise INTFn on its own, so the flag is
+ *          cleared afterwards.
+ */
+static void extint_set_sense(uint8_t line, uint8_t sense)
+{
+	uint8_t shift = (line & 0x03) * 2;
+
+	if (line < 4)
+	{
+		EICRA = (EICRA & (uint8_t)~(0x03 << shift)) | (sense << shift);
+	}
+	else
+	{
+		EICRB = (EICRB & (uint8_t)~(0x03 << shift)) | (sense << shift);
+	}
+	EIFR = (1 << line);
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Re-arm INT0..3 for the Opposite Edge
+ *
+ * PURPOSE: Wait for the edge away from the current level. If the pin
+ *          changes while the sense is being rewritten, that edge was
+ *          cleared with the flag, so read again and re-arm once more.
+ *          Two passes bound the ISR time; anything faster is a glitch
+ *          and the next real edge brings the level up to date.
+ * RETURNS: Pin level the sense was armed against
+ */
+static uint8_t extint_rearm_opposite(uint8_t line)
+{
+	uint8_t level = extint_read_pin(line);
+	uint8_t pass;
+
+	for (pass = 0; pass < 2; pass++)
+	{
+		extint_set_sense(line, level ? EXTINT_SENSE_FALLING : EXTINT_SENSE_RISING);
+		if (extint_read_pin(line) == level)
+		{
+			break;
+		}
+		level ^= 1;
+	}
+	return level;
+}
+
+/*
+ * Common edge processing (runs inside the INTn ISRs)
+ */
+static void extint_edge(uint8_t line)
+{
+	volatile ExtInt_line_t *l = &lines[line];
+	uint32_t now = Capture_get_ticks();
+	uint8_t level, edge;
+
+	/* Storm guard: counts every interrupt, accepted or not */
+	if ((now - l->window_start) >= EXTINT_STORM_WINDOW_TICKS)
+	{
+		l->window_start = now;
+		l->storm_count = 0;
+	}
+	if (++l->storm_count > EXTINT_STORM_LIMIT)
+	{
+		EIMSK &= (uint8_t)~(1 << line);
+		stormed |= (1 << line);
+		l->masked_since = now;
+		l->stats.storms++;
+		return;
+	}
+
+	/* Level check */
+	if (l->mode == EXTINT_EDGE_BOTH)
+	{
+		level = (line < 4) ? extint_rearm_opposite(line) : extint_read_pin(line);
+		if (level == l->level)
+		{
+			l->stats.glitches++; // two edges, net nothing
+			return;
+		}
+		l->level = level;
+		edge = level ? EXTINT_EDGE_RISING : EXTINT_EDGE_FALLING;
+	}
+	else
+	{
+		level = extint_read_pin(line);
+		l->level = level;
+		edge = l->mode;
+		if (level != (edge == EXTINT_EDGE_RISING))
+		{
+			l->stats.glitches++; // pin already went back
+			return;
+		}
+	}
+
+	/* Minimum spacing (contact bounce) */
+	if (l->have_reference && (now - l->last_accept) < l->glitch_ticks)
+	{
+		l->stats.glitches++;
+		return;
+	}
+	l->last_accept = now;
+	l->have_reference = 1;
+	l->stats.accepted++;
+
+	/* Event ring: ISRs own head, main program owns tail */
+	uint8_t head = ring_head;
+	if ((uint8_t)(head - ring_tail) < EXTINT_RING_SIZE)
+	{
+		ExtInt_event_t *event = &ring[head & EXTINT_RING_MASK];
+		event->timestamp = now;
+		event->line = line;
+		event->edge = edge;
+		SPSC_BARRIER(); // slot written before it is published
+		ring_head = head + 1;
+	}
+	else
+	{
+		l->stats.overruns++;
+	}
+
+#ifdef EVENT_BUS_ENABLED
+	Event_post(EVENT_INT0 + line, EVENT_PRIORITY_HIGH, edge);
+#endif
+}
+
+/*
+ * Interrupt Service Routines (only the lines selected by EXTINT_VECTORS)
+ */
+#if EXTINT_VECTORS & 0x01
+ISR(INT0_vect)
+{
+	extint_edge(0);
+}
+#endif
+#if EXTINT_VECTORS & 0x02
+ISR(INT1_vect)
+{
+	extint_edge(1);
+}
+#endif
+#if EXTINT_VECTORS & 0x04
+ISR(INT2_vect)
+{
+	extint_edge(2);
+}
+#endif
+#if EXTINT_VECTORS & 0x08
+ISR(INT3_vect)
+{
+	extint_edge(3);
+}
+#endif
+#if EXTINT_VECTORS & 0x10
+ISR(INT4_vect)
+{
+	extint_edge(4);
+}
+#endif
+#if EXTINT_VECTORS & 0x20
+ISR(INT5_vect)
+{
+	extint_edge(5);
+}
+#endif
+#if EXTINT_VECTORS & 0x40
+ISR(INT6_vect)
+{
+	extint_edge(6);
+}
+#endif
+#if EXTINT_VECTORS & 0x80
+ISR(INT7_vect)
+{
+	extint_edge(7);
+}
+#endif
+
+/*
+ * EDUCATIONAL FUNCTION: Initialize Edge Service
+ *
+ * PURPOSE: Start the shared clock and switch off every line this module
+ *          owns. Lines whose vector the application defines are left alone.
+ */
+void ExtInt_init(void)
+{
+	uint8_t line;
+
+	Capture_clock_init();
+
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		EIMSK &= (uint8_t)~EXTINT_VECTORS;
+		EIFR = EXTINT_VECTORS;
+		for (line = 0; line < EXTINT_LINES; line++)
+		{
+			memset((void *)&lines[line], 0, sizeof(lines[line]));
+			lines[line].mode = 0xFF;
+		}
+		stormed = 0;
+		ring_head = 0;
+		ring_tail = 0;
+	}
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Enable One Line
+ *
+ * PARAMETERS:
+ *   line      - 0..7 (INT0..INT7)
+ *   edge_mode - EXTINT_EDGE_FALLING, _RISING or _BOTH
+ *   glitch_us - minimum time between accepted edges, 0 = off
+ * PURPOSE: Pin direction and pull-ups stay the caller's job.
+ * RETURNS: 1 on success, 0 for an invalid line or mode, or a line whose
+ *          vector is not owned by this module
+ */
+uint8_t ExtInt_enable(uint8_t line, uint8_t edge_mode, uint16_t glitch_us)
+{
+	if ((line >= EXTINT_LINES) || (edge_mode > EXTINT_EDGE_BOTH) || !(EXTINT_VECTORS & (1 << line)))
+	{
+		return 0;
+	}
+
+	volatile ExtInt_line_t *l = &lines[line];
+	uint32_t glitch_ticks = ((uint32_t)glitch_us * EXTINT_TICKS_PER_MS) / 1000UL;
+
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		EIMSK &= (uint8_t)~(1 << line);
+		stormed &= (uint8_t)~(1 << line);
+
+		l->mode = edge_mode;
+		l->glitch_ticks = glitch_ticks;
+		l->have_reference = 0;
+		l->storm_count = 0;
+		l->window_start = Capture_get_ticks();
+
+		if (edge_mode == EXTINT_EDGE_FALLING)
+		{
+			extint_set_sense(line, EXTINT_SENSE_FALLING);
+		}
+		else if (edge_mode == EXTINT_EDGE_RISING)
+		{
+			extint_set_sense(line, EXTINT_SENSE_RISING);
+		}
+		else if (line >= 4)
+		{
+			extint_set_sense(line, EXTINT_SENSE_CHANGE);
+		}
+		else
+		{
+			extint_set_sense(line, extint_read_pin(line) ? EXTINT_SENSE_FALLING : EXTINT_SENSE_RISING);
+		}
+		l->level = extint_read_pin(line);
+
+		EIMSK |= (1 << line);
+	}
+	return 1;
+}
+
+void ExtInt_disable(uint8_t line)
+{
+	if (line >= EXTINT_LINES)
+	{
+		return;
+	}
+
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		if (EXTINT_VECTORS & (1 << line))
+		{
+			EIMSK &= (uint8_t)~(1 << line);
+		}
+		stormed &= (uint8_t)~(1 << line);
+		lines[line].mode = 0xFF;
+	}
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Storm Recovery
+ *
+ * PURPOSE: Unmask lines whose holdoff has passed. The level is read
+ *          again and, on INT0..3 in BOTH mode, the sense re-armed, since
+ *          any number of edges went by while the line was off.
+ */
+void ExtInt_service(void)
+{
+	uint8_t line;
+
+	if (!stormed)
+	{
+		return;
+	}
+
+	uint32_t now = Capture_get_ticks();
+
+	for (line = 0; line < EXTINT_LINES; line++)
+	{
+		ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+		{
+			volatile ExtInt_line_t *l = &lines[line];
+
+			if ((stormed & (1 << line)) && ((now - l->masked_since) >= EXTINT_STORM_HOLDOFF_TICKS))
+			{
+				stormed &= (uint8_t)~(1 << line);
+				l->storm_count = 0;
+				l->window_start = now;
+				if ((l->mode == EXTINT_EDGE_BOTH) && (line < 4))
+				{
+					l->level = extint_rearm_opposite(line);
+				}
+				else
+				{
+					l->level = extint_read_pin(line);
+					EIFR = (1 << line);
+				}
+				EIMSK |= (1 << line);
+			}
+		}
+	}
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Read Next Edge Event
+ *
+ * RETURNS: 1 if an event was copied, 0 if the ring is empty
+ * LEARNING: Reading events is the main loop's regular job, so storm
+ *           recovery piggybacks on it.
+ */
+uint8_t ExtInt_get_event(ExtInt_event_t *event)
+{
+	ExtInt_service();
+
+	uint8_t tail = ring_tail;
+
+	if (tail == ring_head)
+	{
+		return 0;
+	}
+
+	*event = ring[tail & EXTINT_RING_MASK];
+	SPSC_BARRIER(); // slot copied before it is released
+	ring_tail = tail + 1;
+	return 1;
+}
+
+uint8_t ExtInt_events_pending(void)
+{
+	return (uint8_t)(ring_head - ring_tail);
+}
+
+uint8_t ExtInt_get_stormed(void)
+{
+	return stormed;
+}
+
+void ExtInt_get_stats(uint8_t line, ExtInt_stats_t *stats)
+{
+	if (line >= EXTINT_LINES)
+	{
+		memset(stats, 0, sizeof(*stats));
+		return;
+	}
+
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		*stats = *(ExtInt_stats_t *)&lines[line].stats;
+	}
+}
+
+void ExtInt_reset_stats(void)
+{
+	uint8_t line;
+
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		for (line = 0; line < EXTINT_LINES; line++)
+		{
+			memset((void *)&lines[line].stats, 0, sizeof(lines[line].stats));
+		}
+	}
+}
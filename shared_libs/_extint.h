@@ -0,0 +1,113 @@
+/*
+ * _extint.h - ATmega128 External Interrupt Edge Service Header
+ * Educational Version for Assembly→C→Python Learning Progression
+ *
+ * PURPOSE:
+ * One service for all eight external interrupt lines. The ISRs live in
+ * _extint.c; they timestamp every edge with the shared clock of
+ * _capture.h and put it into one event ring that the main program reads
+ * whenever it has time.
+ *
+ *   INT0..INT3 = PD0..PD3      INT4..INT7 = PE4..PE7
+ *
+ * EDGE MODES:
+ *   EXTINT_EDGE_FALLING / _RISING   one interrupt per press or release
+ *   EXTINT_EDGE_BOTH                both edges, twice the interrupt rate.
+ *     INT4..7 use the hardware "any change" sense. INT0..3 have no such
+ *     mode (ISCn = 01 is reserved), so the ISR flips the sense to the
+ *     opposite edge after each one, like _capture.c does with ICESn.
+ *
+ * GLITCH REJECTION (per line, optional):
+ * - Level check: the ISR reads the pin. A falling edge that already reads
+ *   high again (or, in BOTH mode, an edge that did not change the level)
+ *   was a pulse shorter than the interrupt latency and is dropped.
+ * - Window: edges closer than glitch_us to the last accepted edge are
+ *   dropped (contact bounce). A dropped edge may hide a real change, so
+ *   the level of the last event can be stale until the next edge.
+ *
+ * STORM PROTECTION:
+ * A line that interrupts more than EXTINT_STORM_LIMIT times within
+ * EXTINT_STORM_WINDOW_MS (accepted or not) is masked in EIMSK, so a
+ * floating or oscillating input cannot starve the CPU. ExtInt_service()
+ * (also called by ExtInt_get_event) unmasks it EXTINT_STORM_HOLDOFF_MS
+ * later. If the main program never runs, the line stays off.
+ *
+ * TIMESTAMPS:
+ * Capture_get_ticks() read inside the ISR (CAPTURE_TICKS_PER_SECOND per
+ * second). Unlike input capture this includes the interrupt latency,
+ * a few microseconds plus any ISR that was running at the time.
+ *
+ * RESOURCES USED:
+ * INT0_vect..INT7_vect (select with -DEXTINT_VECTORS=0x0F etc. if the
+ * application defines some of them itself), Timer1 via _capture.c.
+ * Link _capture.c. Interrupt_init() of _interrupt.c must not be used
+ * at the same time (it rewrites EICRA/EICRB/EIMSK).
+ */
+
+#ifndef _EXTINT_H_
+#define _EXTINT_H_
+
+#include <stdint.h>
+
+#ifndef EXTINT_VECTORS
+#define EXTINT_VECTORS 0xFF // lines whose ISR is defined in _extint.c
+#endif
+#ifndef EXTINT_RING_SIZE
+#define EXTINT_RING_SIZE 16 // events, power of two
+#endif
+#ifndef EXTINT_STORM_WINDOW_MS
+#define EXTINT_STORM_WINDOW_MS 10
+#endif
+#ifndef EXTINT_STORM_LIMIT
+#define EXTINT_STORM_LIMIT 50 // interrupts per window (5kHz sustained)
+#endif
+#ifndef EXTINT_STORM_HOLDOFF_MS
+#define EXTINT_STORM_HOLDOFF_MS 1000
+#endif
+
+#define EXTINT_LINES 8
+
+#define EXTINT_EDGE_FALLING 0 // same values as CAPTURE_EDGE_*
+#define EXTINT_EDGE_RISING 1
+#define EXTINT_EDGE_BOTH 2
+
+/*
+ * Edge Event Record
+ */
+typedef struct
+{
+	uint32_t timestamp; // Capture_get_ticks() at ISR entry
+	uint8_t line;       // 0..7 = INT0..INT7
+	uint8_t edge;       // EXTINT_EDGE_RISING / _FALLING
+} ExtInt_event_t;
+
+typedef struct
+{
+	uint16_t accepted; // edges put into the ring
+	uint16_t glitches; // edges dropped by the level check or the window
+	uint16_t storms;   // times the line was masked for storming
+	uint16_t overruns; // accepted edges lost because the ring was full
+} ExtInt_stats_t;
+
+/*
+ * Configuration
+ */
+void ExtInt_init(void); // all lines off, shared clock started
+uint8_t ExtInt_enable(uint8_t line, uint8_t edge_mode, uint16_t glitch_us);
+void ExtInt_disable(uint8_t line);
+
+/*
+ * Event Ring (producers = INTn ISRs, consumer = main program)
+ */
+uint8_t ExtInt_get_event(ExtInt_event_t *event); // 1 if an event was copied
+uint8_t ExtInt_events_pending(void);
+
+/*
+ * Storm Protection and Diagnostics
+ */
+void ExtInt_service(void);          // unmask stormed lines after the holdoff
+uint8_t ExtInt_get_stormed(void);   // lines masked right now (bit n = INTn)
+void ExtInt_get_stats(uint8_t line, ExtInt_stats_t *stats);
+void ExtInt_reset_stats(void);
+
+#endif // _EXTINT_H_
@@ -0,0 +1,91 @@
+/*
+ * _fonts.c - Generated PROGMEM Fonts (do not edit)
+ * Generated by tools/glcd_fontgen.py from: digits_16.glyphs, prop_7.glyphs
+ */
+
+#include "_fonts.h"
+
+static const uint8_t Text_font_digits_16_bitmaps[] PROGMEM = {
+    0x06, 0x09, 0x89, 0xC6, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x02, 0x06, 0x03, 0x01, 0x00, 0x00, 0x18,
+    0x24, 0x24, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0xF8, 0xF8, 0x80, 0x80,
+    0x80, 0x00, 0x00, 0x01, 0x01, 0x01, 0x1F, 0x1F, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE0, 0x78, 0x1E,
+    0x07, 0x01, 0x80, 0xE0, 0x78, 0x1E, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFE, 0x03, 0x83,
+    0xC3, 0x63, 0x33, 0x1B, 0xFE, 0xFC, 0x1F, 0x3F, 0x63, 0x61, 0x60, 0x60, 0x60, 0x60, 0x3F, 0x1F,
+    0x00, 0x08, 0x0C, 0x06, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x60, 0x7F, 0x7F,
+    0x60, 0x60, 0x60, 0x00, 0x04, 0x06, 0x03, 0x03, 0x03, 0x83, 0xC3, 0x63, 0x3E, 0x1C, 0x70, 0x78,
+    0x6C, 0x66, 0x63, 0x61, 0x60, 0x60, 0x60, 0x60, 0x02, 0x03, 0x03, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3,
+    0xFE, 0x3C, 0x20, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x3F, 0x1F, 0xC0, 0xE0, 0x30, 0x18,
+    0x0C, 0x06, 0x03, 0xFF, 0xFF, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x7F, 0x7F, 0x03,
+    0x7F, 0x7F, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0xE3, 0xC3, 0x10, 0x30, 0x60, 0x60, 0x60, 0x60,
+    0x60, 0x60, 0x3F, 0x1F, 0xF8, 0xFC, 0xC6, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC0, 0x80, 0x1F, 0x3F,
+    0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x3F, 0x1F, 0x03, 0x03, 0x03, 0x03, 0x03, 0x83, 0xE3, 0x7B,
+    0x1F, 0x07, 0x00, 0x00, 0x00, 0x78, 0x7E, 0x07, 0x01, 0x00, 0x00, 0x00, 0x1C, 0xBE, 0xE3, 0xC3,
+    0xC3, 0xC3, 0xC3, 0xE3, 0xBE, 0x1C, 0x1F, 0x3F, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x3F, 0x1F,
+    0xFC, 0xFE, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0xFE, 0xFC, 0x00, 0x01, 0x61, 0x61, 0x61, 0x61,
+    0x61, 0x31, 0x1F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00
+};
+
+const Text_font_t Text_font_digits_16 PROGMEM = {0x25, 0x3A, 10, 16, 2, 0, 0, Text_font_digits_16_bitmaps};
+
+static const uint8_t Text_font_prop_7_bitmaps[] PROGMEM = {
+    0x00, 0x00, 0x00, 0x4F, 0x07, 0x00, 0x07, 0x14, 0x7F, 0x14, 0x7F, 0x14, 0x24, 0x2A, 0x7F, 0x2A,
+    0x12, 0x23, 0x13, 0x08, 0x64, 0x62, 0x36, 0x49, 0x55, 0x22, 0x50, 0x05, 0x03, 0x1C, 0x22, 0x41,
+    0x41, 0x22, 0x1C, 0x14, 0x08, 0x3E, 0x08, 0x14, 0x08, 0x08, 0x3E, 0x08, 0x08, 0x50, 0x30, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x60, 0x60, 0x20, 0x10, 0x08, 0x04, 0x02, 0x3E, 0x51, 0x49, 0x45, 0x3E,
+    0x42, 0x7F, 0x40, 0x42, 0x61, 0x51, 0x49, 0x46, 0x21, 0x41, 0x45, 0x4B, 0x31, 0x18, 0x14, 0x12,
+    0x7F, 0x10, 0x27, 0x45, 0x45, 0x45, 0x39, 0x3C, 0x4A, 0x49, 0x49, 0x30, 0x01, 0x71, 0x09, 0x05,
+    0x03, 0x36, 0x49, 0x49, 0x49, 0x36, 0x06, 0x49, 0x49, 0x29, 0x1E, 0x36, 0x36, 0x56, 0x36, 0x08,
+    0x14, 0x22, 0x41, 0x14, 0x14, 0x14, 0x14, 0x14, 0x41, 0x22, 0x14, 0x08, 0x02, 0x01, 0x51, 0x09,
+    0x06, 0x32, 0x49, 0x79, 0x41, 0x3E, 0x7E, 0x11, 0x11, 0x11, 0x7E, 0x7F, 0x49, 0x49, 0x49, 0x36,
+    0x3E, 0x41, 0x41, 0x41, 0x22, 0x7F, 0x41, 0x41, 0x22, 0x1C, 0x7F, 0x49, 0x49, 0x49, 0x41, 0x7F,
+    0x09, 0x09, 0x09, 0x01, 0x3E, 0x41, 0x49, 0x49, 0x7A, 0x7F, 0x08, 0x08, 0x08, 0x7F, 0x41, 0x7F,
+    0x41, 0x20, 0x40, 0x41, 0x3F, 0x01, 0x7F, 0x08, 0x14, 0x22, 0x41, 0x7F, 0x40, 0x40, 0x40, 0x40,
+    0x7F, 0x02, 0x0C, 0x02, 0x7F, 0x7F, 0x04, 0x08, 0x10, 0x7F, 0x3E, 0x41, 0x41, 0x41, 0x3E, 0x7F,
+    0x09, 0x09, 0x09, 0x06, 0x3E, 0x41, 0x51, 0x21, 0x5E, 0x7F, 0x09, 0x19, 0x29, 0x46, 0x26, 0x49,
+    0x49, 0x49, 0x32, 0x01, 0x01, 0x7F, 0x01, 0x01, 0x3F, 0x40, 0x40, 0x40, 0x3F, 0x1F, 0x20, 0x40,
+    0x20, 0x1F, 0x3F, 0x40, 0x38, 0x40, 0x3F, 0x63, 0x14, 0x08, 0x14, 0x63, 0x07, 0x08, 0x70, 0x08,
+    0x07, 0x61, 0x51, 0x49, 0x45, 0x43, 0x7F, 0x41, 0x41, 0x02, 0x04, 0x08, 0x10, 0x20, 0x41, 0x41,
+    0x7F, 0x04, 0x02, 0x01, 0x02, 0x04, 0x40, 0x40, 0x40, 0x40, 0x40, 0x01, 0x02, 0x04, 0x20, 0x54,
+    0x54, 0x54, 0x78, 0x7F, 0x48, 0x44, 0x44, 0x38, 0x38, 0x44, 0x44, 0x44, 0x20, 0x38, 0x44, 0x44,
+    0x48, 0x7F, 0x38, 0x54, 0x54, 0x54, 0x18, 0x08, 0x7E, 0x09, 0x01, 0x02, 0x0C, 0x52, 0x52, 0x52,
+    0x3E, 0x7F, 0x08, 0x04, 0x04, 0x78, 0x04, 0x7D, 0x20, 0x40, 0x44, 0x3D, 0x7F, 0x10, 0x28, 0x44,
+    0x41, 0x7F, 0x40, 0x7C, 0x04, 0x18, 0x04, 0x7C, 0x7C, 0x08, 0x04, 0x04, 0x78, 0x38, 0x44, 0x44,
+    0x44, 0x38, 0x7C, 0x14, 0x14, 0x14, 0x08, 0x08, 0x14, 0x14, 0x18, 0x7C, 0x7C, 0x08, 0x04, 0x04,
+    0x08, 0x48, 0x54, 0x54, 0x54, 0x20, 0x04, 0x3F, 0x44, 0x40, 0x20, 0x3C, 0x40, 0x40, 0x20, 0x7C,
+    0x1C, 0x20, 0x40, 0x20, 0x1C, 0x3C, 0x40, 0x30, 0x40, 0x3C, 0x44, 0x28, 0x10, 0x28, 0x44, 0x0C,
+    0x50, 0x50, 0x50, 0x3C, 0x44, 0x64, 0x54, 0x4C, 0x44, 0x08, 0x36, 0x41, 0x77, 0x41, 0x36, 0x08,
+    0x08, 0x04, 0x08, 0x10, 0x08
+};
+
+static const uint8_t Text_font_prop_7_widths[] PROGMEM = {
+    3, 1, 3, 5, 5, 5, 5, 2, 3, 3, 5, 5, 2, 5, 2, 5,
+    5, 3, 5, 5, 5, 5, 5, 5, 5, 5, 2, 2, 4, 5, 4, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 3, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 3, 5, 3, 5, 5,
+    3, 5, 5, 5, 5, 5, 5, 5, 5, 2, 4, 4, 3, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 3, 1, 3, 5
+};
+
+static const uint16_t Text_font_prop_7_offsets[] PROGMEM = {
+    0, 3, 4, 7, 12, 17, 22, 27, 29, 32, 35, 40,
+    45, 47, 52, 54, 59, 64, 67, 72, 77, 82, 87, 92,
+    97, 102, 107, 109, 111, 115, 120, 124, 129, 134, 139, 144,
+    149, 154, 159, 164, 169, 174, 177, 182, 187, 192, 197, 202,
+    207, 212, 217, 222, 227, 232, 237, 242, 247, 252, 257, 262,
+    265, 270, 273, 278, 283, 286, 291, 296, 301, 306, 311, 316,
+    321, 326, 328, 332, 336, 339, 344, 349, 354, 359, 364, 369,
+    374, 379, 384, 389, 394, 399, 404, 409, 412, 413, 416
+};
+
+const Text_font_t Text_font_prop_7 PROGMEM = {0x20, 0x7E, 5, 8, 1, Text_font_prop_7_widths, Text_font_prop_7_offsets, Text_font_prop_7_bitmaps};
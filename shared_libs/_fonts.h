@@ -0,0 +1,18 @@
+/*
+ * _fonts.h - Generated PROGMEM Fonts (do not edit)
+ * Generated by tools/glcd_fontgen.py, see _text.h for the format
+ *
+ * FONT                          SIZE     CHARS      FLASH
+ * Text_font_digits_16           10x16 fixed '%'-':'     451 bytes
+ * Text_font_prop_7               5x8  prop  ' '-'~'     717 bytes
+ */
+
+#ifndef _FONTS_H_
+#define _FONTS_H_
+
+#include "_text.h"
+
+extern const Text_font_t Text_font_digits_16;
+extern const Text_font_t Text_font_prop_7;
+
+#endif // _FONTS_H_
@@ -6,58 +6,66 @@
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
-#include <math.h>
 
 #include "_main.h"
 #include "_glcd.h"
+#include "_glcd_backend.h" // bus backend, selected at compile time
 
 typedef unsigned char byte;
 typedef unsigned int word;
 
-// SimulIDE version-adaptive timing
-// SimulIDE 1.1.0+ requires different timing than 0.4.15
-#ifdef SIMULIDE_NEW_VERSION
-#define D_BEFORE 10 // SimulIDE 1.1.0+ needs longer setup time
-#define D_AFTER 100 // SimulIDE 1.1.0+ needs much longer hold time
-#define D_MIDDLE 5  // SimulIDE 1.1.0+ needs longer middle delay
-#else
-#define D_BEFORE 2 // SimulIDE 0.4.15 original timing
-#define D_AFTER 50 // SimulIDE 0.4.15 original timing
-#define D_MIDDLE 1 // SimulIDE 0.4.15 original timing
-#endif
-
 #define DISPON 0x3f
 #define DISPOFF 0x3e
 word d;
 
+#define DIRTY_CLEAN_START 0xFF // dirty_start > dirty_end means page is clean
+#define DIRTY_CLEAN_END 0x00
+
+unsigned char ScreenBuffer[8][128]; // screen buffer
+
+static unsigned char render_mode = GLCD_RENDER_IMMEDIATE;
+static unsigned char dirty_start[8] = {DIRTY_CLEAN_START, DIRTY_CLEAN_START, DIRTY_CLEAN_START, DIRTY_CLEAN_START,
+                                       DIRTY_CLEAN_START, DIRTY_CLEAN_START, DIRTY_CLEAN_START, DIRTY_CLEAN_START}; // First dirty column per page
+static unsigned char dirty_end[8];                                                                                  // Last dirty column per page
+static GLCD_bus_stats_t bus_stats;
+static unsigned char data_invert = 0x00; // 0xFF: panel shows ScreenBuffer inverted
+
+// Background refresh (GLCD_Refresh_tick from a timer ISR)
+#ifdef GLCD_DOUBLE_BUFFER
+static unsigned char FrontBuffer[8][128]; // frame being streamed to the panel
+#define REFRESH_SOURCE FrontBuffer
+#else
+#define REFRESH_SOURCE ScreenBuffer // drawing must wait for GLCD_Refresh_ready()
+#endif
+static volatile unsigned char refresh_enabled = 0;
+static volatile unsigned char refresh_busy = 0; // frame handed over, not yet sent
+static unsigned char refresh_bytes_per_tick = GLCD_REFRESH_BYTES_PER_TICK;
+static unsigned char refresh_start[8]; // spans of the frame in flight
+static unsigned char refresh_end[8];
+static unsigned char refresh_page; // streaming position
+static unsigned char refresh_col;
+static volatile unsigned int refresh_frames = 0;
+
+#define BUS_COUNT_COMMAND()                                \
+    do                                                     \
+    {                                                      \
+        bus_stats.commands++;                              \
+        bus_stats.bus_time_us += GLCD_BUS_TRANSACTION_US;  \
+    } while (0)
+
+#define BUS_COUNT_DATA()                                   \
+    do                                                     \
+    {                                                      \
+        bus_stats.data_bytes++;                            \
+        bus_stats.bus_time_us += GLCD_BUS_TRANSACTION_US;  \
+    } while (0)
+
 byte xchar, ychar; /* x character(0-7), y character(0-19) */
 
 /* Initialize GLCD port directions for SimulIDE compatibility */
 void glcd_port_init(void)
 {
-    // Set up port directions for GLCD
-    SetBit(DDRA, DDA0);
-    SetBit(DDRA, DDA1);
-    SetBit(DDRA, DDA2);
-    SetBit(DDRA, DDA3);
-    SetBit(DDRA, DDA4);
-    SetBit(DDRA, DDA5);
-    SetBit(DDRA, DDA6);
-    SetBit(DDRA, DDA7);
-    SetBit(DDRE, DDE4);
-    SetBit(DDRE, DDE5);
-    SetBit(DDRE, DDE6);
-    SetBit(DDRE, DDE7);
-    SetBit(DDRG, DDG1); // RW pin as output
-
-    // Initialize control signals to safe state
-    ClrBit(PORTE, PORTE4); // RS = 0
-    ClrBit(PORTE, PORTE5); // E = 0
-    ClrBit(PORTE, PORTE6); // CS2 = 0
-    ClrBit(PORTE, PORTE7); // CS1 = 0
-    ClrBit(PORTG, PORTG1); // RW = 0 (write mode)
-    PORTA = 0x00;          // Clear data bus
-
+    glcd_backend_init();
     _delay_ms(50); // Allow ports to stabilize
 }
 
@@ -158,100 +166,46 @@ const byte font[95][5] PROGMEM = {                                 /* 5x7 ASCII
                                   {0x00, 0x41, 0x36, 0x08, 0x00},  /* 0x7d } */
                                   {0x08, 0x04, 0x08, 0x10, 0x08}}; /* 0x7e ~ */
 
-/* command output */
+// the same table as a _text.c font (5 columns + 1 blank, 7 rows)
+const Text_font_t Text_font_5x7 PROGMEM = {0x20, 0x7E, 5, 7, 1, 0, 0, &font[0][0]};
 
-// RS	pin PE4 [L:command, H:data]		PIN14
-// RW	pin PG1 [L:write, H:read]		PIN44
-// E	pin PE5 [L:off, H:on]			PIN1
-// CS1	pin PE7 [L:off, H:on]			PIN16
-// CS2	pin PE6 [L:off, H:on]			PIN17
-// DATA pin PORTA
-// SetBit(x,y);
-// ClrBit(x,y);
+/* command output */
 
 void cmndl(byte cmd) // left 128x64
 {
-    PORTA = cmd;           // DATA pin PORTA	write vertical upwards at current character position
-    ClrBit(PORTE, PORTE4); // PORTE.4 = 0;		//	RS
-    ClrBit(PORTG, PORTG1); // PORTG.1 = 0;		//	RW (write mode)
-    ClrBit(PORTE, PORTE6); // PORTE.6 = 0;
-    SetBit(PORTE, PORTE7); // PORTE.7 = 1;		// left pannel
-    _delay_us(D_MIDDLE);
-    SetBit(PORTE, PORTE5); // PORTE.5 = 1;		//  E
-    _delay_us(D_BEFORE);
-    ClrBit(PORTE, PORTE5); // PORTE.5 = 0;		// E
-    _delay_us(D_AFTER);
+    glcd_backend_write(cmd, 0, GLCD_CS_LEFT);
+    BUS_COUNT_COMMAND();
 }
 
 void cmndr(byte cmd) // right 128x64
 {
-    PORTA = cmd;           // DATA pin PORTA
-    ClrBit(PORTE, PORTE4); // RS
-    ClrBit(PORTG, PORTG1); // PORTG.1 = 0;		//	RW (write mode)
-    SetBit(PORTE, PORTE6); // PORTE.6 = 1;  right pannel
-    ClrBit(PORTE, PORTE7); // PORTE.7 = 0;
-    _delay_us(D_MIDDLE);
-    SetBit(PORTE, PORTE5); // PORTE.5 = 1;		//  E
-    _delay_us(D_BEFORE);
-    ClrBit(PORTE, PORTE5); // PORTE.5 = 0;		// E
-    _delay_us(D_AFTER);
+    glcd_backend_write(cmd, 0, GLCD_CS_RIGHT);
+    BUS_COUNT_COMMAND();
 }
 
 void cmnda(byte cmd) // both 128x64
 {
-    PORTA = cmd;           // DATA pin PORTA
-    ClrBit(PORTE, PORTE4); // RS
-    ClrBit(PORTG, PORTG1); // PORTG.1 = 0;		//	RW (write mode)
-    SetBit(PORTE, PORTE6);
-    SetBit(PORTE, PORTE7); // PORTE.6 = 1;  PORTE.7 = 1;	both pannels
-    _delay_us(D_MIDDLE);
-    SetBit(PORTE, PORTE5); // PORTE.5 = 1;		//  E
-    _delay_us(D_BEFORE);
-    ClrBit(PORTE, PORTE5); // PORTE.5 = 0;		// E
-    _delay_us(D_AFTER);
+    glcd_backend_write(cmd, 0, GLCD_CS_BOTH);
+    BUS_COUNT_COMMAND();
 }
 
 /* 1 character output  */
 void datal(byte dat) // left 128x64
 {
-    PORTA = dat;           // DATA pin PORTA
-    SetBit(PORTE, PORTE4); // PORTE.4 = 1;  // RS
-    ClrBit(PORTG, PORTG1); // PORTG.1 = 0;  // RW (write mode)
-    ClrBit(PORTE, PORTE6);
-    SetBit(PORTE, PORTE7); // PORTE.6 = 0;  PORTE.7 = 1;
-    _delay_us(D_MIDDLE);
-    SetBit(PORTE, PORTE5); // PORTE.5 = 1;		//  E
-    _delay_us(D_BEFORE);
-    ClrBit(PORTE, PORTE5); // PORTE.5 = 0;		// E
-    _delay_us(D_AFTER);
+    glcd_backend_write(dat ^ data_invert, GLCD_RS_DATA, GLCD_CS_LEFT);
+    BUS_COUNT_DATA();
 }
 
 void datar(byte dat) // right 128x64
 {
-    PORTA = dat;           // DATA pin PORTA
-    SetBit(PORTE, PORTE4); // PORTE.4 = 1;  // RS
-    ClrBit(PORTG, PORTG1); // PORTG.1 = 0;  // RW (write mode)
-    SetBit(PORTE, PORTE6);
-    ClrBit(PORTE, PORTE7); // PORTE.6 = 1;  PORTE.7 = 0;
-    _delay_us(D_MIDDLE);
-    SetBit(PORTE, PORTE5); // PORTE.5 = 1;		//  E
-    _delay_us(D_BEFORE);
-    ClrBit(PORTE, PORTE5); // PORTE.5 = 0;		// E
-    _delay_us(D_AFTER);
+    glcd_backend_write(dat ^ data_invert, GLCD_RS_DATA, GLCD_CS_RIGHT);
+    BUS_COUNT_DATA();
 }
 
 void dataa(byte dat) // both 128x64
 {
-    PORTA = dat;           // DATA pin PORTA
-    SetBit(PORTE, PORTE4); // PORTE.4 = 1;  // RS
-    ClrBit(PORTG, PORTG1); // PORTG.1 = 0;  // RW (write mode)
-    SetBit(PORTE, PORTE6);
-    SetBit(PORTE, PORTE7); // PORTE.6 = 1;  PORTE.7 = 1;
-    _delay_us(D_MIDDLE);
-    SetBit(PORTE, PORTE5); // PORTE.5 = 1;		//  E
-    _delay_us(D_BEFORE);
-    ClrBit(PORTE, PORTE5); // PORTE.5 = 0;		// E
-    _delay_us(D_AFTER);
+    glcd_backend_write(dat ^ data_invert, GLCD_RS_DATA, GLCD_CS_BOTH);
+    BUS_COUNT_DATA();
 }
 
 /* GLCD Clear */
@@ -261,21 +215,30 @@ void lcd_clear(void) /* clear LCD screen */
     x = 0xB8; /* X start address Page 0*/
     y = 0x40; /* Y start address Column 0*/
 
-    // Enhanced clear for SimulIDE compatibility
     for (i = 0; i <= 7; i++)
     {
         cmnda(x);
-        _delay_us(50); // Extra delay for SimulIDE
         cmnda(y);
-        _delay_us(50); // Extra delay for SimulIDE
         for (j = 0; j <= 63; j++)
         {
-            dataa(0x00);   /* clear CS1 and CS2 */
+            dataa(0x00); /* clear CS1 and CS2, column auto-increments */
+#ifdef GLCD_FIXED_DELAYS
             _delay_us(10); // Small delay between data writes for SimulIDE
+#endif
         }
         x++;
+#ifdef GLCD_FIXED_DELAYS
+        bus_stats.bus_time_us += 64 * 10; // Extra SimulIDE padding above
+#endif
+    }
+
+    // Panel is blank now: keep the RAM copy in step and drop pending spans
+    memset(ScreenBuffer, 0x00, sizeof(ScreenBuffer));
+    for (i = 0; i < 8; i++)
+    {
+        dirty_start[i] = DIRTY_CLEAN_START;
+        dirty_end[i] = DIRTY_CLEAN_END;
     }
-    _delay_ms(10); // Final stabilization delay
 }
 
 /* GLCD Initialize */
@@ -305,16 +268,41 @@ void lcd_init(void)
     _delay_ms(50);
 }
 
+/*
+ * Text goes through ScreenBuffer like every other primitive, so a later
+ * GLCD_Flush() or background refresh never wipes it. In deferred mode the
+ * glyph columns are only marked dirty.
+ */
+static byte text_col; /* panel column (0-127) of the next glyph byte */
+
 /* character position */
 void lcd_xy(byte x, byte y)
 {
-    xchar = x;                       /* x = 0~7 */
-    ychar = y;                       /* y = 0~9 */
-    cmnda(0xB8 + xchar);             /* X address */
-    if (ychar <= 9)                  /* if y <= 9, CS1 Y address 8x10 characters for a pannel 4 offset */
-        cmndl(0x40 + ychar * 6 + 4); /* 5x7 -> 6x8 actually bottom for cursor right for empty vertical */
-    else                             /* if y >= 10, CS2 Y address */
-        cmndr(0x40 + (ychar - 10) * 6);
+    xchar = x; /* x = 0~7 */
+    ychar = y; /* y = 0~19 */
+    if (ychar <= 9)
+        text_col = ychar * 6 + 4; /* CS1: 8x10 characters for a pannel, 4 offset */
+    else
+        text_col = 64 + (ychar - 10) * 6; /* CS2 */
+
+    if (render_mode == GLCD_RENDER_IMMEDIATE)
+        GLCD_Axis_xy(xchar, text_col);
+}
+
+// one glyph column at the text cursor
+static void lcd_text_byte(byte dat)
+{
+    if ((xchar > 7) || (text_col > 127))
+        return;
+
+    ScreenBuffer[xchar][text_col] = dat;
+    if (render_mode == GLCD_RENDER_DEFERRED)
+        GLCD_Mark_dirty(xchar, text_col, text_col);
+    else if (text_col <= 63)
+        datal(dat);
+    else
+        datar(dat);
+    text_col++;
 }
 
 /* character output */
@@ -323,27 +311,19 @@ void lcd_char(byte character)
     byte i;
     for (i = 0; i <= 4; i++)
     {
-        if (ychar <= 9) /* if y <= 9, CS1 */
-            datal(pgm_read_byte(&font[character - 0x20][i]));
-        else /* if y >= 10, CS2 */
-            datar(pgm_read_byte(&font[character - 0x20][i]));
+        lcd_text_byte(pgm_read_byte(&font[character - 0x20][i]));
     }
-    if (ychar <= 9)
-        datal(0x00); /* last byte 0x00 making 6x8 pixel per a character */
-    else
-        datar(0x00); /* last byte 0x00 making 6x8 pixel per a character*/
+    lcd_text_byte(0x00); /* last byte 0x00 making 6x8 pixel per a character */
 }
 
 /* character sequence output */
 void lcd_string(byte x, byte y, char *string)
 {
-    xchar = x;
-    ychar = y;
     lcd_xy(x, y);
     while (*string != '\0') /* null */
     {
-        if (ychar == 10) /* change from CS1 to CS2 */
-            cmndr(0x40);
+        if ((ychar == 10) && (render_mode == GLCD_RENDER_IMMEDIATE))
+            cmndr(0x40); /* change from CS1 to CS2 */
         lcd_char(*string); /* display a character */
         string++;          /* next character */
         ychar++;           /* next line */
@@ -363,152 +343,486 @@ void GLCD_Axis_xy(unsigned char x, unsigned char y) // draw a byte downwards
     }
 }
 
-unsigned char ScreenBuffer[8][128]; // screen buffer
-// draw a dot on GLCD
-void GLCD_Dot(unsigned char xx, unsigned char y)
+/*
+ * Raster target: _raster.c uses x = column, y = row, so the adapter swaps
+ * the axes of this driver (x = row 0..63, y = column 0..127).
+ */
+static void glcd_raster_pixel(unsigned char col, unsigned char row, unsigned char color)
 {
-    unsigned char x, i;
+    unsigned char page = row >> 3;
+    unsigned char old = ScreenBuffer[page][col];
+    unsigned char dat = Raster_apply(old, 1 << (row & 7), color);
 
-    // check resolution (128.64)
-    if ((xx > 63) || (y > 127))
-        return;
-    x = xx / 8; // calculate x address
-    i = xx % 8; // pixel number in th x address downwards
-    if (i == 0)
+    ScreenBuffer[page][col] = dat;
+    if (render_mode == GLCD_RENDER_DEFERRED)
     {
-        i = 0x01;
-    } // top pixel
-    else if (i == 1)
+        if (dat != old) // only a real change makes the byte dirty
+            GLCD_Mark_dirty(page, col, col);
+        return; // GLCD_Flush() sends it later
+    }
+
+    GLCD_Axis_xy(page, col); // draw dot on GLCD screen
+    if (col <= 63)
+        datal(dat);
+    else
+        datar(dat);
+}
+
+// one masked byte per column; immediate mode sends them with auto-increment
+static void glcd_raster_span(unsigned char page, unsigned char y1, unsigned char y2, unsigned char mask, unsigned char color)
+{
+    unsigned char y;
+
+    if (render_mode == GLCD_RENDER_DEFERRED)
     {
-        i = 0x02;
+        for (y = y1; y <= y2; y++)
+        {
+            ScreenBuffer[page][y] = Raster_apply(ScreenBuffer[page][y], mask, color);
+        }
+        GLCD_Mark_dirty(page, y1, y2);
+        return;
     }
-    else if (i == 2)
+
+    GLCD_Axis_xy(page, y1);
+    for (y = y1; y <= y2; y++)
     {
-        i = 0x04;
+        ScreenBuffer[page][y] = Raster_apply(ScreenBuffer[page][y], mask, color);
+        if (y <= 63)
+        {
+            datal(ScreenBuffer[page][y]);
+        }
+        else
+        {
+            if ((y == 64) && (y1 < 64))
+                cmndr(0x40); // continue on the right controller
+            datar(ScreenBuffer[page][y]);
+        }
     }
-    else if (i == 3)
+}
+
+// whole bytes for columns y1..y2 of one page (text fast path): no read-modify-write
+static void glcd_raster_put(unsigned char page, unsigned char y1, unsigned char y2, const unsigned char *data)
+{
+    unsigned char y;
+
+    if (render_mode == GLCD_RENDER_DEFERRED)
     {
-        i = 0x08;
+        memcpy(&ScreenBuffer[page][y1], data, y2 - y1 + 1);
+        GLCD_Mark_dirty(page, y1, y2);
+        return;
     }
-    else if (i == 4)
+
+    GLCD_Axis_xy(page, y1);
+    for (y = y1; y <= y2; y++)
     {
-        i = 0x10;
+        ScreenBuffer[page][y] = *data++;
+        if (y <= 63)
+        {
+            datal(ScreenBuffer[page][y]);
+        }
+        else
+        {
+            if ((y == 64) && (y1 < 64))
+                cmndr(0x40); // continue on the right controller
+            datar(ScreenBuffer[page][y]);
+        }
     }
-    else if (i == 5)
+}
+
+const Raster_target_t GLCD_raster = {128, 64, glcd_raster_pixel, glcd_raster_span, glcd_raster_put};
+
+// draw a dot on GLCD
+void GLCD_Dot(unsigned char xx, unsigned char y)
+{
+    // check resolution (128.64)
+    if ((xx > 63) || (y > 127))
+        return;
+    glcd_raster_pixel(y, xx, RASTER_SET); // OR old data with new data
+}
+
+void ScreenBuffer_clear(void)
+{
+    unsigned char i, j;
+
+    for (i = 0; i < 8; i++)
     {
-        i = 0x20;
+        for (j = 0; j < 128; j++)
+        {
+            if ((render_mode == GLCD_RENDER_DEFERRED) && ScreenBuffer[i][j])
+            {
+                GLCD_Mark_dirty(i, j, j); // pixel goes dark on next flush
+            }
+            ScreenBuffer[i][j] = 0x00;
+        }
     }
-    else if (i == 6)
+}
+
+/*
+ * =============================================================================
+ * DEFERRED RENDERING - dirty column spans per page
+ * =============================================================================
+ *
+ * In GLCD_RENDER_IMMEDIATE mode every GLCD_Dot() costs three bus transactions
+ * (page command, column command, data byte). In GLCD_RENDER_DEFERRED mode
+ * the drawing primitives only change ScreenBuffer and widen a dirty span
+ * [dirty_start..dirty_end] of the touched page. GLCD_Flush() then sends
+ * each span with ONE page and ONE column command per controller, followed
+ * by the data bytes - the KS0108 increments the column address by itself.
+ *
+ * Text functions (lcd_string, lcd_char) draw into ScreenBuffer as well and
+ * follow the same mode, so flushed spans and text never overwrite each other.
+ */
+void GLCD_Set_render_mode(unsigned char mode)
+{
+    unsigned char page;
+
+    if (mode == render_mode)
+        return;
+
+    if (mode == GLCD_RENDER_IMMEDIATE)
     {
-        i = 0x40;
+        GLCD_Refresh_stop(); // no-op unless the background refresher runs
+        GLCD_Flush();        // leave no pending pixels behind
     }
     else
     {
-        i = 0x80;
-    } // bottom pixel
+        for (page = 0; page < 8; page++) // panel already matches buffer
+        {
+            dirty_start[page] = DIRTY_CLEAN_START;
+            dirty_end[page] = DIRTY_CLEAN_END;
+        }
+    }
+    render_mode = mode;
+}
 
-    ScreenBuffer[x][y] |= i; // OR old data with new data
-    GLCD_Axis_xy(x, y);      // draw dot on GLCD screen
-    if (y <= 63)
+unsigned char GLCD_Get_render_mode(void)
+{
+    return render_mode;
+}
+
+// widen the dirty span of a page to include columns y1..y2
+void GLCD_Mark_dirty(unsigned char page, unsigned char y1, unsigned char y2)
+{
+    if ((page > 7) || (y1 > y2) || (y2 > 127))
+        return;
+
+    if (y1 < dirty_start[page])
+        dirty_start[page] = y1;
+    if (y2 > dirty_end[page])
+        dirty_end[page] = y2;
+}
+
+// panel content unknown (reset, other writer): every column is dirty
+void GLCD_Invalidate(void)
+{
+    unsigned char page;
+
+    for (page = 0; page < 8; page++)
     {
-        datal(ScreenBuffer[x][y]);
+        dirty_start[page] = 0;
+        dirty_end[page] = 127;
     }
-    else
+}
+
+// 1: the panel shows ScreenBuffer inverted (set pixels dark background)
+void GLCD_Set_inverted(unsigned char on)
+{
+    data_invert = on ? 0xFF : 0x00;
+    GLCD_Invalidate(); // every byte on the panel changes
+    if (render_mode == GLCD_RENDER_IMMEDIATE)
+        GLCD_Flush();
+}
+
+// RAM row shown on the top line of the panel (hardware vertical scroll)
+void GLCD_Set_start_line(unsigned char line)
+{
+    cmnda(0xC0 | (line & 0x3F));
+}
+
+// send all dirty spans, using the column auto-increment of the controllers
+void GLCD_Flush(void)
+{
+    unsigned char page, y, last;
+
+    if (refresh_enabled)
     {
-        datar(ScreenBuffer[x][y]);
+        // the background refresher sends it; with interrupts disabled (or
+        // from the tick ISR itself) nobody else drains the frame in flight
+        while (!GLCD_Present())
+        {
+            if (!(SREG & (1 << SREG_I)))
+                GLCD_Refresh_stream(255);
+        }
+        if (!(SREG & (1 << SREG_I)))
+        {
+            while (refresh_busy)
+                GLCD_Refresh_stream(255);
+        }
+        return;
+    }
+
+    for (page = 0; page < 8; page++)
+    {
+        if (dirty_start[page] > dirty_end[page])
+            continue; // clean page
+
+        y = dirty_start[page];
+        last = dirty_end[page];
+        dirty_start[page] = DIRTY_CLEAN_START;
+        dirty_end[page] = DIRTY_CLEAN_END;
+
+        GLCD_Flush_span(page, y, last);
     }
 }
 
-void ScreenBuffer_clear(void)
+// send columns y..last of one page now, without dirty tracking
+// (not while the background refresher owns the bus)
+void GLCD_Flush_span(unsigned char page, unsigned char y, unsigned char last)
 {
-    unsigned char i, j;
+    if ((page > 7) || (y > last) || (last > 127))
+        return;
 
-    for (i = 0; i < 8; i++)
+    if ((y <= 63) && (last >= 64))
+        cmnda(0xB8 + page); // span crosses CS1/CS2: one page command for both
+    else if (y <= 63)
+        cmndl(0xB8 + page);
+    else
+        cmndr(0xB8 + page);
+
+    if (y <= 63) // left controller part
     {
-        for (j = 0; j < 128; j++)
+        cmndl(0x40 + y);
+        for (; (y <= last) && (y <= 63); y++)
         {
-            ScreenBuffer[i][j] = 0x00;
+            datal(ScreenBuffer[page][y]);
+        }
+    }
+    if (last >= 64) // right controller part
+    {
+        cmndr(0x40 + y - 64);
+        for (; y <= last; y++)
+        {
+            datar(ScreenBuffer[page][y]);
         }
     }
 }
 
-void GLCD_Line(unsigned char x1, unsigned char y1, unsigned char x2, unsigned char y2)
+void GLCD_Get_bus_stats(GLCD_bus_stats_t *stats)
+{
+    unsigned char sreg_backup = SREG; // refresher ISR updates the counters
+    cli();
+    *stats = bus_stats;
+    SREG = sreg_backup;
+}
+
+void GLCD_Reset_bus_stats(void)
+{
+    unsigned char sreg_backup = SREG;
+    cli();
+    bus_stats.commands = 0;
+    bus_stats.data_bytes = 0;
+    bus_stats.bus_time_us = 0;
+    SREG = sreg_backup;
+}
+
+/*
+ * =============================================================================
+ * BACKGROUND REFRESH - timer ISR streams the frame to the panel
+ * =============================================================================
+ *
+ * GLCD_Flush() blocks for the whole transfer. With the refresher, the
+ * main program only hands a finished frame over (GLCD_Present) and a
+ * timer ISR calling GLCD_Refresh_tick() sends at most bytes_per_tick
+ * dirty bytes per interrupt, e.g. 32 bytes per 1ms Timer2 tick.
+ *
+ * Frame-swap handshake (default, single buffer):
+ *   if (GLCD_Refresh_ready())      // previous frame completely sent
+ *   {
+ *       ScreenBuffer_clear();       // draw the next frame
+ *       GLCD_Line(...);
+ *       GLCD_Present();
+ *   }
+ *   read_sensors();                 // runs at full rate meanwhile
+ *
+ * With -DGLCD_DOUBLE_BUFFER (+1KB RAM) GLCD_Present() copies the dirty
+ * spans into a front buffer, so drawing may continue at once; a frame
+ * presented while the previous one is still in flight is refused (0)
+ * and its dirty spans stay pending for the next GLCD_Present().
+ *
+ * While the refresher runs, the ISR owns the bus: do not call lcd_clear or
+ * the cmnd/data functions (GLCD_Refresh_stop first). Text is fine in
+ * GLCD_RENDER_DEFERRED mode, it only changes ScreenBuffer.
+ */
+void GLCD_Refresh_start(unsigned char bytes_per_tick)
+{
+    GLCD_Set_render_mode(GLCD_RENDER_DEFERRED);
+    refresh_bytes_per_tick = bytes_per_tick ? bytes_per_tick : 1;
+    refresh_busy = 0;
+    refresh_enabled = 1;
+}
+
+// finish the frame in flight synchronously and give the bus back
+void GLCD_Refresh_stop(void)
+{
+    if (!refresh_enabled)
+        return;
+
+    refresh_enabled = 0; // ISR ignores the ticks from now on
+    while (refresh_busy)
+    {
+        GLCD_Refresh_stream(255);
+    }
+}
+
+unsigned char GLCD_Refresh_ready(void)
 {
-    int x, y;
-    if (y1 != y2) // if y1 != y2, y is variable
+    return !refresh_busy;
+}
+
+unsigned int GLCD_Refresh_frames(void)
+{
+    unsigned int frames;
+    unsigned char sreg_backup = SREG;
+    cli();
+    frames = refresh_frames;
+    SREG = sreg_backup;
+    return frames;
+}
+
+// hand the dirty spans to the refresher; 0 = previous frame still in flight
+unsigned char GLCD_Present(void)
+{
+    unsigned char page, dirty = 0;
+
+    if (refresh_busy)
+        return 0;
+
+    for (page = 0; page < 8; page++)
     {
-        if (y1 < y2) // x is function
+        refresh_start[page] = dirty_start[page];
+        refresh_end[page] = dirty_end[page];
+        if (dirty_start[page] <= dirty_end[page])
         {
-            for (y = y1; y <= y2; y++)
-            {
-                x = x1 + (y - y1) * (x2 - x1) / (y2 - y1);
-                GLCD_Dot(x, y);
-            }
+#ifdef GLCD_DOUBLE_BUFFER
+            memcpy(&FrontBuffer[page][dirty_start[page]], &ScreenBuffer[page][dirty_start[page]],
+                   dirty_end[page] - dirty_start[page] + 1);
+#endif
+            dirty = 1;
         }
-        else
+        dirty_start[page] = DIRTY_CLEAN_START;
+        dirty_end[page] = DIRTY_CLEAN_END;
+    }
+
+    if (dirty)
+    {
+        refresh_page = 0;
+        refresh_col = refresh_start[0];
+        refresh_busy = 1; // single byte store publishes the frame to the ISR
+    }
+    return 1;
+}
+
+// send up to max_bytes of the frame in flight
+void GLCD_Refresh_stream(unsigned char max_bytes)
+{
+    unsigned char addressed = 0; // page/column must be set at the start of a burst
+
+    while (refresh_busy && max_bytes)
+    {
+        if ((refresh_page > 7) || (refresh_col > refresh_end[refresh_page]))
         {
-            for (y = y1; y >= y2; y--)
+            // page done (or clean): move on
+            if (refresh_page < 8)
+                refresh_page++;
+            if (refresh_page > 7)
             {
-                x = x1 + (y - y1) * (x2 - x1) / (y2 - y1);
-                GLCD_Dot(x, y);
+                refresh_busy = 0;
+                refresh_frames++;
+                return;
             }
+            refresh_col = refresh_start[refresh_page];
+            addressed = 0;
+            continue;
         }
-    }
-    else if (x1 != x2) // if x1 != x2, x is variable
-    {
-        if (x1 < x2) // y is function
+
+        if (refresh_col <= 63)
         {
-            for (x = x1; x <= x2; x++)
+            if (!addressed)
             {
-                y = y1 + (x - x1) * (y2 - y1) / (x2 - x1);
-                GLCD_Dot(x, y);
+                cmndl(0xB8 + refresh_page);
+                cmndl(0x40 + refresh_col);
+                addressed = 1;
             }
+            datal(REFRESH_SOURCE[refresh_page][refresh_col]);
         }
         else
         {
-            for (x = x1; x >= x2; x--)
+            if (!addressed || (refresh_col == 64)) // new burst or CS1 -> CS2
             {
-                y = y1 + (x - x1) * (y2 - y1) / (x2 - x1);
-                GLCD_Dot(x, y);
+                cmndr(0xB8 + refresh_page);
+                cmndr(0x40 + refresh_col - 64);
+                addressed = 1;
             }
+            datar(REFRESH_SOURCE[refresh_page][refresh_col]);
         }
+        refresh_col++;
+        max_bytes--;
     }
-    else // if x1 == x2 and y1 == y2,
+}
+
+// call from a periodic timer ISR, e.g. after Timer2_ovf_handler()
+void GLCD_Refresh_tick(void)
+{
+    if (refresh_enabled)
     {
-        GLCD_Dot(x1, y1); // it is a dot
+        GLCD_Refresh_stream(refresh_bytes_per_tick);
     }
 }
 
+/*
+ * Shapes - integer Bresenham/midpoint rasterizers from _raster.c.
+ * Straight lines and fills are sent as page spans (one byte per column and
+ * page), so a filled 64x64 area costs 512 data bytes instead of 4096 dots.
+ */
+void GLCD_Line(unsigned char x1, unsigned char y1, unsigned char x2, unsigned char y2)
+{
+    Raster_line(&GLCD_raster, y1, x1, y2, x2, RASTER_SET);
+}
+
 // draw a rectangle
 void GLCD_Rectangle(unsigned char x1, unsigned char y1, unsigned char x2, unsigned char y2)
 {
-    GLCD_Line(x1, y1, x1, y2); // horizontal line
-    GLCD_Line(x2, y1, x2, y2);
-    GLCD_Line(x1, y1, x2, y1); // vertical line
-    GLCD_Line(x1, y2, x2, y2);
+    Raster_rect(&GLCD_raster, y1, x1, y2, x2, RASTER_SET);
 }
 
 // draw a circle
 void GLCD_Circle(unsigned char x1, unsigned char y1, unsigned char r)
 {
-    int x, y;
-    float s;
-    for (y = y1 - r * 3 / 4; y <= y1 + r * 3 / 4; y++) // draw with y variable
-    {
-        s = sqrt(r * r - (y - y1) * (y - y1)) + 0.5;
-        x = x1 + (unsigned char)s;
-        GLCD_Dot(x, y);
-        x = x1 - (unsigned char)s;
-        GLCD_Dot(x, y);
-    }
-    for (x = x1 - r * 3 / 4; x <= x1 + r * 3 / 4; x++) // draw with x variable
-    {
-        s = sqrt(r * r - (x - x1) * (x - x1)) + 0.5;
-        y = y1 + (unsigned char)s;
-        GLCD_Dot(x, y);
-        y = y1 - (unsigned char)s;
-        GLCD_Dot(x, y);
-    }
+    Raster_circle(&GLCD_raster, y1, x1, r, RASTER_SET);
+}
+
+// draw a filled rectangle (color: RASTER_SET, RASTER_CLEAR or RASTER_XOR)
+void GLCD_Fill_rectangle(unsigned char x1, unsigned char y1, unsigned char x2, unsigned char y2, unsigned char color)
+{
+    Raster_fill_rect(&GLCD_raster, y1, x1, y2, x2, color);
+}
+
+// draw a filled circle
+void GLCD_Fill_circle(unsigned char x1, unsigned char y1, unsigned char r, unsigned char color)
+{
+    Raster_fill_circle(&GLCD_raster, y1, x1, r, color);
+}
+
+// draw an ellipse: rx = radius along the rows (x), ry = along the columns (y)
+void GLCD_Ellipse(unsigned char x1, unsigned char y1, unsigned char rx, unsigned char ry)
+{
+    Raster_ellipse(&GLCD_raster, y1, x1, ry, rx, RASTER_SET);
+}
+
+// draw a filled ellipse
+void GLCD_Fill_ellipse(unsigned char x1, unsigned char y1, unsigned char rx, unsigned char ry, unsigned char color)
+{
+    Raster_fill_ellipse(&GLCD_raster, y1, x1, ry, rx, color);
 }
 
 // display 1-digit decimal number
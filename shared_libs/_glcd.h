@@ -1,3 +1,9 @@
+#ifndef _GLCD_H_
+#define _GLCD_H_
+
+#include "_raster.h" /* RASTER_SET / RASTER_CLEAR / RASTER_XOR */
+#include "_text.h"   /* Text_font_t */
+
 typedef unsigned char byte;
 
 void cmndl(byte cmd); /* lcd 명령 출력 */
@@ -23,7 +29,58 @@ void GLCD_Line(unsigned char x1, unsigned char y1, unsigned char x2, unsigned ch
 void GLCD_Rectangle(unsigned char x1, unsigned char y1, unsigned char x2, unsigned char y2); // 직사각형을 그립니다
 void GLCD_Circle(unsigned char x1, unsigned char y1, unsigned char r);                       // 원을 그립니다.
 
+/* Filled shapes and ellipses (color: RASTER_SET, RASTER_CLEAR, RASTER_XOR from _raster.h) */
+void GLCD_Fill_rectangle(unsigned char x1, unsigned char y1, unsigned char x2, unsigned char y2, unsigned char color);
+void GLCD_Fill_circle(unsigned char x1, unsigned char y1, unsigned char r, unsigned char color);
+void GLCD_Ellipse(unsigned char x1, unsigned char y1, unsigned char rx, unsigned char ry);
+void GLCD_Fill_ellipse(unsigned char x1, unsigned char y1, unsigned char rx, unsigned char ry, unsigned char color);
+
 unsigned char GLCD_1DigitDecimal(unsigned char number, unsigned char flag); // 1자리의 10진수 값을 표시합니다.
 void GLCD_2DigitDecimal(unsigned char number);                              // 2자리의 10진수 값을 표시합니다.
 void GLCD_3DigitDecimal(unsigned int number);                               // 3자리의 10진수 값을 표시합니다.
-void GLCD_4DigitDecimal(unsigned int number);                               // 4자리의 10진수 값을 표시합니다.
\ No newline at end of file
+void GLCD_4DigitDecimal(unsigned int number);                               // 4자리의 10진수 값을 표시합니다.
+
+/* Deferred rendering: primitives draw into ScreenBuffer, GLCD_Flush sends dirty spans */
+#define GLCD_RENDER_IMMEDIATE 0 /* every GLCD_Dot goes to the panel (default) */
+#define GLCD_RENDER_DEFERRED 1  /* GLCD_Dot only marks dirty columns */
+
+void GLCD_Set_render_mode(unsigned char mode);
+unsigned char GLCD_Get_render_mode(void);
+void GLCD_Mark_dirty(unsigned char page, unsigned char y1, unsigned char y2);
+void GLCD_Flush(void);
+void GLCD_Flush_span(unsigned char page, unsigned char y1, unsigned char y2); /* send now, no dirty marks */
+void GLCD_Invalidate(void);                   /* resend the whole ScreenBuffer on the next flush */
+void GLCD_Set_inverted(unsigned char on);     /* 1 = panel shows ScreenBuffer inverted */
+void GLCD_Set_start_line(unsigned char line); /* RAM row 0..63 shown at the top (scroll) */
+
+/* The core's frame buffer and drawing target (x = column, y = row) for
+ * driver layers built on _glcd.c (ks0108_complete.c, AVR-KS0108) */
+extern unsigned char ScreenBuffer[8][128];
+extern const Raster_target_t GLCD_raster;
+extern const Text_font_t Text_font_5x7; /* the lcd_char font for Text_set_font() */
+
+/* Bus accounting (all cmnd and data transactions since the last reset) */
+typedef struct
+{
+    unsigned long commands;    /* page/column/control commands */
+    unsigned long data_bytes;  /* display data bytes */
+    unsigned long bus_time_us; /* estimated time spent in bus delays */
+} GLCD_bus_stats_t;
+
+void GLCD_Get_bus_stats(GLCD_bus_stats_t *stats);
+void GLCD_Reset_bus_stats(void);
+
+/* Background refresh: a timer ISR calls GLCD_Refresh_tick(), main calls GLCD_Present() */
+#ifndef GLCD_REFRESH_BYTES_PER_TICK
+#define GLCD_REFRESH_BYTES_PER_TICK 32 /* about 50us of bus time per 1ms tick */
+#endif
+
+void GLCD_Refresh_start(unsigned char bytes_per_tick);
+void GLCD_Refresh_stop(void);
+unsigned char GLCD_Refresh_ready(void); /* 1 = ScreenBuffer may be drawn */
+unsigned char GLCD_Present(void);       /* 1 = frame accepted */
+unsigned int GLCD_Refresh_frames(void);
+void GLCD_Refresh_stream(unsigned char max_bytes);
+void GLCD_Refresh_tick(void);
+
+#endif // _GLCD_H_
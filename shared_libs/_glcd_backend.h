@@ -0,0 +1,52 @@
+/*
+ * _glcd_backend.h - KS0108 Bus Backend Selection
+ * Educational Version for Assembly→C→Python Learning Progression
+ *
+ * PURPOSE:
+ * _glcd.c is the one graphics core (ScreenBuffer, primitives, text). The
+ * only thing that touches the panel is a backend with two functions:
+ *
+ *   static void glcd_backend_init(void);
+ *       Port directions and idle levels, called from glcd_port_init()
+ *   static void glcd_backend_write(unsigned char value, unsigned char rs,
+ *                                  unsigned char cs);
+ *       One bus write. rs: 0 = command, GLCD_RS_DATA = display data
+ *       cs: GLCD_CS_LEFT, GLCD_CS_RIGHT or GLCD_CS_BOTH
+ *
+ * plus GLCD_BUS_TRANSACTION_US, the estimated time of one write for the
+ * bus statistics.
+ *
+ * COMPILE-TIME SELECTION:
+ * Backends are headers included by _glcd.c only, so the bus code is
+ * inlined into the core and backends that are not selected are never
+ * compiled. Select with -DGLCD_BACKEND=...
+ *
+ *   GLCD_BACKEND_PARALLEL  any pin map (board wiring by default), fixed
+ *                          timing or opt-in busy-flag polling (default)
+ *   GLCD_BACKEND_HOST      KS0108 emulator for PC builds (host/build_host.sh)
+ *
+ * Other drivers (ks0108_complete.c, AVR-KS0108) are API layers on top of
+ * _glcd.c and use the same backend.
+ */
+
+#ifndef _GLCD_BACKEND_H_
+#define _GLCD_BACKEND_H_
+
+#define GLCD_BACKEND_PARALLEL 0
+#define GLCD_BACKEND_HOST 1
+
+#ifndef GLCD_BACKEND
+#define GLCD_BACKEND GLCD_BACKEND_PARALLEL
+#endif
+
+#if GLCD_BACKEND == GLCD_BACKEND_PARALLEL
+#include "_glcd_parallel.h"
+#elif GLCD_BACKEND == GLCD_BACKEND_HOST
+#include "_glcd_host.h"
+#else
+#error "_glcd_backend.h: unknown GLCD_BACKEND"
+#endif
+
+#define GLCD_CS_BOTH (GLCD_CS_LEFT | GLCD_CS_RIGHT)
+
+#endif // _GLCD_BACKEND_H_
@@ -0,0 +1,215 @@
+/*
+ * _glcd_host.h - KS0108 Emulator Backend (host build, Linux/PC)
+ * Educational Version for Assembly→C→Python Learning Progression
+ *
+ * Included by _glcd.c through _glcd_backend.h - do not include elsewhere.
+ * Build with -DGLCD_BACKEND=GLCD_BACKEND_HOST and the AVR header shims in
+ * shared_libs/host (see host/build_host.sh).
+ *
+ * MODEL:
+ * Two KS0108 controllers (CS1 = columns 0..63, CS2 = columns 64..127),
+ * each with its own 8 x 64 byte display RAM, page register, column counter
+ * (auto-increments and wraps from 63 to 0 inside the same controller, as on
+ * the real chip), display start line and on/off flag. Every bus write from
+ * the core is decoded exactly like the panel does, so a wrong address
+ * sequence shows up as a wrong picture, not just a wrong counter.
+ *
+ * The emulator API (frame capture, golden image compare, protocol errors)
+ * is declared in host/glcd_emulator.h.
+ */
+
+#ifndef _GLCD_HOST_H_
+#define _GLCD_HOST_H_
+
+#include <stdio.h>
+#include <string.h>
+#include "host/glcd_emulator.h"
+
+// Estimated bus time of one write: E cycle >= 1000ns, as the busy-polling parallel build
+#define GLCD_BUS_TRANSACTION_US 1
+
+// Bit values of the rs and cs arguments (any distinct bits will do)
+#define GLCD_RS_DATA 0x01
+#define GLCD_CS_LEFT 0x01  // CS1, left pannel
+#define GLCD_CS_RIGHT 0x02 // CS2, right pannel
+
+typedef struct
+{
+    unsigned char ram[8][64]; // display RAM, bit 0 = top row of a page
+    unsigned char page;       // X address register (0..7)
+    unsigned char column;     // Y address counter (0..63)
+    unsigned char start_line; // RAM row shown at the top of the panel
+    unsigned char on;         // display on/off
+} glcd_host_chip_t;
+
+static glcd_host_chip_t glcd_host_chip[2]; // [0] = CS1 left, [1] = CS2 right
+static unsigned long glcd_host_bad_commands;
+
+static void glcd_host_command(glcd_host_chip_t *chip, unsigned char cmd)
+{
+    if ((cmd & 0xFE) == 0x3E) // 0011111D: display on/off
+        chip->on = cmd & 0x01;
+    else if ((cmd & 0xC0) == 0x40) // 01YYYYYY: column
+        chip->column = cmd & 0x3F;
+    else if ((cmd & 0xF8) == 0xB8) // 10111XXX: page
+        chip->page = cmd & 0x07;
+    else if ((cmd & 0xC0) == 0xC0) // 11ZZZZZZ: display start line
+        chip->start_line = cmd & 0x3F;
+    else
+        glcd_host_bad_commands++; // not a KS0108 instruction
+}
+
+static void glcd_backend_init(void)
+{
+    memset(glcd_host_chip, 0, sizeof(glcd_host_chip)); // power-on: RAM undefined, display off
+    glcd_host_bad_commands = 0;
+}
+
+// one bus write, decoded by every selected controller
+static void glcd_backend_write(unsigned char value, unsigned char rs, unsigned char cs)
+{
+    unsigned char i;
+    glcd_host_chip_t *chip;
+
+    if (!(cs & (GLCD_CS_LEFT | GLCD_CS_RIGHT)))
+    {
+        glcd_host_bad_commands++; // write with no controller selected
+        return;
+    }
+    for (i = 0; i < 2; i++)
+    {
+        if (!(cs & (i ? GLCD_CS_RIGHT : GLCD_CS_LEFT)))
+            continue;
+
+        chip = &glcd_host_chip[i];
+        if (rs)
+        {
+            chip->ram[chip->page][chip->column] = value;
+            chip->column = (chip->column + 1) & 0x3F;
+        }
+        else
+        {
+            glcd_host_command(chip, value);
+        }
+    }
+}
+
+/* Emulator API (host/glcd_emulator.h) */
+
+unsigned char GLCD_Host_pixel(unsigned char x, unsigned char y)
+{
+    const glcd_host_chip_t *chip = &glcd_host_chip[(x >> 6) & 1];
+    unsigned char line = (y + chip->start_line) & 0x3F;
+
+    if (!chip->on)
+        return 0;
+    return (chip->ram[line >> 3][x & 0x3F] >> (line & 7)) & 1;
+}
+
+unsigned char GLCD_Host_ram(unsigned char page, unsigned char column)
+{
+    return glcd_host_chip[(column >> 6) & 1].ram[page & 7][column & 0x3F];
+}
+
+unsigned int GLCD_Host_diff_buffer(void)
+{
+    unsigned int diff = 0;
+    unsigned char page, column;
+
+    for (page = 0; page < 8; page++)
+    {
+        for (column = 0; column < 128; column++)
+        {
+            if (GLCD_Host_ram(page, column) != ScreenBuffer[page][column])
+                diff++;
+        }
+    }
+    return diff;
+}
+
+unsigned long GLCD_Host_bad_commands(void)
+{
+    return glcd_host_bad_commands;
+}
+
+// binary PBM (P4): 1 = black = pixel set, rows packed MSB first
+int GLCD_Host_save_pbm(const char *path)
+{
+    FILE *f = fopen(path, "wb");
+    unsigned char x, y, i, bits;
+
+    if (!f)
+        return -1;
+    fprintf(f, "P4\n%d %d\n", GLCD_HOST_WIDTH, GLCD_HOST_HEIGHT);
+    for (y = 0; y < GLCD_HOST_HEIGHT; y++)
+    {
+        for (x = 0; x < GLCD_HOST_WIDTH; x += 8)
+        {
+            bits = 0;
+            for (i = 0; i < 8; i++)
+                bits |= GLCD_Host_pixel(x + i, y) << (7 - i);
+            fputc(bits, f);
+        }
+    }
+    return fclose(f) ? -1 : 0;
+}
+
+// next header number of a PBM file, skipping white space and # comments
+static int glcd_host_pbm_number(FILE *f)
+{
+    int c, value = 0;
+
+    do
+    {
+        c = fgetc(f);
+        if (c == '#')
+            while ((c != '\n') && (c != EOF))
+                c = fgetc(f);
+    } while ((c == ' ') || (c == '\t') || (c == '\r') || (c == '\n'));
+
+    if ((c < '0') || (c > '9'))
+        return -1;
+    while ((c >= '0') && (c <= '9'))
+    {
+        value = value * 10 + (c - '0');
+        c = fgetc(f);
+    }
+    return value; // the single white space after the height is consumed here
+}
+
+long GLCD_Host_compare_pbm(const char *path)
+{
+    FILE *f = fopen(path, "rb");
+    unsigned char x, y, i;
+    int bits;
+    long diff = 0;
+
+    if (!f)
+        return -1;
+    if ((fgetc(f) != 'P') || (fgetc(f) != '4') || (glcd_host_pbm_number(f) != GLCD_HOST_WIDTH) ||
+        (glcd_host_pbm_number(f) != GLCD_HOST_HEIGHT))
+    {
+        fclose(f);
+        return -1;
+    }
+    for (y = 0; y < GLCD_HOST_HEIGHT; y++)
+    {
+        for (x = 0; x < GLCD_HOST_WIDTH; x += 8)
+        {
+            if ((bits = fgetc(f)) == EOF)
+            {
+                fclose(f);
+                return -1;
+            }
+            for (i = 0; i < 8; i++)
+            {
+                if (((bits >> (7 - i)) & 1) != GLCD_Host_pixel(x + i, y))
+                    diff++;
+            }
+        }
+    }
+    fclose(f);
+    return diff;
+}
+
+#endif // _GLCD_HOST_H_
@@ -0,0 +1,273 @@
+/*
+ * _glcd_parallel.h - KS0108 Parallel Bus Backend (any pins)
+ * Educational Version for Assembly→C→Python Learning Progression
+ *
+ * Included by _glcd.c through _glcd_backend.h - do not include elsewhere.
+ *
+ * PIN MAP:
+ * Every signal is "port letter, bit", e.g. -DGLCD_PIN_E=B,2, the same
+ * format as _lcd_parallel.h. Define all required pins or none.
+ *
+ *   signal   board default   AVR-KS0108 (-DGLCD_PINS_AVR_KS0108)
+ *   D0..D7   A, 0..A, 7      A, 0..A, 7
+ *   RS (DI)  E, 4            B, 0
+ *   E (EN)   E, 5            B, 2
+ *   CS1      E, 7            B, 3        left controller, columns 0..63
+ *   CS2      E, 6            B, 4        right controller, columns 64..127
+ *   RW       G, 1 (held low) B, 1        optional: leave undefined if R/W is tied to GND
+ *   RST      -               B, 5        optional: pulsed low by glcd_backend_init()
+ *
+ * GLCD_CS_ACTIVE_LOW 1 for panels whose CS1/CS2 inputs are active low.
+ * With -DGLCD_PINS_AVR_KS0108 the map, polarity and timing come from
+ * AVR-KS0108/KS0108_Settings.h.
+ *
+ * FAST PATH:
+ * When D0..D7 are bits 0..7 of one port, a data write is one port write
+ * and the busy flag is read from the whole port. When RS, CS1 and CS2
+ * share a port, they change together in one read-modify-write. Both tests
+ * are constant expressions, so only one path is compiled in.
+ *
+ * BUS TIMING:
+ * Default: fixed padding per byte, SimulIDE 0.4.15 original timing
+ * SIMULIDE_NEW_VERSION: fixed padding for SimulIDE 1.1.0+ (longer)
+ * GLCD_EXEC_US: datasheet E timing, then GLCD_EXEC_US per byte (real panel,
+ *               R/W tied to GND; 3 is enough for a KS0108)
+ * GLCD_BUSY_POLL: datasheet E timing, then the busy flag of every selected
+ *                 controller is polled. Opt-in, and only with GLCD_PIN_RW:
+ *                 with R/W tied to GND every status read would be an
+ *                 instruction write of whatever floats on the bus.
+ */
+
+#ifndef _GLCD_PARALLEL_H_
+#define _GLCD_PARALLEL_H_
+
+#include <avr/io.h>
+#include <util/delay.h>
+
+#ifdef GLCD_PINS_AVR_KS0108
+#include "AVR-KS0108/KS0108_Settings.h"
+#endif
+
+#ifndef GLCD_PIN_RS
+#define GLCD_PIN_D0 A, 0
+#define GLCD_PIN_D1 A, 1
+#define GLCD_PIN_D2 A, 2
+#define GLCD_PIN_D3 A, 3
+#define GLCD_PIN_D4 A, 4
+#define GLCD_PIN_D5 A, 5
+#define GLCD_PIN_D6 A, 6
+#define GLCD_PIN_D7 A, 7
+#define GLCD_PIN_RS E, 4  // Register Select (0=Command, 1=Data)
+#define GLCD_PIN_E E, 5   // Enable
+#define GLCD_PIN_CS1 E, 7 // Chip Select 1, left pannel
+#define GLCD_PIN_CS2 E, 6 // Chip Select 2, right pannel
+#define GLCD_PIN_RW G, 1  // Read/Write, held low unless GLCD_BUSY_POLL
+#endif
+
+#ifndef GLCD_CS_ACTIVE_LOW
+#define GLCD_CS_ACTIVE_LOW 0
+#endif
+
+#if defined(GLCD_BUSY_POLL) && !defined(GLCD_PIN_RW)
+#error "_glcd_parallel.h: GLCD_BUSY_POLL reads the status register and needs R/W on a pin (GLCD_PIN_RW)"
+#endif
+
+#if defined(GLCD_BUSY_POLL) || defined(GLCD_EXEC_US)
+#define D_BEFORE 0.45 // E high pulse width >= 450ns
+#define D_AFTER 0.45  // E low pulse width >= 450ns (E cycle >= 1000ns)
+#define D_MIDDLE 0.14 // RS/CS address setup before E >= 140ns
+#ifndef GLCD_BUSY_TIMEOUT
+#define GLCD_BUSY_TIMEOUT 100 // Status reads before giving up (no panel / simulator)
+#endif
+#elif defined(SIMULIDE_NEW_VERSION)
+#ifndef GLCD_FIXED_DELAYS
+#define GLCD_FIXED_DELAYS
+#endif
+#define D_BEFORE 10 // SimulIDE 1.1.0+ needs longer setup time
+#define D_AFTER 100 // SimulIDE 1.1.0+ needs much longer hold time
+#define D_MIDDLE 5  // SimulIDE 1.1.0+ needs longer middle delay
+#else
+#ifndef GLCD_FIXED_DELAYS
+#define GLCD_FIXED_DELAYS
+#endif
+#define D_BEFORE 2 // SimulIDE 0.4.15 original timing
+#define D_AFTER 50 // SimulIDE 0.4.15 original timing
+#define D_MIDDLE 1 // SimulIDE 0.4.15 original timing
+#endif
+
+// Estimated bus time of one write
+#ifdef GLCD_FIXED_DELAYS
+#define GLCD_BUS_TRANSACTION_US (D_MIDDLE + D_BEFORE + D_AFTER) // fixed delays dominate
+#elif defined(GLCD_EXEC_US)
+#define GLCD_BUS_TRANSACTION_US (1 + GLCD_EXEC_US) // E cycle and execution time
+#else
+#define GLCD_BUS_TRANSACTION_US 1 // E cycle; busy polls add to the real time
+#endif
+
+// Bit values of the rs and cs arguments; mapped onto the pins below
+#define GLCD_RS_DATA 0x01
+#define GLCD_CS_LEFT 0x01  // CS1, left pannel
+#define GLCD_CS_RIGHT 0x02 // CS2, right pannel
+
+// "port, bit" -> register or bit number; variadic, because a pin macro
+// passed through another macro arrives already split into two arguments
+#define GLCD_OUT(...) GLCD_OUT_(__VA_ARGS__)
+#define GLCD_OUT_(port, bit) PORT##port
+#define GLCD_DDR(...) GLCD_DDR_(__VA_ARGS__)
+#define GLCD_DDR_(port, bit) DDR##port
+#define GLCD_IN(...) GLCD_IN_(__VA_ARGS__)
+#define GLCD_IN_(port, bit) PIN##port
+#define GLCD_BIT(...) GLCD_BIT_(__VA_ARGS__)
+#define GLCD_BIT_(port, bit) (bit)
+#define GLCD_MASK(...) (1 << GLCD_BIT(__VA_ARGS__))
+
+#define GLCD_SET(...) (GLCD_OUT(__VA_ARGS__) |= (1 << GLCD_BIT(__VA_ARGS__)))
+#define GLCD_CLR(...) (GLCD_OUT(__VA_ARGS__) &= ~(1 << GLCD_BIT(__VA_ARGS__)))
+#define GLCD_PUT(pin, on) ((on) ? GLCD_SET(pin) : GLCD_CLR(pin))
+#define GLCD_DIR(pin, out) ((out) ? (GLCD_DDR(pin) |= GLCD_MASK(pin)) : (GLCD_DDR(pin) &= ~GLCD_MASK(pin)))
+
+// pin sits on bit n of the port of D0
+#define GLCD_DATA_BIT(pin, n) ((&GLCD_OUT(pin) == &GLCD_OUT(GLCD_PIN_D0)) && (GLCD_BIT(pin) == (n)))
+#define GLCD_DATA_ONE_PORT                                                                               \
+    (GLCD_DATA_BIT(GLCD_PIN_D0, 0) && GLCD_DATA_BIT(GLCD_PIN_D1, 1) && GLCD_DATA_BIT(GLCD_PIN_D2, 2) && \
+     GLCD_DATA_BIT(GLCD_PIN_D3, 3) && GLCD_DATA_BIT(GLCD_PIN_D4, 4) && GLCD_DATA_BIT(GLCD_PIN_D5, 5) && \
+     GLCD_DATA_BIT(GLCD_PIN_D6, 6) && GLCD_DATA_BIT(GLCD_PIN_D7, 7))
+
+// RS, CS1 and CS2 change together in one port write
+#define GLCD_CTRL_ONE_PORT \
+    ((&GLCD_OUT(GLCD_PIN_CS1) == &GLCD_OUT(GLCD_PIN_RS)) && (&GLCD_OUT(GLCD_PIN_CS2) == &GLCD_OUT(GLCD_PIN_RS)))
+
+// data lines <- value
+static inline void glcd_backend_data(unsigned char value)
+{
+    if (GLCD_DATA_ONE_PORT)
+    {
+        GLCD_OUT(GLCD_PIN_D0) = value; // whole byte in one port write
+        return;
+    }
+    GLCD_PUT(GLCD_PIN_D0, value & 0x01);
+    GLCD_PUT(GLCD_PIN_D1, value & 0x02);
+    GLCD_PUT(GLCD_PIN_D2, value & 0x04);
+    GLCD_PUT(GLCD_PIN_D3, value & 0x08);
+    GLCD_PUT(GLCD_PIN_D4, value & 0x10);
+    GLCD_PUT(GLCD_PIN_D5, value & 0x20);
+    GLCD_PUT(GLCD_PIN_D6, value & 0x40);
+    GLCD_PUT(GLCD_PIN_D7, value & 0x80);
+}
+
+// data lines as outputs (1) or inputs without pull-ups (0)
+static inline void glcd_backend_data_dir(unsigned char output)
+{
+    if (GLCD_DATA_ONE_PORT)
+    {
+        GLCD_DDR(GLCD_PIN_D0) = output ? 0xFF : 0x00;
+        return;
+    }
+    GLCD_DIR(GLCD_PIN_D0, output);
+    GLCD_DIR(GLCD_PIN_D1, output);
+    GLCD_DIR(GLCD_PIN_D2, output);
+    GLCD_DIR(GLCD_PIN_D3, output);
+    GLCD_DIR(GLCD_PIN_D4, output);
+    GLCD_DIR(GLCD_PIN_D5, output);
+    GLCD_DIR(GLCD_PIN_D6, output);
+    GLCD_DIR(GLCD_PIN_D7, output);
+}
+
+// RS and chip selects for the next E pulse (cs = 0: no controller)
+static inline void glcd_backend_select(unsigned char rs, unsigned char cs)
+{
+    if (GLCD_CS_ACTIVE_LOW)
+        cs ^= GLCD_CS_LEFT | GLCD_CS_RIGHT;
+
+    if (GLCD_CTRL_ONE_PORT)
+    {
+        GLCD_OUT(GLCD_PIN_RS) =
+            (GLCD_OUT(GLCD_PIN_RS) & ~(GLCD_MASK(GLCD_PIN_RS) | GLCD_MASK(GLCD_PIN_CS1) | GLCD_MASK(GLCD_PIN_CS2))) |
+            (rs ? GLCD_MASK(GLCD_PIN_RS) : 0) | ((cs & GLCD_CS_LEFT) ? GLCD_MASK(GLCD_PIN_CS1) : 0) |
+            ((cs & GLCD_CS_RIGHT) ? GLCD_MASK(GLCD_PIN_CS2) : 0);
+        return;
+    }
+    GLCD_PUT(GLCD_PIN_RS, rs);
+    GLCD_PUT(GLCD_PIN_CS1, cs & GLCD_CS_LEFT);
+    GLCD_PUT(GLCD_PIN_CS2, cs & GLCD_CS_RIGHT);
+}
+
+static void glcd_backend_init(void)
+{
+    glcd_backend_data_dir(1);
+    glcd_backend_data(0x00); // Clear data bus
+    GLCD_DIR(GLCD_PIN_RS, 1);
+    GLCD_DIR(GLCD_PIN_E, 1);
+    GLCD_DIR(GLCD_PIN_CS1, 1);
+    GLCD_DIR(GLCD_PIN_CS2, 1);
+
+    // Control signals to safe state: RS = 0, E = 0, no controller selected, RW = 0
+    GLCD_CLR(GLCD_PIN_E);
+    glcd_backend_select(0, 0);
+#ifdef GLCD_PIN_RW
+    GLCD_DIR(GLCD_PIN_RW, 1);
+    GLCD_CLR(GLCD_PIN_RW);
+#endif
+#ifdef GLCD_PIN_RST
+    GLCD_DIR(GLCD_PIN_RST, 1);
+    GLCD_CLR(GLCD_PIN_RST); // !RST
+    _delay_ms(5);
+    GLCD_SET(GLCD_PIN_RST);
+    _delay_ms(50);
+#endif
+}
+
+#ifdef GLCD_BUSY_POLL
+// wait until every selected controller clears its busy flag (status bit 7)
+static void glcd_wait_ready(unsigned char cs)
+{
+    unsigned char chip, status, polls;
+
+    glcd_backend_data_dir(0); // data lines as inputs
+    glcd_backend_data(0x00);  // no pull-ups
+    GLCD_SET(GLCD_PIN_RW);    // RW = 1 (read)
+
+    for (chip = GLCD_CS_LEFT; chip <= GLCD_CS_RIGHT; chip <<= 1)
+    {
+        if (!(cs & chip))
+            continue;
+
+        glcd_backend_select(0, chip); // RS = 0 (status), one controller at a time
+        polls = GLCD_BUSY_TIMEOUT;
+        do
+        {
+            GLCD_SET(GLCD_PIN_E); // E = 1
+            _delay_us(D_BEFORE);  // covers data delay time (320ns)
+            if (GLCD_DATA_ONE_PORT)
+                status = GLCD_IN(GLCD_PIN_D0);
+            else
+                status = (GLCD_IN(GLCD_PIN_D7) & GLCD_MASK(GLCD_PIN_D7)) ? 0x80 : 0x00;
+            GLCD_CLR(GLCD_PIN_E); // E = 0
+            _delay_us(D_AFTER);
+        } while ((status & 0x80) && --polls);
+    }
+
+    GLCD_CLR(GLCD_PIN_RW); // RW = 0 (write mode)
+    glcd_backend_data_dir(1);
+}
+#endif
+
+// one bus write: RS and both CS lines together, then one E pulse
+static void glcd_backend_write(unsigned char value, unsigned char rs, unsigned char cs)
+{
+#ifdef GLCD_BUSY_POLL
+    glcd_wait_ready(cs);
+#endif
+    glcd_backend_data(value);
+    glcd_backend_select(rs, cs);
+    _delay_us(D_MIDDLE);
+    GLCD_SET(GLCD_PIN_E); // E = 1
+    _delay_us(D_BEFORE);
+    GLCD_CLR(GLCD_PIN_E); // E = 0, falling edge latches the byte
+    _delay_us(D_AFTER);
+#ifdef GLCD_EXEC_US
+    _delay_us(GLCD_EXEC_US); // no busy flag: worst-case execution time
+#endif
+}
+
+#endif // _GLCD_PARALLEL_H_
@@ -48,6 +48,10 @@
 #include "_main.h"
 #include "_interrupt.h"
 #include "_uart.h"
+#include "_atomic.h"
+#ifdef EVENT_BUS_ENABLED
+#include "_event.h"
+#endif
 
 /*
  * =============================================================================
@@ -72,8 +76,7 @@
 #define INT_TRIGGER_RISING_EDGE 3  // Rising edge generates interrupt
 
 /* Educational interrupt statistics */
-static volatile unsigned int int0_count = 0;	   // INT0 trigger count
-static volatile unsigned int int1_count = 0;	   // INT1 trigger count
+static volatile unsigned int int_count[8];		   // INT0..INT7 trigger counts
 static volatile unsigned int total_interrupts = 0; // Total interrupt count
 static volatile unsigned char last_interrupt = 0;  // Last triggered interrupt
 
@@ -119,8 +122,7 @@ static volatile unsigned char last_interrupt = 0;  // Last triggered interrupt
 void Interrupt_init(void)
 {
 	/* Clear interrupt statistics */
-	int0_count = 0;
-	int1_count = 0;
+	memset((void *)int_count, 0, sizeof(int_count));
 	total_interrupts = 0;
 	last_interrupt = 0;
 
@@ -221,17 +223,14 @@ void Interrupt_get_statistics(unsigned int *int0_triggers,
 							  unsigned int *total_triggers,
 							  unsigned char *last_triggered)
 {
-	/* Temporarily disable interrupts to ensure atomic read */
-	unsigned char sreg_backup = SREG;
-	cli();
-
-	*int0_triggers = int0_count;
-	*int1_triggers = int1_count;
-	*total_triggers = total_interrupts;
-	*last_triggered = last_interrupt;
-
-	/* Restore interrupt state */
-	SREG = sreg_backup;
+	/* Block interrupts so all counters belong to the same moment */
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		*int0_triggers = int_count[0];
+		*int1_triggers = int_count[1];
+		*total_triggers = total_interrupts;
+		*last_triggered = last_interrupt;
+	}
 }
 
 /*
@@ -241,15 +240,38 @@ void Interrupt_get_statistics(unsigned int *int0_triggers,
  */
 void Interrupt_reset_statistics(void)
 {
-	unsigned char sreg_backup = SREG;
-	cli();
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		memset((void *)int_count, 0, sizeof(int_count));
+		total_interrupts = 0;
+		last_interrupt = 0;
+	}
+}
 
-	int0_count = 0;
-	int1_count = 0;
-	total_interrupts = 0;
-	last_interrupt = 0;
+/*
+ * EDUCATIONAL FUNCTION: Record External Interrupt
+ *
+ * PURPOSE: Called from an application ISR(INTn_vect) to update statistics
+ *          and, with EVENT_BUS_ENABLED, post EVENT_INT0 + n to the event bus
+ *          (data = trigger count of that line)
+ *
+ * EXAMPLE:
+ *   ISR(INT0_vect) { Interrupt_notify(0); }
+ */
+void Interrupt_notify(unsigned char int_number)
+{
+	if (int_number > 7)
+	{
+		return;
+	}
+
+	int_count[int_number]++;
+	total_interrupts++;
+	last_interrupt = int_number;
 
-	SREG = sreg_backup;
+#ifdef EVENT_BUS_ENABLED
+	Event_post(EVENT_INT0 + int_number, EVENT_PRIORITY_NORMAL, int_count[int_number]);
+#endif
 }
 
 /*
@@ -156,6 +156,17 @@ void Interrupt_get_statistics(unsigned int *int0_triggers,
  */
 void Interrupt_reset_statistics(void);
 
+/*
+ * ISR HELPER FUNCTION: Record External Interrupt
+ *
+ * PURPOSE: Update statistics from an application ISR and, when built with
+ *          EVENT_BUS_ENABLED, post EVENT_INT0 + int_number to the event bus
+ *
+ * PARAMETERS:
+ *   int_number - External interrupt line (0-7)
+ */
+void Interrupt_notify(unsigned char int_number);
+
 /*
  * =============================================================================
  * INTERRUPT SERVICE ROUTINE DECLARATIONS
@@ -0,0 +1,221 @@
+/*
+ * _isr_priority.c - ATmega128 Interrupt Priority Class Measurement
+ * Part of Assembly → C → Python Learning Progression
+ *
+ * EDUCATIONAL OBJECTIVES:
+ * 1. Understand why interrupt latency depends on the longest time the
+ *    I-bit is cleared, not on the vector table order
+ * 2. Measure worst-case blocking and completion time per priority class
+ * 3. Measure real entry latency with a reference interrupt (Timer0 probe)
+ *
+ * LATENCY MODEL:
+ * Worst entry latency of ANY interrupt =
+ *   max(HIGH handler duration, LOW prologue/epilogue, main program cli)
+ * LOW handlers only add to the completion time of other LOW handlers.
+ */
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include "_main.h"
+#include "_isr_priority.h"
+#ifdef ISR_PRIORITY_MEASURE
+#include "_timer2.h"
+#endif
+
+#ifdef ISR_PRIORITY_MEASURE
+
+static volatile Isr_class_stats_t class_stats[ISR_CLASS_COUNT];
+static volatile unsigned char nesting_depth = 0;
+
+/*
+ * EDUCATIONAL FUNCTION: Record ISR Entry
+ *
+ * PURPOSE: Timestamp the start of a handler and track nesting depth
+ * NOTE: Runs with interrupts disabled (called before sei)
+ */
+unsigned long Isr_priority_enter(void)
+{
+	nesting_depth++;
+	return Timer2_get_ticks();
+}
+
+unsigned long Isr_priority_now(void)
+{
+	return Timer2_get_ticks();
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Record ISR Exit
+ *
+ * PURPOSE: Update worst-case values of the handler's class
+ * PARAMETERS:
+ *   entry_ticks - Timestamp from Isr_priority_enter()
+ *   sei_ticks   - Timestamp just before sei() (LOW class only)
+ */
+void Isr_priority_exit(unsigned char isr_class, unsigned long entry_ticks, unsigned long sei_ticks)
+{
+	unsigned long now = Timer2_get_ticks();
+	unsigned int complete = (unsigned int)(now - entry_ticks);
+	unsigned int blocking;
+
+	if (isr_class == ISR_CLASS_HIGH)
+	{
+		blocking = complete; // I-bit clear for the whole handler
+	}
+	else
+	{
+		blocking = (unsigned int)(sei_ticks - entry_ticks); // Prologue only
+	}
+
+	volatile Isr_class_stats_t *stats = &class_stats[isr_class];
+	stats->calls++;
+	if (blocking > stats->max_blocking_ticks)
+	{
+		stats->max_blocking_ticks = blocking;
+	}
+	if (complete > stats->max_complete_ticks)
+	{
+		stats->max_complete_ticks = complete;
+	}
+	if (nesting_depth > stats->max_nesting)
+	{
+		stats->max_nesting = nesting_depth;
+	}
+
+	nesting_depth--;
+}
+
+#endif // ISR_PRIORITY_MEASURE
+
+/*
+ * EDUCATIONAL FUNCTION: Get Class Statistics
+ *
+ * PURPOSE: Copy worst-case values of one class (all zero without
+ *          ISR_PRIORITY_MEASURE)
+ */
+void Isr_priority_get_statistics(unsigned char isr_class, Isr_class_stats_t *stats)
+{
+	stats->calls = 0;
+	stats->max_blocking_ticks = 0;
+	stats->max_complete_ticks = 0;
+	stats->max_nesting = 0;
+
+#ifdef ISR_PRIORITY_MEASURE
+	if (isr_class >= ISR_CLASS_COUNT)
+	{
+		return;
+	}
+
+	unsigned char sreg_backup = SREG;
+	cli();
+	stats->calls = class_stats[isr_class].calls;
+	stats->max_blocking_ticks = class_stats[isr_class].max_blocking_ticks;
+	stats->max_complete_ticks = class_stats[isr_class].max_complete_ticks;
+	stats->max_nesting = class_stats[isr_class].max_nesting;
+	SREG = sreg_backup;
+#else
+	(void)isr_class;
+#endif
+}
+
+void Isr_priority_reset_statistics(void)
+{
+#ifdef ISR_PRIORITY_MEASURE
+	unsigned char i;
+	unsigned char sreg_backup = SREG;
+	cli();
+	for (i = 0; i < ISR_CLASS_COUNT; i++)
+	{
+		class_stats[i].calls = 0;
+		class_stats[i].max_blocking_ticks = 0;
+		class_stats[i].max_complete_ticks = 0;
+		class_stats[i].max_nesting = 0;
+	}
+	SREG = sreg_backup;
+#endif
+}
+
+#ifdef ISR_PRIORITY_PROBE
+
+#if defined(LCD_ASYNC) && LCD_ASYNC
+#error "ISR_PRIORITY_PROBE and LCD_ASYNC both need TIMER0_COMP_vect - enable only one"
+#endif
+
+/*
+ * =============================================================================
+ * LATENCY PROBE - Timer0 compare match as a reference interrupt
+ * =============================================================================
+ *
+ * Timer0 runs in CTC mode at F_CPU/8 (about 1.1us per count at 7.3728MHz) and clears
+ * TCNT0 at the moment it requests the interrupt. The value of TCNT0 on ISR
+ * entry is therefore the entry latency (plus the fixed vector/prologue
+ * time of about 2-3 counts).
+ */
+#define PROBE_PERIOD_COUNTS (F_CPU / 8UL / 10000UL - 1) // About 100us
+
+typedef char probe_period_must_fit_timer0[(PROBE_PERIOD_COUNTS >= 1 && PROBE_PERIOD_COUNTS <= 255) ? 1 : -1];
+
+static volatile unsigned char probe_max = 0;
+static volatile unsigned long probe_sum = 0;
+static volatile unsigned int probe_samples = 0;
+
+ISR(TIMER0_COMP_vect)
+{
+	unsigned char latency = TCNT0;
+
+	if (latency > probe_max)
+	{
+		probe_max = latency;
+	}
+	if (probe_samples < 0xFFFF)
+	{
+		probe_sum += latency;
+		probe_samples++;
+	}
+}
+
+void Isr_priority_probe_start(void)
+{
+	unsigned char sreg_backup = SREG;
+	cli();
+
+	probe_max = 0;
+	probe_sum = 0;
+	probe_samples = 0;
+
+	TCCR0 = 0;
+	TCNT0 = 0;
+	OCR0 = PROBE_PERIOD_COUNTS;
+	TIFR = (1 << OCF0);					// Clear stale flag (write one)
+	TCCR0 = (1 << WGM01) | (1 << CS01); // CTC mode, prescaler 8
+	TIMSK |= (1 << OCIE0);
+
+	SREG = sreg_backup;
+}
+
+void Isr_priority_probe_stop(void)
+{
+	unsigned char sreg_backup = SREG;
+	cli();
+	TIMSK &= ~(1 << OCIE0);
+	TCCR0 = 0;
+	SREG = sreg_backup;
+}
+
+unsigned char Isr_priority_probe_max_latency(void)
+{
+	return probe_max;
+}
+
+unsigned char Isr_priority_probe_avg_latency(void)
+{
+	unsigned char sreg_backup = SREG;
+	cli();
+	unsigned long sum = probe_sum;
+	unsigned int samples = probe_samples;
+	SREG = sreg_backup;
+
+	return samples ? (unsigned char)(sum / samples) : 0;
+}
+
+#endif // ISR_PRIORITY_PROBE
@@ -0,0 +1,159 @@
+/*
+ * _isr_priority.h - ATmega128 Nested Interrupt Priority Classes
+ * Educational Version for Assembly→C→Python Learning Progression
+ *
+ * PURPOSE:
+ * The AVR core clears the I-bit when it enters an ISR, so a long handler
+ * delays every other interrupt. This header lets each ISR declare a class:
+ *
+ *   HIGH: classic ISR - runs to completion with interrupts disabled.
+ *         Use for short, time-critical edges (stepper pulses, INT0 capture).
+ *   LOW:  masks its own source (so it cannot re-enter itself), sets the
+ *         I-bit again and runs its body interruptibly. Any HIGH (and other
+ *         LOW) interrupt can preempt it. The source is unmasked on exit.
+ *
+ * USAGE:
+ *   ISR_PRIORITY_HIGH(INT0_vect)
+ *   {
+ *       PORTB ^= 0x01;
+ *   }
+ *
+ *   ISR_PRIORITY_LOW(TIMER2_OVF_vect, TIMSK, TOIE2)
+ *   {
+ *       Timer2_ovf_handler();
+ *   }
+ *
+ *   ISR_PRIORITY_LOW(USART1_UDRE_vect, UCSR1B, UDRIE1)
+ *   {
+ *       if (buffer_empty)
+ *           ISR_PRIORITY_KEEP_DISABLED(USART1_UDRE_vect); // Stay masked
+ *       else
+ *           UDR1 = next_byte;
+ *   }
+ *
+ * RULES FOR LOW PRIORITY HANDLERS:
+ * - Level-type sources must be masked (they are) or acknowledged before
+ *   the I-bit is set, otherwise the ISR would re-enter immediately
+ * - Registers that contain write-one-to-clear flags next to the enable
+ *   bit (ADCSRA/ADIF, EECR, SPMCSR) need ISR_PRIORITY_LOW_W1C so the
+ *   read-modify-write does not clear a pending flag
+ * - Every nesting level costs stack (about 20-35 bytes per ISR frame)
+ *
+ * MEASUREMENT (build with -DISR_PRIORITY_MEASURE, link _isr_priority.c
+ * and _timer2.c): each class records its worst-case interrupt-disabled
+ * time and worst-case completion time. Build additionally with
+ * -DISR_PRIORITY_PROBE to get a Timer0 latency probe that measures the
+ * real worst-case entry latency under load. The probe owns
+ * TIMER0_COMP_vect, so it cannot be combined with LCD_ASYNC.
+ */
+
+#ifndef _ISR_PRIORITY_H_
+#define _ISR_PRIORITY_H_
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+
+/*
+ * Priority Classes
+ */
+#define ISR_CLASS_HIGH 0
+#define ISR_CLASS_LOW 1
+#define ISR_CLASS_COUNT 2
+
+/*
+ * Latency Statistics per Class (Timer2_get_ticks units, convert with
+ * TIMER2_TICKS_TO_US from _timer2.h)
+ */
+typedef struct
+{
+	unsigned int calls;              // Handler executions
+	unsigned int max_blocking_ticks; // Longest time with I-bit cleared
+	unsigned int max_complete_ticks; // Longest entry-to-exit time incl. preemption
+	unsigned char max_nesting;       // Deepest LOW nesting observed
+} Isr_class_stats_t;
+
+#ifdef ISR_PRIORITY_MEASURE
+unsigned long Isr_priority_enter(void);
+void Isr_priority_exit(unsigned char isr_class, unsigned long entry_ticks, unsigned long sei_ticks);
+unsigned long Isr_priority_now(void);
+#define ISR_PRIORITY_ENTER() unsigned long isr_entry_ticks = Isr_priority_enter()
+#define ISR_PRIORITY_MARK_SEI() unsigned long isr_sei_ticks = Isr_priority_now()
+#define ISR_PRIORITY_EXIT(cls, sei_ticks) Isr_priority_exit((cls), isr_entry_ticks, (sei_ticks))
+#else
+#define ISR_PRIORITY_ENTER() do { } while (0)
+#define ISR_PRIORITY_MARK_SEI() do { } while (0)
+#define ISR_PRIORITY_EXIT(cls, sei_ticks) do { } while (0)
+#endif
+
+/*
+ * HIGH class: plain non-interruptible ISR
+ */
+#define ISR_PRIORITY_HIGH(vector) ISR_PRIORITY_HIGH_IMPL(vector)
+#define ISR_PRIORITY_HIGH_IMPL(vector)                    \
+	static void vector##_high_priority_body(void);        \
+	ISR(vector)                                           \
+	{                                                     \
+		ISR_PRIORITY_ENTER();                             \
+		vector##_high_priority_body();                    \
+		ISR_PRIORITY_EXIT(ISR_CLASS_HIGH, 0);             \
+	}                                                     \
+	static void vector##_high_priority_body(void)
+
+/*
+ * LOW class: mask own source, re-enable interrupts, run body, unmask.
+ * flag_mask lists write-one-to-clear bits of enable_reg that must be
+ * written as 0 by the read-modify-write (0 for ordinary mask registers).
+ */
+#define ISR_PRIORITY_LOW_W1C(vector, enable_reg, enable_bit, flag_mask) \
+	ISR_PRIORITY_LOW_IMPL(vector, enable_reg, enable_bit, flag_mask)
+#define ISR_PRIORITY_LOW_IMPL(vector, enable_reg, enable_bit, flag_mask)                   \
+	static void vector##_low_priority_body(void);                                          \
+	static volatile unsigned char vector##_reenable;                                       \
+	ISR(vector)                                                                            \
+	{                                                                                      \
+		ISR_PRIORITY_ENTER();                                                              \
+		enable_reg = (enable_reg & ~(flag_mask)) & (unsigned char)~(1 << (enable_bit));    \
+		vector##_reenable = 1;                                                             \
+		ISR_PRIORITY_MARK_SEI();                                                           \
+		sei();                                                                             \
+		vector##_low_priority_body();                                                      \
+		cli();                                                                             \
+		if (vector##_reenable)                                                             \
+		{                                                                                  \
+			enable_reg = (enable_reg & ~(flag_mask)) | (1 << (enable_bit));                \
+		}                                                                                  \
+		ISR_PRIORITY_EXIT(ISR_CLASS_LOW, isr_sei_ticks);                                   \
+	}                                                                                      \
+	static void vector##_low_priority_body(void)
+
+#define ISR_PRIORITY_LOW(vector, enable_reg, enable_bit) \
+	ISR_PRIORITY_LOW_W1C(vector, enable_reg, enable_bit, 0)
+
+/* Call inside a LOW body to leave the source masked after the handler */
+#define ISR_PRIORITY_KEEP_DISABLED(vector) ISR_PRIORITY_KEEP_DISABLED_IMPL(vector)
+#define ISR_PRIORITY_KEEP_DISABLED_IMPL(vector) (vector##_reenable = 0)
+
+/*
+ * The *_IMPL indirection expands vector names such as USART1_UDRE_vect to
+ * their _VECTOR(n) form first, so every macro pastes the same identifier.
+ */
+
+/*
+ * Statistics API (available with ISR_PRIORITY_MEASURE)
+ */
+void Isr_priority_get_statistics(unsigned char isr_class, Isr_class_stats_t *stats);
+void Isr_priority_reset_statistics(void);
+
+/*
+ * Latency Probe API (available with ISR_PRIORITY_PROBE)
+ * Timer0 compare match about every 100us; worst/average entry latency in
+ * Timer0 counts of 8 CPU clocks (about 1.1us at 7.3728MHz)
+ */
+#define ISR_PRIORITY_PROBE_COUNTS_TO_US(counts) ((unsigned int)((counts) * 8000000UL / F_CPU))
+
+void Isr_priority_probe_start(void);
+void Isr_priority_probe_stop(void);
+unsigned char Isr_priority_probe_max_latency(void);
+unsigned char Isr_priority_probe_avg_latency(void);
+
+#endif // _ISR_PRIORITY_H_
@@ -0,0 +1,406 @@
+/*
+ * _joystick.c - Analog Joystick Pipeline (Calibration, Deadzone, Curves)
+ * Part of Assembly → C → Python Learning Progression
+ *
+ * EDUCATIONAL OBJECTIVES:
+ * 1. Process sensor data where it arrives (in the ADC ISR), read it for free
+ * 2. Fixed-point scaling: precomputed Q8 gains instead of divisions
+ * 3. Radial deadzone with an integer square root
+ * 4. Response curves from a PROGMEM lookup table
+ * 5. Persist calibration in EEPROM with a magic byte and checksum
+ *
+ * COST:
+ * Each ADC sample adds to a sum (a few cycles). Every JOYSTICK_OVERSAMPLE
+ * X/Y pairs one output sample is computed: 2 multiplies for the gains,
+ * an 8-step square root, one table read and one 16-bit division, well
+ * under 1000 cycles. At the default 8x oversampling that is about 275
+ * output samples per second at 7.3728MHz.
+ */
+
+#include <avr/io.h>
+#include <avr/pgmspace.h>
+#include <util/atomic.h>
+#include "_joystick.h"
+#include "_adc.h"
+#include "_eeprom.h"
+
+#define JOYSTICK_ADC_MAX 1023
+#define JOYSTICK_MAGIC 0x4A // 'J'
+#define JOYSTICK_RECORD_SIZE (1 + sizeof(Joystick_calibration_t) + 1) // magic, data, checksum
+#define JOYSTICK_SPAN_FLOOR 16 // smallest center-to-end distance used for the gains
+
+typedef char joystick_oversample_must_be_power_of_two
+	[(JOYSTICK_OVERSAMPLE >= 2 && JOYSTICK_OVERSAMPLE <= 64 && !(JOYSTICK_OVERSAMPLE & (JOYSTICK_OVERSAMPLE - 1)))
+		 ? 1
+		 : -1];
+
+/*
+ * Cubic response t^3 / 127^2 for t = 0..127, rounded
+ */
+static const uint8_t joystick_cube[JOYSTICK_OUTPUT_MAX + 1] PROGMEM = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2,
+	2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 5, 5, 5, 6, 6, 6,
+	7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 13, 13, 14, 15, 16,
+	16, 17, 18, 19, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 31,
+	32, 33, 34, 35, 37, 38, 39, 41, 42, 44, 45, 47, 48, 50, 51, 53,
+	55, 57, 58, 60, 62, 64, 66, 68, 70, 72, 74, 76, 78, 80, 83, 85,
+	87, 89, 92, 94, 97, 99, 102, 104, 107, 110, 113, 115, 118, 121, 124, 127};
+
+/*
+ * ISR-Owned State (main program changes it inside ATOMIC_BLOCK)
+ */
+static uint16_t joystick_sum[2];
+static uint8_t joystick_count[2];
+static volatile uint16_t joystick_raw[2];
+static Joystick_calibration_t joystick_cal;
+static uint16_t joystick_gain_neg[2]; // Q8: counts below center -> output
+static uint16_t joystick_gain_pos[2]; // Q8: counts above center -> output
+static uint8_t joystick_need_center;
+static uint8_t joystick_track_count;
+static uint8_t joystick_deadzone;
+static uint16_t joystick_dz_gain; // Q8: stretches deadzone..127 to 0..127
+static uint16_t joystick_expo;
+static volatile Joystick_state_t joystick_state;
+
+/*
+ * EDUCATIONAL FUNCTION: Precompute Axis Gains
+ *
+ * PURPOSE: One division per calibration change instead of one per
+ *          sample: gain = 127 * 256 / span, so n = d * gain >> 8.
+ */
+static uint16_t joystick_gain(uint16_t span)
+{
+	if (span < JOYSTICK_SPAN_FLOOR)
+		span = JOYSTICK_SPAN_FLOOR;
+	return (uint16_t)(((uint32_t)JOYSTICK_OUTPUT_MAX * 256UL + span / 2) / span);
+}
+
+static void joystick_update_gains(uint8_t axis)
+{
+	joystick_gain_neg[axis] = joystick_gain(joystick_cal.center[axis] - joystick_cal.min[axis]);
+	joystick_gain_pos[axis] = joystick_gain(joystick_cal.max[axis] - joystick_cal.center[axis]);
+}
+
+// raw becomes the center; min/max widen to at least JOYSTICK_MIN_SPAN
+static void joystick_learn_center(uint8_t axis, uint16_t raw)
+{
+	joystick_cal.center[axis] = raw;
+	if (joystick_cal.min[axis] + JOYSTICK_MIN_SPAN > raw)
+		joystick_cal.min[axis] = (raw > JOYSTICK_MIN_SPAN) ? raw - JOYSTICK_MIN_SPAN : 0;
+	if (joystick_cal.max[axis] < raw + JOYSTICK_MIN_SPAN)
+		joystick_cal.max[axis] = (raw + JOYSTICK_MIN_SPAN < JOYSTICK_ADC_MAX) ? raw + JOYSTICK_MIN_SPAN : JOYSTICK_ADC_MAX;
+	joystick_update_gains(axis);
+}
+
+// running min/max: the calibration only ever widens
+static void joystick_track_limits(uint8_t axis, uint16_t raw)
+{
+	if (raw < joystick_cal.min[axis])
+	{
+		joystick_cal.min[axis] = raw;
+		joystick_update_gains(axis);
+	}
+	else if (raw > joystick_cal.max[axis])
+	{
+		joystick_cal.max[axis] = raw;
+		joystick_update_gains(axis);
+	}
+}
+
+static int8_t joystick_normalize(uint8_t axis, uint16_t raw)
+{
+	uint16_t center = joystick_cal.center[axis];
+	uint16_t n;
+
+	if (raw >= center)
+	{
+		n = ((uint32_t)(raw - center) * joystick_gain_pos[axis] + 128) >> 8;
+		return (n > JOYSTICK_OUTPUT_MAX) ? JOYSTICK_OUTPUT_MAX : (int8_t)n;
+	}
+	n = ((uint32_t)(center - raw) * joystick_gain_neg[axis] + 128) >> 8;
+	return (n > JOYSTICK_OUTPUT_MAX) ? -JOYSTICK_OUTPUT_MAX : -(int8_t)n;
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Integer Square Root
+ *
+ * PURPOSE: Largest r with r * r <= n, one result bit per step (8 steps,
+ *          8x8 multiplies only)
+ */
+static uint8_t joystick_isqrt(uint16_t n)
+{
+	uint8_t root = 0;
+	uint8_t bit, trial;
+
+	for (bit = 0x80; bit; bit >>= 1)
+	{
+		trial = root | bit;
+		if ((uint16_t)trial * trial <= n)
+			root = trial;
+	}
+	return root;
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Output Sample
+ *
+ * PURPOSE: Calibrate both axes, then work on the vector length r only:
+ *          deadzone and curve map r to a magnitude m, and the vector is
+ *          scaled by m / r so its direction is kept.
+ */
+static void joystick_process(uint16_t raw_x, uint16_t raw_y)
+{
+	uint8_t axis, r, t, m;
+	int8_t nx, ny;
+	uint16_t q;
+
+	joystick_raw[0] = raw_x;
+	joystick_raw[1] = raw_y;
+
+	if (joystick_need_center)
+	{
+		joystick_learn_center(0, raw_x);
+		joystick_learn_center(1, raw_y);
+		joystick_need_center = 0;
+	}
+	else
+	{
+		joystick_track_limits(0, raw_x);
+		joystick_track_limits(1, raw_y);
+	}
+
+	nx = joystick_normalize(0, raw_x);
+	ny = joystick_normalize(1, raw_y);
+	r = joystick_isqrt((uint16_t)(nx * nx) + (uint16_t)(ny * ny)); // up to 179 on diagonals
+
+	if (r <= joystick_deadzone)
+	{
+		// resting: let the center follow slow drift
+		if ((r <= joystick_deadzone / 2) && (++joystick_track_count >= JOYSTICK_CENTER_TRACK))
+		{
+			joystick_track_count = 0;
+			for (axis = 0; axis < 2; axis++)
+			{
+				if (joystick_raw[axis] > joystick_cal.center[axis])
+					joystick_cal.center[axis]++;
+				else if (joystick_raw[axis] < joystick_cal.center[axis])
+					joystick_cal.center[axis]--;
+				joystick_update_gains(axis);
+			}
+		}
+		joystick_state.x = 0;
+		joystick_state.y = 0;
+		joystick_state.magnitude = 0;
+		joystick_state.sequence++;
+		return;
+	}
+
+	t = (r > JOYSTICK_OUTPUT_MAX) ? JOYSTICK_OUTPUT_MAX : r;
+	q = ((uint16_t)(t - joystick_deadzone) * joystick_dz_gain) >> 8;
+	t = (q > JOYSTICK_OUTPUT_MAX) ? JOYSTICK_OUTPUT_MAX : (uint8_t)q;
+	m = ((uint16_t)t * (256 - joystick_expo) + (uint16_t)pgm_read_byte(&joystick_cube[t]) * joystick_expo) >> 8;
+
+	q = ((uint16_t)m << 8) / r; // Q8 scale factor m / r
+	joystick_state.x = (int8_t)(((int32_t)nx * q) >> 8);
+	joystick_state.y = (int8_t)(((int32_t)ny * q) >> 8);
+	joystick_state.magnitude = m;
+	joystick_state.sequence++;
+}
+
+/*
+ * EDUCATIONAL FUNCTION: ADC Hook
+ *
+ * PURPOSE: Called from ISR(ADC_vect) for every scanned channel. An
+ *          output sample is computed when the Y sum is complete; if the
+ *          X sum is not (scan started on Y), both restart in step.
+ */
+void Joystick_adc_sample(uint8_t channel, uint16_t value)
+{
+	if (channel == JOYSTICK_X_CHANNEL)
+	{
+		joystick_sum[0] += value;
+		joystick_count[0]++;
+		return;
+	}
+	if (channel != JOYSTICK_Y_CHANNEL)
+		return;
+
+	joystick_sum[1] += value;
+	if (++joystick_count[1] < JOYSTICK_OVERSAMPLE)
+		return;
+
+	if (joystick_count[0] == JOYSTICK_OVERSAMPLE)
+		joystick_process(joystick_sum[0] / JOYSTICK_OVERSAMPLE, joystick_sum[1] / JOYSTICK_OVERSAMPLE);
+	joystick_sum[0] = 0;
+	joystick_sum[1] = 0;
+	joystick_count[0] = 0;
+	joystick_count[1] = 0;
+}
+
+void Joystick_init(void)
+{
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		joystick_sum[0] = joystick_sum[1] = 0;
+		joystick_count[0] = joystick_count[1] = 0;
+		joystick_track_count = 0;
+		joystick_state.x = 0;
+		joystick_state.y = 0;
+		joystick_state.magnitude = 0;
+	}
+	Joystick_set_deadzone(JOYSTICK_DEADZONE_DEFAULT);
+	Joystick_set_expo(JOYSTICK_EXPO_DEFAULT);
+	if (!Joystick_load_calibration())
+		Joystick_reset_calibration();
+
+	Adc_scan_start((1 << JOYSTICK_X_CHANNEL) | (1 << JOYSTICK_Y_CHANNEL));
+}
+
+void Joystick_set_deadzone(uint8_t deadzone)
+{
+	if (deadzone > JOYSTICK_DEADZONE_MAX)
+		deadzone = JOYSTICK_DEADZONE_MAX;
+
+	uint16_t span = JOYSTICK_OUTPUT_MAX - deadzone;
+	uint16_t gain = (uint16_t)(((uint32_t)JOYSTICK_OUTPUT_MAX * 256UL + span / 2) / span);
+
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		joystick_deadzone = deadzone;
+		joystick_dz_gain = gain;
+	}
+}
+
+void Joystick_set_expo(uint16_t expo)
+{
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		joystick_expo = (expo > 256) ? 256 : expo;
+	}
+}
+
+int8_t Joystick_x(void)
+{
+	return joystick_state.x; // one byte: atomic on AVR
+}
+
+int8_t Joystick_y(void)
+{
+	return joystick_state.y;
+}
+
+void Joystick_read(Joystick_state_t *state)
+{
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		*state = *(Joystick_state_t *)&joystick_state;
+	}
+}
+
+uint8_t Joystick_sequence(void)
+{
+	return joystick_state.sequence;
+}
+
+void Joystick_get_raw(uint16_t *x, uint16_t *y)
+{
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		*x = joystick_raw[0];
+		*y = joystick_raw[1];
+	}
+}
+
+void Joystick_calibrate_center(void)
+{
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		joystick_need_center = 1;
+	}
+}
+
+void Joystick_reset_calibration(void)
+{
+	uint8_t axis;
+
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		for (axis = 0; axis < 2; axis++)
+		{
+			joystick_cal.min[axis] = JOYSTICK_ADC_MAX;
+			joystick_cal.center[axis] = JOYSTICK_ADC_MAX / 2;
+			joystick_cal.max[axis] = 0;
+		}
+		joystick_need_center = 1;
+	}
+}
+
+void Joystick_get_calibration(Joystick_calibration_t *cal)
+{
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		*cal = joystick_cal;
+	}
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Store Calibration
+ *
+ * PURPOSE: Magic byte, min/center/max and an XOR checksum. An unchanged
+ *          record is not written again: EEPROM cells wear out.
+ * NOTE: Blocks for about 3.3ms per byte written; the ADC ISR keeps running.
+ */
+uint8_t Joystick_save_calibration(void)
+{
+	unsigned char record[JOYSTICK_RECORD_SIZE];
+	unsigned char checksum = 0;
+	uint8_t i;
+
+	record[0] = JOYSTICK_MAGIC;
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		for (i = 0; i < sizeof(Joystick_calibration_t); i++)
+			record[1 + i] = ((const unsigned char *)&joystick_cal)[i];
+	}
+	for (i = 0; i < JOYSTICK_RECORD_SIZE - 1; i++)
+		checksum ^= record[i];
+	record[JOYSTICK_RECORD_SIZE - 1] = checksum;
+
+	if (EEPROM_verify_block(JOYSTICK_EEPROM_ADDR, record, JOYSTICK_RECORD_SIZE))
+		return 0;
+	EEPROM_write_block(JOYSTICK_EEPROM_ADDR, record, JOYSTICK_RECORD_SIZE);
+	return 1;
+}
+
+uint8_t Joystick_load_calibration(void)
+{
+	unsigned char record[JOYSTICK_RECORD_SIZE];
+	unsigned char checksum = 0;
+	Joystick_calibration_t cal;
+	uint8_t i, axis;
+
+	EEPROM_read_block(JOYSTICK_EEPROM_ADDR, record, JOYSTICK_RECORD_SIZE);
+	for (i = 0; i < JOYSTICK_RECORD_SIZE - 1; i++)
+		checksum ^= record[i];
+	if ((record[0] != JOYSTICK_MAGIC) || (record[JOYSTICK_RECORD_SIZE - 1] != checksum))
+		return 0;
+
+	for (i = 0; i < sizeof(cal); i++)
+		((unsigned char *)&cal)[i] = record[1 + i];
+	for (axis = 0; axis < 2; axis++)
+	{
+		if ((cal.min[axis] >= cal.center[axis]) || (cal.center[axis] >= cal.max[axis]) ||
+			(cal.max[axis] > JOYSTICK_ADC_MAX))
+			return 0;
+	}
+
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		joystick_cal = cal;
+		joystick_update_gains(0);
+		joystick_update_gains(1);
+		joystick_need_center = 0;
+	}
+	return 1;
+}
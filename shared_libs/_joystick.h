@@ -0,0 +1,120 @@
+/*
+ * _joystick.h - Analog Joystick Pipeline (Calibration, Deadzone, Curves)
+ * Educational Version for Assembly→C→Python Learning Progression
+ *
+ * PURPOSE:
+ * One joystick driver instead of hand-rolled scaling in every exercise.
+ * The ADC background scan (Adc_scan_start in _adc.c) feeds every X/Y
+ * conversion into Joystick_adc_sample(); the pipeline runs inside that
+ * ISR and leaves the finished position where the program reads it in a
+ * few cycles:
+ *
+ *   raw 0..1023 -> oversample -> calibrate -> radial deadzone -> curve
+ *               -> x, y = -127..127
+ *
+ * All integer math: no float, one 16-bit division per output sample.
+ *
+ * CALIBRATION (running, stored in EEPROM):
+ * - Center: first sample after Joystick_init() when the EEPROM holds no
+ *   calibration (leave the stick at rest), or Joystick_calibrate_center().
+ *   While the stick rests well inside the deadzone the center follows
+ *   slow drift, one count every JOYSTICK_CENTER_TRACK samples.
+ * - Min/max: start JOYSTICK_MIN_SPAN counts around the center and widen
+ *   whenever the stick goes further, so one full circle calibrates it.
+ * - Joystick_save_calibration() stores min/center/max with a checksum at
+ *   JOYSTICK_EEPROM_ADDR; Joystick_init() loads it back.
+ *
+ * DEADZONE AND RESPONSE CURVE:
+ * The deadzone is radial (a circle, not a square: diagonals are not
+ * delayed), and the remaining travel is stretched so output still starts
+ * at 0 and ends at 127. The expo curve blends linear and cubic response,
+ * out = ((256 - expo) * t + expo * t^3) / 256, the cube from a PROGMEM
+ * table: fine control near the center, full speed at the edge.
+ *
+ * BUILD:
+ * -DJOYSTICK_ENABLED, link _joystick.c, _adc.c and _eeprom.c, and enable
+ * interrupts (sei). Joystick_init() starts the scan of the two channels.
+ */
+
+#ifndef _JOYSTICK_H_
+#define _JOYSTICK_H_
+
+#include <stdint.h>
+
+#ifndef JOYSTICK_X_CHANNEL
+#define JOYSTICK_X_CHANNEL 0 // ADC0
+#endif
+#ifndef JOYSTICK_Y_CHANNEL
+#define JOYSTICK_Y_CHANNEL 1 // ADC1
+#endif
+#ifndef JOYSTICK_OVERSAMPLE
+#define JOYSTICK_OVERSAMPLE 8 // conversions averaged per output (2..64, power of two)
+#endif
+#ifndef JOYSTICK_MIN_SPAN
+#define JOYSTICK_MIN_SPAN 256 // counts from center to full scale before auto-cal widens it
+#endif
+#ifndef JOYSTICK_CENTER_TRACK
+#define JOYSTICK_CENTER_TRACK 16 // output samples per center drift step
+#endif
+#ifndef JOYSTICK_DEADZONE_DEFAULT
+#define JOYSTICK_DEADZONE_DEFAULT 12 // of JOYSTICK_OUTPUT_MAX (about 10%)
+#endif
+#ifndef JOYSTICK_EXPO_DEFAULT
+#define JOYSTICK_EXPO_DEFAULT 0 // 0 = linear ... 256 = cubic
+#endif
+#ifndef JOYSTICK_EEPROM_ADDR
+#define JOYSTICK_EEPROM_ADDR 0x200 // 14 bytes; 0x000 config, 0x100 wear level in _eeprom.c
+#endif
+
+#define JOYSTICK_OUTPUT_MAX 127
+#define JOYSTICK_DEADZONE_MAX 100
+
+/*
+ * Latest Position (one output sample)
+ */
+typedef struct
+{
+	int8_t x;          // -127 (left) .. 127 (right)
+	int8_t y;          // -127 (low ADC) .. 127 (high ADC)
+	uint8_t magnitude; // 0 (in deadzone) .. 127 (full deflection), after the curve
+	uint8_t sequence;  // +1 per output sample (wraps)
+} Joystick_state_t;
+
+typedef struct
+{
+	uint16_t min[2];    // [0] = X, [1] = Y, averaged ADC counts
+	uint16_t center[2];
+	uint16_t max[2];
+} Joystick_calibration_t;
+
+/*
+ * Setup
+ */
+void Joystick_init(void); // load calibration, start the ADC scan
+void Joystick_set_deadzone(uint8_t deadzone); // 0..JOYSTICK_DEADZONE_MAX
+void Joystick_set_expo(uint16_t expo);        // 0..256
+
+/*
+ * Latest-Value API (no waiting, no ADC access)
+ */
+int8_t Joystick_x(void);
+int8_t Joystick_y(void);
+void Joystick_read(Joystick_state_t *state); // x, y and magnitude of the same sample
+uint8_t Joystick_sequence(void);             // changes when a new sample is ready
+void Joystick_get_raw(uint16_t *x, uint16_t *y); // averaged ADC counts
+
+/*
+ * Calibration
+ */
+void Joystick_calibrate_center(void);         // current position becomes the center
+void Joystick_reset_calibration(void);        // learn again from the next sample
+void Joystick_get_calibration(Joystick_calibration_t *cal);
+uint8_t Joystick_save_calibration(void);      // 1 if EEPROM was written (skipped if unchanged)
+uint8_t Joystick_load_calibration(void);      // 1 if a valid calibration was found
+
+/*
+ * ADC Hook (called from ISR(ADC_vect) when built with JOYSTICK_ENABLED)
+ */
+void Joystick_adc_sample(uint8_t channel, uint16_t value);
+
+#endif // _JOYSTICK_H_
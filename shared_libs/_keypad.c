@@ -0,0 +1,270 @@
+/*
+ * _keypad.c - 4x4 Matrix Keypad Scanner with Event Queue
+ * Part of Assembly → C → Python Learning Progression
+ *
+ * EDUCATIONAL OBJECTIVES:
+ * 1. Background scanning: one row per timer tick instead of a busy loop
+ * 2. Debouncing with an integrator per key (independent, n-key rollover)
+ * 3. Ghost keys of a diode-less matrix and how to refuse them
+ * 4. Producer/consumer: the ISR posts events, the program reads them
+ *
+ * COST:
+ * One tick reads one port, writes one port and updates 4 integrators,
+ * a few microseconds. The event queue is a _spsc.h ring: the ISR is the
+ * only producer, the program the only consumer, so no locking is needed.
+ */
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/pgmspace.h>
+#include <util/atomic.h>
+#include <string.h>
+#include "_keypad.h"
+#include "_spsc.h"
+#ifdef EVENT_BUS_ENABLED
+#include "_event.h"
+#endif
+
+#ifndef KEYPAD_MAP
+#define KEYPAD_MAP "123A456B789C*0#D" // row by row, as printed on the keypad
+#endif
+
+#define KEYPAD_ROW_MASK 0x0F // row outputs, bits 0..3
+#define KEYPAD_COL_MASK 0xF0 // column inputs, bits 4..7
+
+// every key is sampled once per full scan
+#define KEYPAD_SCAN_US ((unsigned long)KEYPAD_TICK_US * KEYPAD_ROWS)
+#define KEYPAD_SAMPLES(ms) (((unsigned long)(ms) * 1000UL + KEYPAD_SCAN_US - 1) / KEYPAD_SCAN_US)
+#define KEYPAD_INTEGRATOR_MAX KEYPAD_SAMPLES(KEYPAD_DEBOUNCE_MS)
+#define KEYPAD_LONG_SAMPLES KEYPAD_SAMPLES(KEYPAD_LONG_PRESS_MS)
+#define KEYPAD_REPEAT_DELAY_SAMPLES KEYPAD_SAMPLES(KEYPAD_REPEAT_DELAY_MS)
+#define KEYPAD_REPEAT_RATE_SAMPLES KEYPAD_SAMPLES(KEYPAD_REPEAT_RATE_MS)
+
+typedef char keypad_times_must_fit_8bit_counters
+	[(KEYPAD_INTEGRATOR_MAX >= 1 && KEYPAD_INTEGRATOR_MAX <= 255 && KEYPAD_REPEAT_DELAY_SAMPLES <= 255 &&
+	  KEYPAD_REPEAT_RATE_SAMPLES >= 1 && KEYPAD_REPEAT_RATE_SAMPLES <= 255 && KEYPAD_LONG_SAMPLES <= 65535UL)
+		 ? 1
+		 : -1];
+
+#if KEYPAD_OWN_TIMER
+// Timer2 CTC, prescaler 64 (CS22:0 = 011 on the ATmega128 Timer2), rounded
+#define KEYPAD_TIMER2_OCR ((((F_CPU) / 64UL) * KEYPAD_TICK_US + 500000UL) / 1000000UL - 1)
+typedef char keypad_tick_must_fit_timer2[(KEYPAD_TIMER2_OCR >= 1 && KEYPAD_TIMER2_OCR <= 255) ? 1 : -1];
+#endif
+
+static const char keypad_map[KEYPAD_KEYS + 1] PROGMEM = KEYPAD_MAP;
+
+// Event ring: one byte per event, type << 4 | key index
+SPSC_RING_DEFINE(keypad_events, KEYPAD_QUEUE_SIZE);
+
+static uint8_t keypad_row;                     // row selected on the last tick
+static uint8_t keypad_raw[KEYPAD_ROWS];        // last sample of each row, 1 = closed
+static uint8_t keypad_integrator[KEYPAD_KEYS]; // 0 = open ... MAX = closed
+static uint16_t keypad_hold[KEYPAD_KEYS];      // samples held, stops at the long press
+static uint8_t keypad_repeat[KEYPAD_KEYS];     // samples until the next repeat
+static volatile uint16_t keypad_pressed;       // debounced state, bit = key index
+static volatile Keypad_stats_t keypad_stats;
+
+static void keypad_post(uint8_t type, uint8_t index)
+{
+	if (!Spsc_put(&keypad_events, (type << 4) | index))
+		keypad_stats.dropped++;
+#ifdef EVENT_BUS_ENABLED
+	Event_post(EVENT_KEYPAD, EVENT_PRIORITY_NORMAL, (unsigned int)pgm_read_byte(&keypad_map[index]) | ((unsigned int)type << 8));
+#endif
+}
+
+// drive one row low, the other rows high; column pull-ups stay on
+static void keypad_select(uint8_t row)
+{
+	KEYPAD_PORT = (KEYPAD_PORT & (uint8_t)~KEYPAD_ROW_MASK) | (KEYPAD_ROW_MASK & ~(1 << row));
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Integrate One Row
+ *
+ * PURPOSE: closed holds the 4 column contacts of the row (1 = closed).
+ *          Each key's integrator moves one step towards the contact; the
+ *          debounced state only flips at the ends of the range. Keys that
+ *          could be ghosts are held where they are until the rectangle
+ *          of closed contacts is gone.
+ */
+static void keypad_sample_row(uint8_t row, uint8_t closed)
+{
+	uint8_t ghost = 0;
+	uint8_t changed = closed ^ keypad_raw[row];
+	uint8_t col, i, r, shared;
+	uint16_t bit;
+
+	for (r = 0; r < KEYPAD_ROWS; r++)
+	{
+		shared = closed & keypad_raw[r];
+		if ((r != row) && (shared & (shared - 1))) // two or more common columns
+			ghost |= shared;
+	}
+	for (; changed; changed &= changed - 1) // one per contact that moved
+		keypad_stats.raw_changes++;
+	keypad_raw[row] = closed;
+
+	for (col = 0; col < KEYPAD_COLS; col++)
+	{
+		i = row * KEYPAD_COLS + col;
+		bit = (uint16_t)1 << i;
+
+		if (closed & (1 << col))
+		{
+			if ((ghost & (1 << col)) && !(keypad_pressed & bit))
+			{
+				keypad_stats.ghost_blocks++;
+				continue;
+			}
+			if (keypad_integrator[i] < KEYPAD_INTEGRATOR_MAX)
+				keypad_integrator[i]++;
+			if ((keypad_integrator[i] == KEYPAD_INTEGRATOR_MAX) && !(keypad_pressed & bit))
+			{
+				keypad_pressed |= bit;
+				keypad_hold[i] = 0;
+				keypad_repeat[i] = KEYPAD_REPEAT_DELAY_SAMPLES;
+				keypad_stats.presses++;
+				keypad_post(KEYPAD_PRESS, i);
+				continue;
+			}
+		}
+		else if (keypad_integrator[i] && (--keypad_integrator[i] == 0) && (keypad_pressed & bit))
+		{
+			keypad_pressed &= ~bit;
+			keypad_post(KEYPAD_RELEASE, i);
+			continue;
+		}
+
+		if (!(keypad_pressed & bit))
+			continue;
+		if (keypad_hold[i] < KEYPAD_LONG_SAMPLES && ++keypad_hold[i] == KEYPAD_LONG_SAMPLES)
+			keypad_post(KEYPAD_LONG, i);
+		if (--keypad_repeat[i] == 0)
+		{
+			keypad_repeat[i] = KEYPAD_REPEAT_RATE_SAMPLES;
+			keypad_post(KEYPAD_REPEAT, i);
+		}
+	}
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Scanner Tick
+ *
+ * PURPOSE: The row selected on the previous tick has settled for a whole
+ *          tick: read its columns, select the next row, then integrate.
+ *          Four ticks sample every key once.
+ */
+void Keypad_tick(void)
+{
+	uint8_t row = keypad_row;
+	uint8_t closed = (uint8_t)(~KEYPAD_PIN & KEYPAD_COL_MASK) >> 4;
+
+	keypad_row = (row + 1) & (KEYPAD_ROWS - 1);
+	keypad_select(keypad_row);
+	keypad_sample_row(row, closed);
+}
+
+#if KEYPAD_OWN_TIMER
+ISR(TIMER2_COMP_vect)
+{
+	Keypad_tick();
+}
+#endif
+
+void Keypad_init(void)
+{
+	KEYPAD_DDR = (KEYPAD_DDR & (uint8_t)~KEYPAD_COL_MASK) | KEYPAD_ROW_MASK;
+	KEYPAD_PORT |= KEYPAD_COL_MASK; // pull-ups: an open column reads 1
+	keypad_row = 0;
+	keypad_select(0);
+
+	memset(keypad_raw, 0, sizeof(keypad_raw));
+	memset(keypad_integrator, 0, sizeof(keypad_integrator));
+	keypad_pressed = 0;
+	Spsc_reset(&keypad_events);
+	Keypad_reset_stats();
+
+#if KEYPAD_OWN_TIMER
+	TCCR2 = (1 << WGM21) | (1 << CS21) | (1 << CS20); // CTC, prescaler 64
+	OCR2 = KEYPAD_TIMER2_OCR;
+	TCNT2 = 0;
+	TIMSK |= (1 << OCIE2);
+#endif
+}
+
+uint8_t Keypad_get_event(Keypad_event_t *event)
+{
+	uint8_t code;
+
+	if (Spsc_is_empty(&keypad_events))
+		return 0;
+	code = Spsc_get(&keypad_events);
+	event->type = code >> 4;
+	event->index = code & 0x0F;
+	event->key = Keypad_key_char(event->index);
+	return 1;
+}
+
+uint8_t Keypad_pending(void)
+{
+	return Spsc_count(&keypad_events);
+}
+
+void Keypad_flush(void)
+{
+	while (!Spsc_is_empty(&keypad_events))
+		Spsc_get(&keypad_events);
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Next Typed Key
+ *
+ * PURPOSE: For text entry: presses and auto-repeats are keystrokes,
+ *          releases and long presses are skipped. Returns '\0' at once
+ *          when nothing was typed, so the caller keeps running.
+ */
+char Keypad_getkey(void)
+{
+	Keypad_event_t event;
+
+	while (Keypad_get_event(&event))
+	{
+		if ((event.type == KEYPAD_PRESS) || (event.type == KEYPAD_REPEAT))
+			return event.key;
+	}
+	return '\0';
+}
+
+uint16_t Keypad_state(void)
+{
+	uint16_t state;
+
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		state = keypad_pressed;
+	}
+	return state;
+}
+
+char Keypad_key_char(uint8_t index)
+{
+	return (index < KEYPAD_KEYS) ? (char)pgm_read_byte(&keypad_map[index]) : '\0';
+}
+
+void Keypad_get_stats(Keypad_stats_t *stats)
+{
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		*stats = *(Keypad_stats_t *)&keypad_stats;
+	}
+}
+
+void Keypad_reset_stats(void)
+{
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		memset((void *)&keypad_stats, 0, sizeof(keypad_stats));
+	}
+}
@@ -0,0 +1,136 @@
+/*
+ * _keypad.h - 4x4 Matrix Keypad Scanner with Event Queue
+ * Educational Version for Assembly→C→Python Learning Progression
+ *
+ * PURPOSE:
+ * Scans the keypad in the background and turns key activity into events.
+ * The program never waits for a key: it asks the queue whenever it has
+ * time, the same way it reads the UART.
+ *
+ *   Keypad_event_t ev;
+ *   while (Keypad_get_event(&ev))
+ *       if (ev.type == KEYPAD_PRESS) handle(ev.key);
+ *
+ * WIRING (board default, override KEYPAD_DDR/PORT/PIN for the whole build):
+ *   PA0..PA3  rows, driven low one at a time (others high)
+ *   PA4..PA7  columns, inputs with pull-ups (0 = switch closed)
+ *
+ * SCANNING:
+ * Keypad_tick() runs every KEYPAD_TICK_US. Each tick reads the columns of
+ * the row selected on the previous tick, then selects the next row, so a
+ * row has a whole tick to settle and no _delay_us() is needed. All 16
+ * keys are sampled every 4 ticks.
+ *
+ * SYSTEM TICK (default):
+ * Build with -DKEYPAD_ENABLED and link _timer2.c: Timer2_ovf_handler()
+ * calls Keypad_tick() on every system tick, like Debounce_tick(). The
+ * application calls Timer2_init() and defines
+ *   ISR(TIMER2_OVF_vect) { Timer2_ovf_handler(); }
+ * Without _timer2, call Keypad_tick() from any periodic ISR and set
+ * KEYPAD_TICK_US to its period.
+ *
+ * OWN TIMER (-DKEYPAD_OWN_TIMER=1):
+ * The driver reprograms Timer2 into CTC mode and scans from its compare
+ * ISR. Only for programs that use Timer2 for nothing else: the system
+ * tick (_timer2.c, Timer2_get_ticks, _cpu_load.c, Debounce_tick) stops
+ * working, so _timer2.c refuses to build with it.
+ *
+ * DEBOUNCING:
+ * Every key has its own integrator: +1 per sample while closed, -1 while
+ * open, clamped to 0..KEYPAD_INTEGRATOR_MAX. A key is pressed when it
+ * reaches the top and released when it reaches 0, so a bounce only delays
+ * the decision. Keys are independent: several can be held at once
+ * (n-key rollover) and Keypad_state() reports all of them.
+ *
+ * GHOST KEYS:
+ * Without diodes, three keys on the corners of a rectangle make the fourth
+ * corner read closed. While two rows share two or more closed columns,
+ * keys in those columns cannot become newly pressed (already pressed keys
+ * stay pressed), so no phantom press is reported.
+ *
+ * EVENTS (per key, times from the keypad projects):
+ *   KEYPAD_PRESS    debounced press
+ *   KEYPAD_REPEAT   after KEYPAD_REPEAT_DELAY_MS held, every KEYPAD_REPEAT_RATE_MS
+ *   KEYPAD_LONG     once, after KEYPAD_LONG_PRESS_MS held
+ *   KEYPAD_RELEASE  debounced release
+ * Build with -DEVENT_BUS_ENABLED to also post EVENT_KEYPAD (data = key
+ * code | type << 8) to the event bus.
+ */
+
+#ifndef _KEYPAD_H_
+#define _KEYPAD_H_
+
+#include <stdint.h>
+
+#ifndef KEYPAD_DDR
+#define KEYPAD_DDR DDRA
+#define KEYPAD_PORT PORTA
+#define KEYPAD_PIN PINA
+#endif
+
+#ifndef KEYPAD_OWN_TIMER
+#define KEYPAD_OWN_TIMER 0 // 1 = the driver takes Timer2 (CTC) for itself
+#endif
+#ifndef KEYPAD_TICK_US
+#if KEYPAD_OWN_TIMER
+#define KEYPAD_TICK_US 1000 // one row per tick, 4ms per full scan
+#else
+#include "_timer2.h"
+#define KEYPAD_TICK_US TIMER2_TICK_US // Timer2_ovf_handler() period (998us at 7.3728MHz)
+#endif
+#endif
+#ifndef KEYPAD_DEBOUNCE_MS
+#define KEYPAD_DEBOUNCE_MS 20
+#endif
+#ifndef KEYPAD_LONG_PRESS_MS
+#define KEYPAD_LONG_PRESS_MS 1000
+#endif
+#ifndef KEYPAD_REPEAT_DELAY_MS
+#define KEYPAD_REPEAT_DELAY_MS 500
+#endif
+#ifndef KEYPAD_REPEAT_RATE_MS
+#define KEYPAD_REPEAT_RATE_MS 100
+#endif
+#ifndef KEYPAD_QUEUE_SIZE
+#define KEYPAD_QUEUE_SIZE 16 // events, power of two
+#endif
+
+#define KEYPAD_ROWS 4
+#define KEYPAD_COLS 4
+#define KEYPAD_KEYS (KEYPAD_ROWS * KEYPAD_COLS)
+
+// Event types
+#define KEYPAD_PRESS 0
+#define KEYPAD_RELEASE 1
+#define KEYPAD_LONG 2
+#define KEYPAD_REPEAT 3
+
+typedef struct
+{
+	uint8_t type;  // KEYPAD_PRESS ... KEYPAD_REPEAT
+	uint8_t index; // row * 4 + column
+	char key;      // character from the key map ('1' ... 'D')
+} Keypad_event_t;
+
+typedef struct
+{
+	unsigned int raw_changes; // sampled contact changes, bounces included
+	unsigned int presses;     // debounced presses
+	unsigned int ghost_blocks; // samples in which a possible ghost was held back
+	unsigned int dropped;     // events lost because the queue was full
+} Keypad_stats_t;
+
+void Keypad_init(void); // port, timer and queue; the program must call sei()
+void Keypad_tick(void); // one row; called by the driver's ISR (or yours)
+
+uint8_t Keypad_get_event(Keypad_event_t *event); // 1 = event returned, never blocks
+uint8_t Keypad_pending(void);                    // events waiting
+void Keypad_flush(void);                         // discard waiting events
+char Keypad_getkey(void);                        // next PRESS/REPEAT key or '\0', never blocks
+uint16_t Keypad_state(void);                     // held keys, bit = row * 4 + column
+char Keypad_key_char(uint8_t index);             // key map lookup
+
+void Keypad_get_stats(Keypad_stats_t *stats);
+void Keypad_reset_stats(void);
+
+#endif // _KEYPAD_H_
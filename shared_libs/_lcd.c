@@ -0,0 +1,510 @@
+/*
+ * _lcd.c - HD44780 Character LCD Driver with Shadow DDRAM
+ * Part of Assembly → C → Python Learning Progression
+ *
+ * EDUCATIONAL OBJECTIVES:
+ * 1. Bus protocol: one (8-bit) or two (4-bit) E pulses per byte, RS
+ *    selects instruction/data; the wiring is a backend (_lcd_backend.h)
+ * 2. Shadow copies: draw in RAM, send only the difference
+ * 3. Address counter: runs of neighbouring cells need one address command
+ * 4. Asynchronous output (LCD_ASYNC=1): a timer ISR drains a byte queue,
+ *    one E cycle per tick, so the program never waits for the LCD
+ *
+ * TIMING:
+ * The E pulse and the gap between the two nibbles only need about 1us
+ * (E cycle >= 1000ns); the LCD then executes the byte in 37us, which
+ * LCD_EXEC_US covers. Clear and home take 1.52ms. With R/W wired
+ * (LCD_PIN_RW defined) the busy flag is polled instead of waiting fixed times.
+ */
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/pgmspace.h>
+#include <util/atomic.h>
+#include <util/delay.h>
+#include <string.h>
+#include "_lcd.h"
+
+#include "_lcd_backend.h" // selects the bus: parallel 4/8-bit or PCF8574
+
+#ifndef LCD_EXEC_US
+#define LCD_EXEC_US LCD_BACKEND_EXEC_US
+#endif
+
+#define LCD_ADDR_UNKNOWN 0xFF // address counter not pointing into DDRAM
+#define LCD_SPAN_CLEAN 0xFF   // dirty_lo > dirty_hi: row is clean
+
+static char lcd_shadow[LCD_ROWS][LCD_COLS]; // what the program wrote
+static char lcd_panel[LCD_ROWS][LCD_COLS];  // what the LCD shows
+static uint8_t lcd_dirty_lo[LCD_ROWS];      // changed columns per row
+static uint8_t lcd_dirty_hi[LCD_ROWS];
+static uint8_t lcd_addr = LCD_ADDR_UNKNOWN; // LCD address counter
+static uint8_t lcd_row, lcd_col;            // write position in the shadow
+static uint8_t lcd_render_mode = LCD_RENDER_IMMEDIATE;
+static Lcd_bus_stats_t lcd_stats;
+
+// DDRAM address of column 0 of each row (rows 2 and 3 continue rows 0 and 1)
+static const uint8_t lcd_row_addr[4] = {0x00, 0x40, LCD_COLS, 0x40 + LCD_COLS};
+
+#if LCD_ASYNC
+#ifdef ISR_PRIORITY_PROBE
+#error "LCD_ASYNC and ISR_PRIORITY_PROBE both need TIMER0_COMP_vect - enable only one"
+#endif
+
+#define LCD_QUEUE_MASK (LCD_QUEUE_SIZE - 1)
+
+// Timer0 CTC at LCD_TICK_US or slightly slower (prescaler 32, rounded up)
+#define LCD_TIMER0_OCR ((((F_CPU) / 32UL) * LCD_TICK_US + 999999UL) / 1000000UL - 1)
+// idle ticks after the second nibble: (1 + ticks) * tick >= execution time
+#define LCD_EXEC_TICKS ((LCD_EXEC_US + LCD_TICK_US - 1) / LCD_TICK_US - 1)
+#define LCD_LONG_TICKS ((2000 + LCD_TICK_US - 1) / LCD_TICK_US - 1)
+
+typedef char lcd_queue_size_must_be_power_of_two_max_128
+	[(((LCD_QUEUE_SIZE) & ((LCD_QUEUE_SIZE) - 1)) == 0 && (LCD_QUEUE_SIZE) <= 128) ? 1 : -1];
+typedef char lcd_tick_must_fit_timer0[(LCD_TIMER0_OCR >= 1 && LCD_TIMER0_OCR <= 255) ? 1 : -1];
+
+// Byte queue, _spsc.h rules: head written by the program, tail by the ISR
+static uint8_t lcd_queue_value[LCD_QUEUE_SIZE];
+static uint8_t lcd_queue_flags[LCD_QUEUE_SIZE];
+static volatile uint8_t lcd_queue_head;
+static volatile uint8_t lcd_queue_tail;
+static volatile uint8_t lcd_queue_running; // ISR enabled, queue or execution not finished
+static uint8_t lcd_queue_cycle;            // E cycles of the current byte already sent
+static uint8_t lcd_queue_wait;             // ticks until the LCD finished executing
+
+/*
+ * EDUCATIONAL FUNCTION: One Queue Tick
+ *
+ * PURPOSE: Each tick does at most one thing: count down the execution
+ *          time or send one E cycle (a nibble in 4-bit mode, the whole
+ *          byte in 8-bit mode). The ISR
+ *          therefore takes about 2us however much text is queued. When
+ *          the queue is empty the timer interrupt switches itself off.
+ */
+static void lcd_queue_tick(void)
+{
+	uint8_t tail, flags;
+
+	if (lcd_queue_wait)
+	{
+		lcd_queue_wait--;
+		return;
+	}
+
+	tail = lcd_queue_tail;
+	if (tail == lcd_queue_head)
+	{
+#ifdef LCD_BACKEND_BUSY
+		if (lcd_backend_busy())
+			return; // last byte sent but not executed: Lcd_flush() waits
+#endif
+		TIMSK &= ~(1 << OCIE0);
+		lcd_queue_running = 0;
+		return;
+	}
+	flags = lcd_queue_flags[tail & LCD_QUEUE_MASK];
+
+#ifdef LCD_BACKEND_BUSY
+	if ((lcd_queue_cycle == 0) && lcd_backend_busy())
+		return; // still executing the previous byte, ask again next tick
+#endif
+	// 4-bit: cycle 0 sends bits 7..4, cycle 1 bits 3..0
+	lcd_backend_cycle(lcd_queue_value[tail & LCD_QUEUE_MASK] << (4 * lcd_queue_cycle), flags);
+	if (++lcd_queue_cycle < LCD_BUS_CYCLES)
+		return;
+
+	lcd_queue_cycle = 0;
+#ifndef LCD_BACKEND_BUSY
+	lcd_queue_wait = (flags & LCD_WRITE_LONG) ? LCD_LONG_TICKS : LCD_EXEC_TICKS;
+#endif
+	__asm__ __volatile__("" ::: "memory"); // slot read before it is released
+	lcd_queue_tail = tail + 1;
+}
+
+ISR(TIMER0_COMP_vect)
+{
+	lcd_queue_tick();
+}
+
+// make progress without the ISR when interrupts are disabled
+static void lcd_queue_step(void)
+{
+	if (!(SREG & (1 << SREG_I)))
+	{
+		lcd_queue_tick();
+		_delay_us(LCD_TICK_US);
+	}
+}
+
+static void lcd_queue_put(uint8_t value, uint8_t flags)
+{
+	uint8_t head = lcd_queue_head;
+
+	while ((uint8_t)(head - lcd_queue_tail) >= LCD_QUEUE_SIZE)
+		lcd_queue_step(); // full: the ISR frees a slot within one byte time
+
+	lcd_queue_value[head & LCD_QUEUE_MASK] = value;
+	lcd_queue_flags[head & LCD_QUEUE_MASK] = flags;
+	__asm__ __volatile__("" ::: "memory"); // slot written before it is published
+	lcd_queue_head = head + 1;
+
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		lcd_queue_running = 1;
+		TIMSK |= (1 << OCIE0);
+	}
+	if (!(SREG & (1 << SREG_I)))
+		Lcd_flush(); // nobody else will send it
+}
+
+static void lcd_queue_init(void)
+{
+	TCCR0 = (1 << WGM01) | (1 << CS01) | (1 << CS00); // CTC, prescaler 32
+	OCR0 = LCD_TIMER0_OCR;
+	TCNT0 = 0;
+}
+
+void Lcd_flush(void)
+{
+	while (lcd_queue_running)
+		lcd_queue_step();
+}
+
+uint8_t Lcd_pending(void)
+{
+	return (uint8_t)(lcd_queue_head - lcd_queue_tail);
+}
+#else
+// one complete byte, waiting until the LCD has executed it
+static void lcd_send(uint8_t value, uint8_t flags)
+{
+#ifdef LCD_BACKEND_BUSY
+	while (lcd_backend_busy())
+		;
+	lcd_backend_byte(value, flags);
+#else
+	lcd_backend_byte(value, flags);
+	_delay_us(LCD_EXEC_US);
+	if (flags & LCD_WRITE_LONG)
+		_delay_ms(2);
+#endif
+}
+
+void Lcd_flush(void)
+{
+}
+
+uint8_t Lcd_pending(void)
+{
+	return 0;
+}
+#endif
+
+static void lcd_write(uint8_t value, uint8_t flags)
+{
+	if (flags & LCD_WRITE_DATA)
+		lcd_stats.data_bytes++;
+	else
+		lcd_stats.commands++;
+#if LCD_ASYNC
+	lcd_queue_put(value, flags);
+#else
+	lcd_send(value, flags);
+#endif
+}
+
+static void lcd_mark(uint8_t row, uint8_t lo, uint8_t hi)
+{
+	if (lcd_dirty_lo[row] == LCD_SPAN_CLEAN)
+	{
+		lcd_dirty_lo[row] = lo;
+		lcd_dirty_hi[row] = hi;
+		return;
+	}
+	if (lo < lcd_dirty_lo[row])
+		lcd_dirty_lo[row] = lo;
+	if (hi > lcd_dirty_hi[row])
+		lcd_dirty_hi[row] = hi;
+}
+
+// one character into the shadow at the write position
+static void lcd_put(char c)
+{
+	if ((lcd_row < LCD_ROWS) && (lcd_col < LCD_COLS))
+	{
+		if (lcd_shadow[lcd_row][lcd_col] != c)
+		{
+			lcd_shadow[lcd_row][lcd_col] = c;
+			lcd_mark(lcd_row, lcd_col, lcd_col);
+		}
+		lcd_col++;
+	}
+}
+
+static void lcd_auto_sync(void)
+{
+	if (lcd_render_mode == LCD_RENDER_IMMEDIATE)
+		Lcd_sync();
+}
+
+void Lcd_command(uint8_t cmd)
+{
+	lcd_write(cmd, ((cmd == LCD_CLEAR) || ((cmd & 0xFE) == LCD_HOME)) ? LCD_WRITE_LONG : 0);
+
+	if (cmd == LCD_CLEAR)
+	{
+		memset(lcd_shadow, ' ', sizeof(lcd_shadow)); // LCD and both copies are blank
+		memset(lcd_panel, ' ', sizeof(lcd_panel));
+		memset(lcd_dirty_lo, LCD_SPAN_CLEAN, sizeof(lcd_dirty_lo));
+		lcd_addr = 0x00;
+	}
+	else if ((cmd & 0xFE) == LCD_HOME)
+	{
+		lcd_addr = 0x00;
+	}
+	else if (cmd & LCD_DDRAM_ADDR)
+	{
+		lcd_addr = cmd & 0x7F;
+	}
+	else if (cmd >= 0x10) // cursor shift or CGRAM address: counter unknown
+	{
+		lcd_addr = LCD_ADDR_UNKNOWN;
+	}
+}
+
+void Lcd_init(void)
+{
+	lcd_backend_init();
+	_delay_ms(50);
+
+	// Reset by instruction: three times 8-bit mode (then 4-bit mode if wired so)
+	lcd_backend_cycle(0x30, 0);
+	_delay_ms(5);
+	lcd_backend_cycle(0x30, 0);
+	_delay_us(150);
+	lcd_backend_cycle(0x30, 0);
+	_delay_us(150);
+#if LCD_BUS_BITS == 4
+	lcd_backend_cycle(0x20, 0);
+	_delay_us(150);
+#endif
+#if LCD_ASYNC
+	lcd_queue_init(); // from here on every byte goes through the queue
+#endif
+
+	Lcd_command(LCD_FUNCTION_SET | LCD_BUS_DL);
+	Lcd_command(LCD_DISPLAY_ON);
+	Lcd_command(LCD_CLEAR);
+	Lcd_command(LCD_ENTRY_MODE);
+	lcd_row = lcd_col = 0;
+}
+
+void Lcd_set_render_mode(uint8_t mode)
+{
+	lcd_render_mode = mode;
+	lcd_auto_sync(); // back to immediate: send what is pending
+}
+
+uint8_t Lcd_get_render_mode(void)
+{
+	return lcd_render_mode;
+}
+
+// blank the shadow; only cells that showed something are sent
+void Lcd_clear(void)
+{
+	uint8_t row;
+
+	for (row = 0; row < LCD_ROWS; row++)
+	{
+		lcd_row = row;
+		lcd_col = 0;
+		while (lcd_col < LCD_COLS)
+			lcd_put(' ');
+	}
+	lcd_row = lcd_col = 0;
+	lcd_auto_sync();
+}
+
+void Lcd_clear_row(uint8_t row)
+{
+	lcd_row = row;
+	lcd_col = 0;
+	while (lcd_col < LCD_COLS)
+		lcd_put(' ');
+	lcd_col = 0;
+	lcd_auto_sync();
+}
+
+void Lcd_goto(uint8_t row, uint8_t col)
+{
+	lcd_row = row;
+	lcd_col = col;
+}
+
+void Lcd_putc(char c)
+{
+	lcd_put(c);
+	lcd_auto_sync();
+}
+
+void Lcd_puts(const char *str)
+{
+	while (*str)
+		lcd_put(*str++);
+	lcd_auto_sync();
+}
+
+void Lcd_puts_P(const char *str)
+{
+	char c;
+
+	while ((c = pgm_read_byte(str++)) != '\0')
+		lcd_put(c);
+	lcd_auto_sync();
+}
+
+void Lcd_puts_at(uint8_t row, uint8_t col, const char *str)
+{
+	Lcd_goto(row, col);
+	Lcd_puts(str);
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Send the Difference
+ *
+ * PURPOSE: For each changed cell: set the address if the LCD's counter is
+ *          not already there, then write the character. The counter moves
+ *          on by itself, so a run of changed cells costs one command.
+ */
+uint8_t Lcd_sync(void)
+{
+	uint8_t row, col, addr;
+	uint8_t writes = 0;
+
+	for (row = 0; row < LCD_ROWS; row++)
+	{
+		if (lcd_dirty_lo[row] == LCD_SPAN_CLEAN)
+			continue;
+
+		for (col = lcd_dirty_lo[row]; col <= lcd_dirty_hi[row]; col++)
+		{
+			if (lcd_shadow[row][col] == lcd_panel[row][col])
+				continue;
+
+			addr = lcd_row_addr[row] + col;
+			if (lcd_addr != addr)
+			{
+				lcd_write(LCD_DDRAM_ADDR | addr, 0);
+				writes++;
+			}
+			lcd_write(lcd_shadow[row][col], LCD_WRITE_DATA);
+			writes++;
+			lcd_panel[row][col] = lcd_shadow[row][col];
+			lcd_addr = addr + 1;
+		}
+		lcd_dirty_lo[row] = LCD_SPAN_CLEAN;
+	}
+	return writes;
+}
+
+/*
+ * The panel copy gets a value that differs from the shadow cell, so the
+ * next sync resends it, and is never a CGRAM code (< 16): Lcd_cgram_refs()
+ * must not count a cell whose real content is unknown. ~c would turn the
+ * 0xF8..0xFF ROM characters (the 0xFF bar block) into codes 0..7.
+ */
+void Lcd_invalidate(void)
+{
+	uint8_t row, col, stale;
+
+	for (row = 0; row < LCD_ROWS; row++)
+	{
+		for (col = 0; col < LCD_COLS; col++)
+		{
+			stale = (uint8_t)lcd_shadow[row][col] ^ 0x80;
+			if (stale < 16)
+				stale ^= 0xC0; // shadow 0x80..0x8F: 0x40..0x4F instead
+			lcd_panel[row][col] = stale;
+		}
+		lcd_mark(row, 0, LCD_COLS - 1);
+	}
+}
+
+void Lcd_create_char(uint8_t location, const uint8_t *pattern)
+{
+	uint8_t i;
+
+	Lcd_command(LCD_CGRAM_ADDR | ((location & 0x07) << 3));
+	for (i = 0; i < 8; i++)
+		lcd_write(pattern[i], LCD_WRITE_DATA);
+}
+
+void Lcd_create_char_P(uint8_t location, const uint8_t *pattern)
+{
+	uint8_t i;
+
+	Lcd_command(LCD_CGRAM_ADDR | ((location & 0x07) << 3));
+	for (i = 0; i < 8; i++)
+		lcd_write(pgm_read_byte(&pattern[i]), LCD_WRITE_DATA);
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Who Shows a Custom Character?
+ *
+ * PURPOSE: Codes 0..7 and their mirrors 8..15 display CGRAM slot code & 7.
+ *          A cell counts if it shows the slot now (panel) or will show it
+ *          after the next sync (shadow), so a slot with 0 references can be
+ *          overwritten without changing what is on the LCD.
+ */
+void Lcd_cgram_refs(uint8_t refs[8])
+{
+	uint8_t row, col, c;
+
+	memset(refs, 0, 8);
+	for (row = 0; row < LCD_ROWS; row++)
+	{
+		for (col = 0; col < LCD_COLS; col++)
+		{
+			c = (uint8_t)lcd_shadow[row][col];
+			if (c < 16)
+				refs[c & 7]++;
+			if (((uint8_t)lcd_panel[row][col] < 16) && ((uint8_t)lcd_panel[row][col] != c))
+				refs[lcd_panel[row][col] & 7]++;
+		}
+	}
+}
+
+// redraw every shadow cell that shows CGRAM slot (either code) with c
+void Lcd_cgram_replace(uint8_t slot, char c)
+{
+	uint8_t row, col;
+
+	for (row = 0; row < LCD_ROWS; row++)
+	{
+		for (col = 0; col < LCD_COLS; col++)
+		{
+			if (((uint8_t)lcd_shadow[row][col] < 16) && ((lcd_shadow[row][col] & 7) == (slot & 7)))
+			{
+				lcd_shadow[row][col] = c;
+				lcd_mark(row, col, col);
+			}
+		}
+	}
+}
+
+const char *Lcd_backend_name(void)
+{
+	return LCD_BACKEND_NAME;
+}
+
+void Lcd_get_bus_stats(Lcd_bus_stats_t *stats)
+{
+	*stats = lcd_stats;
+}
+
+void Lcd_reset_bus_stats(void)
+{
+	lcd_stats.commands = 0;
+	lcd_stats.data_bytes = 0;
+}
@@ -0,0 +1,126 @@
+/*
+ * _lcd.h - HD44780 Character LCD Driver with Shadow DDRAM
+ * Educational Version for Assembly→C→Python Learning Progression
+ *
+ * PURPOSE:
+ * One character LCD driver for all projects (default: 4-bit mode, board
+ * wiring on PORTG: RS = PG0, E = PG1, D4..D7 = PG2..PG5, RW tied to GND).
+ *
+ * SHADOW DDRAM:
+ * The driver keeps two RAM copies of the display: what the program wrote
+ * (shadow) and what the LCD shows (panel). Writing text only changes the
+ * shadow, which costs a few CPU cycles per character. Lcd_sync() compares
+ * the two and sends only the cells that differ:
+ *
+ *   shadow  "T:23.5C L:45%   "
+ *   panel   "T:23.4C L:44%   "
+ *   bus     [addr 0x05] '5' [addr 0x0B] '5'     4 writes instead of 17
+ *
+ * Neighbouring changed cells are one run: the LCD's address counter
+ * auto-increments, so a run needs a single set-address command.
+ *
+ * RENDER MODES (as GLCD_Set_render_mode in _glcd.h):
+ *   LCD_RENDER_IMMEDIATE  every Lcd_* write call ends with Lcd_sync() (default)
+ *   LCD_RENDER_DEFERRED   nothing is sent until the program calls Lcd_sync(),
+ *                         e.g. once per dashboard tick
+ *
+ * Either way a character that did not change is never sent again, so
+ * "rewrite the whole row every tick" code gets cheap without changes.
+ *
+ * ASYNCHRONOUS OUTPUT (build with -DLCD_ASYNC=1):
+ * Bus writes go into a byte queue and Timer0 (compare match, owned by the
+ * driver) sends one nibble per LCD_TICK_US tick, waiting out the execution
+ * time in between. Lcd_sync() then costs microseconds instead of
+ * milliseconds; a full 16 x 2 redraw no longer blocks the main loop for
+ * ~3.5ms. The timer interrupt switches itself off when the queue is empty.
+ *   Lcd_flush()    barrier: returns when everything queued has been executed
+ *   Lcd_pending()  bytes still queued (0 in the blocking build)
+ * The application must enable interrupts (sei). While they are disabled
+ * the driver sends the queue itself, so nothing is lost or reordered.
+ *
+ * BUS BACKENDS (_lcd_backend.h, compile time):
+ *   -DLCD_BACKEND=LCD_BACKEND_PARALLEL       4-bit, any pin map (default)
+ *   -DLCD_BACKEND=LCD_BACKEND_PARALLEL_8BIT  8-bit, any pin map
+ *   -DLCD_BACKEND=LCD_BACKEND_PCF8574        I2C expander backpack
+ * Pins are "port letter, bit" macros (-DLCD_PIN_E=B,4, see _lcd_parallel.h).
+ * With R/W wired define LCD_PIN_RW and the driver polls the busy flag
+ * instead of waiting the datasheet worst case.
+ *
+ * SIZE:
+ * LCD_ROWS and LCD_COLS default to 2 x 16. For other displays define both
+ * for the whole build (-DLCD_ROWS=4 -DLCD_COLS=20).
+ */
+
+#ifndef _LCD_H_
+#define _LCD_H_
+
+#include <stdint.h>
+
+#ifndef LCD_ROWS
+#define LCD_ROWS 2
+#endif
+#ifndef LCD_COLS
+#define LCD_COLS 16
+#endif
+
+#ifndef LCD_ASYNC
+#define LCD_ASYNC 0 // 1 = queued output drained by the Timer0 compare ISR
+#endif
+#ifndef LCD_TICK_US
+#define LCD_TICK_US 25 // queue tick: one nibble or one wait step
+#endif
+#ifndef LCD_QUEUE_SIZE
+#define LCD_QUEUE_SIZE 64 // bytes, power of two (a 16 x 2 redraw needs ~36)
+#endif
+
+// HD44780 instructions (for Lcd_command)
+#define LCD_CLEAR 0x01
+#define LCD_HOME 0x02
+#define LCD_ENTRY_MODE 0x06     // Increment cursor, no shift
+#define LCD_DISPLAY_ON 0x0C     // Display on, cursor off, blink off
+#define LCD_DISPLAY_CURSOR 0x0E // Display on, cursor on
+#define LCD_DISPLAY_BLINK 0x0F  // Display on, cursor on, blink on
+#define LCD_FUNCTION_SET 0x28   // 2 lines, 5x8 font (the driver adds the bus width)
+#define LCD_CGRAM_ADDR 0x40
+#define LCD_DDRAM_ADDR 0x80
+
+#define LCD_RENDER_IMMEDIATE 0
+#define LCD_RENDER_DEFERRED 1
+
+// Bus accounting (all instruction and data writes since the last reset)
+typedef struct
+{
+	unsigned long commands;   // instructions (set address, clear, ...)
+	unsigned long data_bytes; // characters and CGRAM bytes
+} Lcd_bus_stats_t;
+
+void Lcd_init(void);
+void Lcd_set_render_mode(uint8_t mode);
+uint8_t Lcd_get_render_mode(void);
+
+/* Text: row 0..LCD_ROWS-1, col 0..LCD_COLS-1, text past the row end is dropped */
+void Lcd_clear(void);
+void Lcd_clear_row(uint8_t row);
+void Lcd_goto(uint8_t row, uint8_t col);
+void Lcd_putc(char c);
+void Lcd_puts(const char *str);
+void Lcd_puts_P(const char *str); // string in PROGMEM
+void Lcd_puts_at(uint8_t row, uint8_t col, const char *str);
+
+uint8_t Lcd_sync(void);       // send changed cells, returns bus writes used
+void Lcd_invalidate(void);    // resend every cell on the next sync
+void Lcd_create_char(uint8_t location, const uint8_t *pattern); // CGRAM 0..7, 8 rows
+void Lcd_create_char_P(uint8_t location, const uint8_t *pattern); // pattern in PROGMEM
+void Lcd_command(uint8_t cmd); // raw instruction (queued like everything else)
+void Lcd_flush(void);          // wait until the LCD has executed every queued byte
+uint8_t Lcd_pending(void);     // bytes queued but not sent yet
+
+/* CGRAM bookkeeping for the glyph cache (_lcd_glyph.h) */
+void Lcd_cgram_refs(uint8_t refs[8]);         // cells showing each slot (shadow or panel)
+void Lcd_cgram_replace(uint8_t slot, char c); // shadow cells of slot -> c
+
+const char *Lcd_backend_name(void); // e.g. "parallel 4-bit", for benchmark output
+void Lcd_get_bus_stats(Lcd_bus_stats_t *stats);
+void Lcd_reset_bus_stats(void);
+
+#endif // _LCD_H_
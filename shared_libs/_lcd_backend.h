@@ -0,0 +1,77 @@
+/*
+ * _lcd_backend.h - HD44780 Bus Backend Selection
+ * Educational Version for Assembly→C→Python Learning Progression
+ *
+ * PURPOSE:
+ * _lcd.c is the one character LCD core (shadow DDRAM, queue, glyphs). The
+ * only thing that touches the LCD is a backend:
+ *
+ *   LCD_BUS_BITS             4 or 8 data lines
+ *   LCD_BACKEND_EXEC_US      wait after each byte (0 if the bus is slower)
+ *   static void lcd_backend_init(void);
+ *       Port directions, idle levels, bus clock
+ *   static void lcd_backend_cycle(uint8_t value, uint8_t flags);
+ *       One E cycle: data lines = value bits 7..4 (4-bit) or 7..0 (8-bit)
+ *   static void lcd_backend_byte(uint8_t value, uint8_t flags);
+ *       A whole byte (two cycles in 4-bit mode)
+ *   LCD_BACKEND_BUSY + static uint8_t lcd_backend_busy(void);   (optional)
+ *       Busy flag read, only when R/W is wired
+ *
+ * flags: LCD_WRITE_DATA selects RS = 1 (character / CGRAM data).
+ *
+ * COMPILE-TIME SELECTION (-DLCD_BACKEND=...):
+ *   LCD_BACKEND_PARALLEL       4-bit, any pins (default: board wiring on PORTG)
+ *   LCD_BACKEND_PARALLEL_8BIT  8-bit, any pins (default: D0..D7 = PORTA)
+ *   LCD_BACKEND_PCF8574        4-bit through a PCF8574 I2C expander (TWI)
+ *
+ * Pin maps and expander settings are described in _lcd_parallel.h and
+ * _lcd_pcf8574.h. Backends are headers included by _lcd.c only, so all
+ * pin decisions are made by the compiler and unused backends cost nothing.
+ *
+ * THROUGHPUT (characters/second, 16x2 full redraws, bus waits only):
+ *   PARALLEL        ~17800   (2 E cycles + 50us execution wait per byte)
+ *   PARALLEL_8BIT   ~18500   (1 E cycle  + 50us)
+ *   with R/W wired  ~25000   (busy flag instead of the 50us worst case)
+ *   PCF8574 100kHz   ~2000   (I2C: address + 4 bytes per character)
+ *   PCF8574 400kHz   ~8000   (16MHz boards; TWBR >= 10 limits 7.3728MHz to ~200kHz)
+ * The execution wait dominates a parallel bus: 8-bit mode saves the second
+ * E cycle (~2us), not the wait. CPU time of the driver comes on top;
+ * LCD_Character_Basic menu 5 measures the real number for the selected
+ * backend.
+ */
+
+#ifndef _LCD_BACKEND_H_
+#define _LCD_BACKEND_H_
+
+#define LCD_BACKEND_PARALLEL 0
+#define LCD_BACKEND_PARALLEL_8BIT 1
+#define LCD_BACKEND_PCF8574 2
+
+#ifndef LCD_BACKEND
+#define LCD_BACKEND LCD_BACKEND_PARALLEL
+#endif
+
+// Flags of one bus write
+#define LCD_WRITE_DATA 0x01 // RS = 1
+#define LCD_WRITE_LONG 0x02 // clear or home: 1.52ms execution time
+
+#if LCD_BACKEND == LCD_BACKEND_PARALLEL
+#define LCD_BUS_BITS 4
+#define LCD_BACKEND_NAME "parallel 4-bit"
+#include "_lcd_parallel.h"
+#elif LCD_BACKEND == LCD_BACKEND_PARALLEL_8BIT
+#define LCD_BUS_BITS 8
+#define LCD_BACKEND_NAME "parallel 8-bit"
+#include "_lcd_parallel.h"
+#elif LCD_BACKEND == LCD_BACKEND_PCF8574
+#define LCD_BUS_BITS 4
+#define LCD_BACKEND_NAME "PCF8574 I2C"
+#include "_lcd_pcf8574.h"
+#else
+#error "_lcd_backend.h: unknown LCD_BACKEND"
+#endif
+
+#define LCD_BUS_CYCLES (8 / LCD_BUS_BITS)       // E cycles per byte
+#define LCD_BUS_DL ((LCD_BUS_BITS == 8) ? 0x10 : 0) // function set: DL bit (8-bit interface)
+
+#endif // _LCD_BACKEND_H_
@@ -0,0 +1,182 @@
+/*
+ * _lcd_glyph.c - CGRAM Glyph Cache and Bar Widgets for the HD44780 LCD
+ * Part of Assembly → C → Python Learning Progression
+ *
+ * EDUCATIONAL OBJECTIVES:
+ * 1. Caching: 8 hardware slots shared by any number of glyphs
+ * 2. LRU eviction with reference counts taken from the shadow DDRAM
+ * 3. Bar graphs with sub-cell resolution from one custom glyph per bar
+ */
+
+#include <string.h>
+#include "_lcd_glyph.h"
+
+#define GLYPH_SLOTS 8
+#define GLYPH_CODE(slot) (char)(0x08 | (slot)) // mirror of CGRAM 0..7
+#define GLYPH_BLOCK ((char)0xFF)               // ROM character: all pixels on
+
+static const Glyph_t *glyph_slot[GLYPH_SLOTS]; // glyph held by each slot (0 = unknown)
+static uint8_t glyph_lru[GLYPH_SLOTS] = {0, 1, 2, 3, 4, 5, 6, 7}; // slots, most recent first
+static Glyph_stats_t glyph_stats;
+
+// Horizontal bar: 1..4 of the 5 pixel columns lit, from the left
+static const Glyph_t GLYPH_BAR_H[4] PROGMEM = {
+	{{0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10}, ' '},
+	{{0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18}, ' '},
+	{{0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C}, GLYPH_BLOCK},
+	{{0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E}, GLYPH_BLOCK}};
+
+// Vertical bar: 1..7 of the 8 pixel rows lit, from the bottom
+static const Glyph_t GLYPH_BAR_V[7] PROGMEM = {
+	{{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F}, '_'},
+	{{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F}, '_'},
+	{{0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F}, '_'},
+	{{0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F}, GLYPH_BLOCK},
+	{{0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F}, GLYPH_BLOCK},
+	{{0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F}, GLYPH_BLOCK},
+	{{0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F}, GLYPH_BLOCK}};
+
+void Glyph_reset(void)
+{
+	uint8_t i;
+
+	for (i = 0; i < GLYPH_SLOTS; i++)
+	{
+		glyph_slot[i] = 0;
+		glyph_lru[i] = i;
+	}
+}
+
+// move slot to the front of the LRU list
+static void glyph_touch(uint8_t slot)
+{
+	uint8_t i = 0;
+
+	while (glyph_lru[i] != slot)
+		i++;
+	for (; i > 0; i--)
+		glyph_lru[i] = glyph_lru[i - 1];
+	glyph_lru[0] = slot;
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Look Up or Upload a Glyph
+ *
+ * PURPOSE: Hit: return the slot code. Miss: pick the oldest slot nobody
+ *          references (or, if all are on screen, the oldest slot after
+ *          redrawing its cells with the fallback character) and upload.
+ */
+char Glyph_get(const Glyph_t *glyph)
+{
+	uint8_t refs[GLYPH_SLOTS];
+	uint8_t slot, i;
+
+	for (slot = 0; slot < GLYPH_SLOTS; slot++)
+	{
+		if (glyph_slot[slot] == glyph)
+		{
+			glyph_stats.hits++;
+			glyph_touch(slot);
+			return GLYPH_CODE(slot);
+		}
+	}
+
+	glyph_stats.misses++;
+	Lcd_cgram_refs(refs);
+	slot = glyph_lru[GLYPH_SLOTS - 1];
+	for (i = GLYPH_SLOTS; i > 0; i--)
+	{
+		if (refs[glyph_lru[i - 1]] == 0)
+		{
+			slot = glyph_lru[i - 1];
+			break;
+		}
+	}
+
+	if (glyph_slot[slot])
+		glyph_stats.evictions++;
+	if (refs[slot])
+	{
+		// on screen: replace the cells first, the new pattern would show in them
+		Lcd_cgram_replace(slot, glyph_slot[slot] ? (char)pgm_read_byte(&glyph_slot[slot]->fallback) : ' ');
+		Lcd_sync();
+		glyph_stats.redraws++;
+	}
+
+	Lcd_create_char_P(slot, glyph->rows);
+	glyph_slot[slot] = glyph;
+	glyph_touch(slot);
+	return GLYPH_CODE(slot);
+}
+
+void Glyph_get_stats(Glyph_stats_t *stats)
+{
+	*stats = glyph_stats;
+}
+
+void Glyph_reset_stats(void)
+{
+	memset(&glyph_stats, 0, sizeof(glyph_stats));
+}
+
+// filled steps of a bar with 'steps' steps in total
+static uint16_t glyph_bar_steps(uint16_t value, uint16_t max, uint16_t steps)
+{
+	if (max == 0)
+		return 0;
+	if (value > max)
+		value = max;
+	return (uint16_t)(((uint32_t)value * steps + max / 2) / max);
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Horizontal Bar
+ *
+ * PURPOSE: full cells | one partial cell | empty cells. Only the partial
+ *          cell needs a custom glyph, so a bar uses one CGRAM slot and
+ *          several bars share the four partial glyphs through the cache.
+ */
+void Glyph_bar_horizontal(uint8_t row, uint8_t col, uint8_t width, uint16_t value, uint16_t max)
+{
+	char line[LCD_COLS + 1];
+	uint16_t filled;
+	uint8_t full, partial, i;
+
+	if (width > LCD_COLS)
+		width = LCD_COLS;
+	filled = glyph_bar_steps(value, max, (uint16_t)width * 5);
+	full = filled / 5;
+	partial = filled % 5;
+
+	for (i = 0; i < width; i++)
+		line[i] = (i < full) ? GLYPH_BLOCK : ' ';
+	if (partial)
+		line[full] = Glyph_get(&GLYPH_BAR_H[partial - 1]);
+	line[width] = '\0';
+	Lcd_puts_at(row, col, line);
+}
+
+void Glyph_bar_vertical(uint8_t row, uint8_t col, uint8_t height, uint16_t value, uint16_t max)
+{
+	uint16_t filled;
+	uint8_t full, partial, i;
+	char c;
+
+	if (height > row + 1)
+		height = row + 1;
+	filled = glyph_bar_steps(value, max, (uint16_t)height * 8);
+	full = filled / 8;
+	partial = filled % 8;
+
+	for (i = 0; i < height; i++)
+	{
+		if (i < full)
+			c = GLYPH_BLOCK;
+		else if ((i == full) && partial)
+			c = Glyph_get(&GLYPH_BAR_V[partial - 1]);
+		else
+			c = ' ';
+		Lcd_goto(row - i, col);
+		Lcd_putc(c);
+	}
+}
@@ -0,0 +1,70 @@
+/*
+ * _lcd_glyph.h - CGRAM Glyph Cache and Bar Widgets for the HD44780 LCD
+ * Educational Version for Assembly→C→Python Learning Progression
+ *
+ * PURPOSE:
+ * The HD44780 has only 8 custom characters (CGRAM slots). Instead of
+ * uploading a fixed set with Lcd_create_char() at the start of a screen,
+ * widgets ask the cache for a glyph every time they draw it:
+ *
+ *   Lcd_putc(Glyph_get(&GLYPH_BELL));
+ *
+ * Glyph_get() returns the character code of the slot that holds the glyph.
+ * A hit costs nothing on the bus; a miss uploads the 8 rows into a slot
+ * (9 bus writes).
+ *
+ * EVICTION:
+ * - Reference count: the number of cells on the LCD (or pending in the
+ *   shadow) that show a slot, from Lcd_cgram_refs().
+ * - A miss takes the least recently used slot with no references, so
+ *   nothing on screen changes.
+ * - If all 8 slots are on screen, the least recently used one is taken
+ *   anyway. Its cells are redrawn first with the glyph's fallback
+ *   character and synced, then the new pattern is uploaded.
+ *
+ * CHARACTER CODES:
+ * Slots are returned as codes 8..15 (the HD44780 mirrors 0..7 there), so
+ * they also work inside strings. Use the code at once: a later
+ * Glyph_get() may reuse a slot that no cell references yet.
+ *
+ * Do not mix with Lcd_create_char() - or call Glyph_reset() afterwards.
+ * Call Glyph_reset() after Lcd_init().
+ */
+
+#ifndef _LCD_GLYPH_H_
+#define _LCD_GLYPH_H_
+
+#include <stdint.h>
+#include <avr/pgmspace.h>
+#include "_lcd.h"
+
+// One 5x8 custom character, stored in PROGMEM; its address is its ID
+typedef struct
+{
+	uint8_t rows[8]; // top to bottom, bits 4..0 = pixels left to right
+	char fallback;   // ROM character used when the glyph must leave CGRAM
+} Glyph_t;
+
+typedef struct
+{
+	unsigned int hits;
+	unsigned int misses;    // uploads
+	unsigned int evictions; // uploads that replaced another glyph
+	unsigned int redraws;   // evictions of a glyph that was on screen
+} Glyph_stats_t;
+
+void Glyph_reset(void);
+char Glyph_get(const Glyph_t *glyph);
+void Glyph_get_stats(Glyph_stats_t *stats);
+void Glyph_reset_stats(void);
+
+/*
+ * Bar widgets (value 0..max, one custom glyph per bar at most)
+ *   Horizontal: width cells from (row, col) to the right, 5 steps per cell
+ *   Vertical:   height cells from (row, col) upwards, 8 steps per cell
+ * Full cells use the ROM block (0xFF), empty cells a space.
+ */
+void Glyph_bar_horizontal(uint8_t row, uint8_t col, uint8_t width, uint16_t value, uint16_t max);
+void Glyph_bar_vertical(uint8_t row, uint8_t col, uint8_t height, uint16_t value, uint16_t max);
+
+#endif // _LCD_GLYPH_H_
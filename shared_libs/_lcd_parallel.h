@@ -0,0 +1,205 @@
+/*
+ * _lcd_parallel.h - HD44780 Parallel Bus Backend (4-bit or 8-bit, any pins)
+ * Educational Version for Assembly→C→Python Learning Progression
+ *
+ * Included by _lcd.c through _lcd_backend.h - do not include elsewhere.
+ *
+ * PIN MAP:
+ * Every signal is "port letter, bit", e.g. -DLCD_PIN_E=B,4 or in a header
+ * included before _lcd.c. Define all pins or none.
+ *
+ *   signal   4-bit default   8-bit default
+ *   RS       G, 0            G, 0
+ *   E        G, 1            G, 1
+ *   RW       (tied to GND)   (tied to GND)   define LCD_PIN_RW to poll BF
+ *   D0..D3   -               A, 0..A, 3
+ *   D4..D7   G, 2..G, 5      A, 4..A, 7
+ *
+ * FAST PATH:
+ * When the data pins are neighbouring bits of one port, the compiler
+ * reduces the data write to one port write (8-bit on bit 0: PORTx = value)
+ * or one masked write (4-bit). Otherwise each data pin is set on its own.
+ * The test is a constant expression, so only one path is compiled in.
+ */
+
+#ifndef _LCD_PARALLEL_H_
+#define _LCD_PARALLEL_H_
+
+#include <avr/io.h>
+#include <util/delay.h>
+
+#ifndef LCD_PIN_RS
+#define LCD_PIN_RS G, 0 // Register Select (0=Command, 1=Data)
+#define LCD_PIN_E G, 1  // Enable
+#if LCD_BUS_BITS == 8
+#define LCD_PIN_D0 A, 0
+#define LCD_PIN_D1 A, 1
+#define LCD_PIN_D2 A, 2
+#define LCD_PIN_D3 A, 3
+#define LCD_PIN_D4 A, 4
+#define LCD_PIN_D5 A, 5
+#define LCD_PIN_D6 A, 6
+#define LCD_PIN_D7 A, 7
+#else
+#define LCD_PIN_D4 G, 2
+#define LCD_PIN_D5 G, 3
+#define LCD_PIN_D6 G, 4
+#define LCD_PIN_D7 G, 5
+#endif
+#endif
+
+#define LCD_BACKEND_EXEC_US 50 // execution time of one instruction or character (37us + margin)
+
+// "port, bit" -> register or bit number; variadic, because a pin macro
+// passed through another macro arrives already split into two arguments
+#define LCD_OUT(...) LCD_OUT_(__VA_ARGS__)
+#define LCD_OUT_(port, bit) PORT##port
+#define LCD_DDR(...) LCD_DDR_(__VA_ARGS__)
+#define LCD_DDR_(port, bit) DDR##port
+#define LCD_IN(...) LCD_IN_(__VA_ARGS__)
+#define LCD_IN_(port, bit) PIN##port
+#define LCD_BIT(...) LCD_BIT_(__VA_ARGS__)
+#define LCD_BIT_(port, bit) (bit)
+
+#define LCD_SET(...) (LCD_OUT(__VA_ARGS__) |= (1 << LCD_BIT(__VA_ARGS__)))
+#define LCD_CLR(...) (LCD_OUT(__VA_ARGS__) &= ~(1 << LCD_BIT(__VA_ARGS__)))
+#define LCD_PUT(pin, on) ((on) ? LCD_SET(pin) : LCD_CLR(pin))
+#define LCD_DIR(pin, out) ((out) ? (LCD_DDR(pin) |= (1 << LCD_BIT(pin))) : (LCD_DDR(pin) &= ~(1 << LCD_BIT(pin))))
+
+// pin b sits directly above pin a on the same port
+#define LCD_NEXT(a, b) ((&LCD_OUT(a) == &LCD_OUT(b)) && (LCD_BIT(b) == LCD_BIT(a) + 1))
+
+#if LCD_BUS_BITS == 8
+#define LCD_PIN_DLOW LCD_PIN_D0 // lowest data line
+#define LCD_DATA_SHIFT 0        // value bit of the lowest data line
+#define LCD_DATA_CONTIGUOUS                                                                          \
+	(LCD_NEXT(LCD_PIN_D0, LCD_PIN_D1) && LCD_NEXT(LCD_PIN_D1, LCD_PIN_D2) &&                         \
+	 LCD_NEXT(LCD_PIN_D2, LCD_PIN_D3) && LCD_NEXT(LCD_PIN_D3, LCD_PIN_D4) &&                         \
+	 LCD_NEXT(LCD_PIN_D4, LCD_PIN_D5) && LCD_NEXT(LCD_PIN_D5, LCD_PIN_D6) && LCD_NEXT(LCD_PIN_D6, LCD_PIN_D7))
+#define LCD_DATA_MASK 0xFF
+#else
+#define LCD_PIN_DLOW LCD_PIN_D4
+#define LCD_DATA_SHIFT 4
+#define LCD_DATA_CONTIGUOUS \
+	(LCD_NEXT(LCD_PIN_D4, LCD_PIN_D5) && LCD_NEXT(LCD_PIN_D5, LCD_PIN_D6) && LCD_NEXT(LCD_PIN_D6, LCD_PIN_D7))
+#define LCD_DATA_MASK 0x0F
+#endif
+
+// data lines <- value bits 7..4 (4-bit) or 7..0 (8-bit)
+static inline void lcd_backend_data(uint8_t value)
+{
+	if (LCD_DATA_CONTIGUOUS)
+	{
+		if ((LCD_BUS_BITS == 8) && (LCD_BIT(LCD_PIN_DLOW) == 0))
+		{
+			LCD_OUT(LCD_PIN_DLOW) = value; // whole port, no read-modify-write
+		}
+		else
+		{
+			LCD_OUT(LCD_PIN_DLOW) = (LCD_OUT(LCD_PIN_DLOW) & ~(LCD_DATA_MASK << LCD_BIT(LCD_PIN_DLOW))) |
+									(((value >> LCD_DATA_SHIFT) & LCD_DATA_MASK) << LCD_BIT(LCD_PIN_DLOW));
+		}
+		return;
+	}
+#if LCD_BUS_BITS == 8
+	LCD_PUT(LCD_PIN_D0, value & 0x01);
+	LCD_PUT(LCD_PIN_D1, value & 0x02);
+	LCD_PUT(LCD_PIN_D2, value & 0x04);
+	LCD_PUT(LCD_PIN_D3, value & 0x08);
+#endif
+	LCD_PUT(LCD_PIN_D4, value & 0x10);
+	LCD_PUT(LCD_PIN_D5, value & 0x20);
+	LCD_PUT(LCD_PIN_D6, value & 0x40);
+	LCD_PUT(LCD_PIN_D7, value & 0x80);
+}
+
+// data lines as outputs (1) or inputs without pull-ups (0)
+static inline void lcd_backend_data_dir(uint8_t output)
+{
+	if (LCD_DATA_CONTIGUOUS)
+	{
+		if (output)
+			LCD_DDR(LCD_PIN_DLOW) |= (LCD_DATA_MASK << LCD_BIT(LCD_PIN_DLOW));
+		else
+			LCD_DDR(LCD_PIN_DLOW) &= (uint8_t)~(LCD_DATA_MASK << LCD_BIT(LCD_PIN_DLOW));
+		return;
+	}
+#if LCD_BUS_BITS == 8
+	LCD_DIR(LCD_PIN_D0, output);
+	LCD_DIR(LCD_PIN_D1, output);
+	LCD_DIR(LCD_PIN_D2, output);
+	LCD_DIR(LCD_PIN_D3, output);
+#endif
+	LCD_DIR(LCD_PIN_D4, output);
+	LCD_DIR(LCD_PIN_D5, output);
+	LCD_DIR(LCD_PIN_D6, output);
+	LCD_DIR(LCD_PIN_D7, output);
+}
+
+static void lcd_backend_init(void)
+{
+	LCD_DIR(LCD_PIN_RS, 1);
+	LCD_DIR(LCD_PIN_E, 1);
+	LCD_CLR(LCD_PIN_RS);
+	LCD_CLR(LCD_PIN_E);
+#ifdef LCD_PIN_RW
+	LCD_DIR(LCD_PIN_RW, 1);
+	LCD_CLR(LCD_PIN_RW);
+#endif
+	lcd_backend_data_dir(1);
+}
+
+static void lcd_backend_cycle(uint8_t value, uint8_t flags)
+{
+	LCD_PUT(LCD_PIN_RS, flags & LCD_WRITE_DATA);
+	lcd_backend_data(value);
+	LCD_SET(LCD_PIN_E);
+	_delay_us(1); // E pulse width >= 450ns
+	LCD_CLR(LCD_PIN_E);
+}
+
+static void lcd_backend_byte(uint8_t value, uint8_t flags)
+{
+	lcd_backend_cycle(value, flags);
+#if LCD_BUS_BITS == 4
+	_delay_us(1); // E cycle >= 1000ns
+	lcd_backend_cycle(value << 4, flags);
+#endif
+}
+
+#ifdef LCD_PIN_RW
+#define LCD_BACKEND_BUSY
+/*
+ * EDUCATIONAL FUNCTION: Read the Busy Flag
+ *
+ * PURPOSE: RS = 0, R/W = 1 reads BF (D7) and the address counter. In
+ *          4-bit mode both nibbles must be clocked out; only BF is used.
+ *          The LCD is usually ready long before the datasheet worst case.
+ */
+static uint8_t lcd_backend_busy(void)
+{
+	uint8_t busy;
+
+	lcd_backend_data_dir(0);
+	lcd_backend_data(0x00); // no pull-ups
+	LCD_CLR(LCD_PIN_RS);
+	LCD_SET(LCD_PIN_RW);
+
+	LCD_SET(LCD_PIN_E);
+	_delay_us(1); // data output delay <= 360ns
+	busy = LCD_IN(LCD_PIN_D7) & (1 << LCD_BIT(LCD_PIN_D7));
+	LCD_CLR(LCD_PIN_E);
+#if LCD_BUS_BITS == 4
+	_delay_us(1);
+	LCD_SET(LCD_PIN_E); // second nibble: address counter bits 3..0
+	_delay_us(1);
+	LCD_CLR(LCD_PIN_E);
+#endif
+
+	LCD_CLR(LCD_PIN_RW);
+	lcd_backend_data_dir(1);
+	return busy;
+}
+#endif
+
+#endif // _LCD_PARALLEL_H_
@@ -0,0 +1,117 @@
+/*
+ * _lcd_pcf8574.h - HD44780 Backend through a PCF8574 I2C Port Expander
+ * Educational Version for Assembly→C→Python Learning Progression
+ *
+ * Included by _lcd.c through _lcd_backend.h - do not include elsewhere.
+ *
+ * WIRING (common "I2C LCD backpack", SimulIDE Soft_LCD-I2C):
+ * ATmega128 SCL = PD0, SDA = PD1 (TWI) -> PCF8574 -> LCD in 4-bit mode
+ *   P0 RS   P1 RW (held low)   P2 E   P3 backlight   P4..P7 D4..D7
+ *
+ * SETTINGS:
+ *   LCD_I2C_ADDR   7-bit address (PCF8574: 0x20..0x27, PCF8574A: 0x38..0x3F)
+ *   LCD_I2C_HZ     SCL clock, 100kHz by default (PCF8574 maximum)
+ *
+ * COST:
+ * Every E edge is a full expander write, so a character is one I2C frame
+ * of address + 4 bytes (E high/low per nibble), ~500us at 100kHz. The
+ * frame is slower than the LCD, so no execution wait is added.
+ * Not usable with LCD_ASYNC (each frame would run inside the timer ISR).
+ */
+
+#ifndef _LCD_PCF8574_H_
+#define _LCD_PCF8574_H_
+
+#include <avr/io.h>
+#include <util/twi.h>
+
+#ifndef LCD_I2C_ADDR
+#define LCD_I2C_ADDR 0x27
+#endif
+#ifndef LCD_I2C_HZ
+#define LCD_I2C_HZ 100000UL
+#endif
+
+#if LCD_ASYNC
+#error "_lcd_pcf8574.h: the I2C backend cannot be used with LCD_ASYNC"
+#endif
+
+// Expander bits
+#define LCD_PCF_RS 0x01
+#define LCD_PCF_E 0x04
+#define LCD_PCF_BACKLIGHT 0x08
+
+#define LCD_BACKEND_EXEC_US 0 // an I2C frame takes longer than any instruction but clear/home
+
+// SCL = F_CPU / (16 + 2 * TWBR), prescaler 1
+#define LCD_TWBR (((F_CPU) / (LCD_I2C_HZ) - 16) / 2)
+typedef char lcd_i2c_twbr_must_be_10_to_255[(LCD_TWBR >= 10 && LCD_TWBR <= 255) ? 1 : -1];
+
+static void lcd_twi_wait(void)
+{
+	while (!(TWCR & (1 << TWINT)))
+		;
+}
+
+// START + address; returns 0 if no expander answered (frame is dropped)
+static uint8_t lcd_twi_begin(void)
+{
+	TWCR = (1 << TWINT) | (1 << TWSTA) | (1 << TWEN);
+	lcd_twi_wait();
+	TWDR = (LCD_I2C_ADDR << 1) | TW_WRITE;
+	TWCR = (1 << TWINT) | (1 << TWEN);
+	lcd_twi_wait();
+	return TW_STATUS == TW_MT_SLA_ACK;
+}
+
+static void lcd_twi_write(uint8_t data)
+{
+	TWDR = data;
+	TWCR = (1 << TWINT) | (1 << TWEN);
+	lcd_twi_wait();
+}
+
+static void lcd_twi_end(void)
+{
+	TWCR = (1 << TWINT) | (1 << TWSTO) | (1 << TWEN);
+	while (TWCR & (1 << TWSTO))
+		;
+}
+
+// one nibble (bits 7..4 of value): E high, then E low latches it
+static void lcd_pcf_nibble(uint8_t value, uint8_t flags)
+{
+	uint8_t bits = (value & 0xF0) | LCD_PCF_BACKLIGHT | ((flags & LCD_WRITE_DATA) ? LCD_PCF_RS : 0);
+
+	lcd_twi_write(bits | LCD_PCF_E);
+	lcd_twi_write(bits);
+}
+
+static void lcd_backend_init(void)
+{
+	TWSR = 0; // prescaler 1
+	TWBR = LCD_TWBR;
+	if (lcd_twi_begin())
+		lcd_twi_write(LCD_PCF_BACKLIGHT); // all LCD lines low, backlight on
+	lcd_twi_end();
+}
+
+static void lcd_backend_cycle(uint8_t value, uint8_t flags)
+{
+	if (lcd_twi_begin())
+		lcd_pcf_nibble(value, flags);
+	lcd_twi_end();
+}
+
+// both nibbles in one frame: address + 4 bytes
+static void lcd_backend_byte(uint8_t value, uint8_t flags)
+{
+	if (lcd_twi_begin())
+	{
+		lcd_pcf_nibble(value, flags);
+		lcd_pcf_nibble(value << 4, flags);
+	}
+	lcd_twi_end();
+}
+
+#endif // _LCD_PCF8574_H_
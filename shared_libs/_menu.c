@@ -0,0 +1,457 @@
+/*
+ * _menu.c - PROGMEM Menu Engine with Incremental Redraw
+ * Part of Assembly → C → Python Learning Progression
+ *
+ * EDUCATIONAL OBJECTIVES:
+ * 1. Describe a user interface as constant data (tables in flash)
+ * 2. Read structures and strings from PROGMEM (memcpy_P, pgm_read_byte)
+ * 3. Separate input devices, navigation logic and output devices
+ * 4. Redraw only what changed by remembering what each screen shows
+ *
+ * RAM:
+ * Path stack 3 bytes per level, the current page record, and per display
+ * a pointer, a window position and one byte per line: about 50 bytes
+ * with the defaults, however large the tree is. A RAM array of label pointers
+ * alone costs 2 bytes per item, and the strings themselves one byte per
+ * character, in every project that hand-codes its menu.
+ */
+
+#include <avr/io.h>
+#include <avr/pgmspace.h>
+#include <string.h>
+#include "_menu.h"
+#include "_event.h"
+#include "_keypad.h"
+
+#ifdef MENU_LCD_ENABLED
+#include "_lcd.h"
+#endif
+#ifdef MENU_GLCD_ENABLED
+#include "_glcd.h"
+#endif
+#ifdef MENU_UART_ENABLED
+#include "_uart.h"
+#endif
+
+#define MENU_SHOWN_BLANK 0x7F   // line shows nothing (past the last item)
+#define MENU_SHOWN_UNKNOWN 0xFF // line must be drawn
+#define MENU_SHOWN_SELECTED 0x80
+
+typedef char menu_rows_fit[(MENU_UART_ROWS <= MENU_MAX_ROWS && MENU_UART_COLS <= MENU_MAX_COLS) ? 1 : -1];
+
+/*
+ * What One Display Shows
+ */
+typedef struct
+{
+	const Menu_display_t *display;
+	uint8_t top;                  // first item in the window
+	uint8_t shown[MENU_MAX_ROWS]; // item | MENU_SHOWN_SELECTED, or MENU_SHOWN_*
+} menu_view_t;
+
+static const Menu_page_t *menu_path[MENU_MAX_DEPTH + 1]; // [0] = root
+static uint8_t menu_path_selected[MENU_MAX_DEPTH + 1];
+static uint8_t menu_level;
+
+static Menu_page_t menu_current; // copied from PROGMEM
+static uint8_t menu_sel;
+
+static menu_view_t menu_views[MENU_MAX_DISPLAYS];
+static uint8_t menu_view_count;
+static uint16_t menu_lines;
+
+/*
+ * EDUCATIONAL FUNCTION: Compose One Line
+ *
+ * PURPOSE: Marker, label straight from flash, '/' after a submenu label,
+ *          padded with spaces to the full width so old text disappears
+ *          without a separate clear.
+ */
+static void menu_compose(char *buf, uint8_t cols, const char *label_P, char marker, uint8_t submenu)
+{
+	uint8_t n = 0;
+	char c;
+
+	if (marker)
+	{
+		buf[n++] = marker;
+	}
+	while (n < cols && (c = pgm_read_byte(label_P++)) != '\0')
+	{
+		buf[n++] = c;
+	}
+	if (submenu && n < cols)
+	{
+		buf[n++] = '/';
+	}
+	while (n < cols)
+	{
+		buf[n++] = ' ';
+	}
+	buf[n] = '\0';
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Bring One Display Up to Date
+ *
+ * PURPOSE: Move the window so the selection is visible, then compare
+ *          what every line should show with what it shows and call
+ *          line() only for the differences.
+ */
+static void menu_update_view(menu_view_t *v)
+{
+	const Menu_display_t *d = v->display;
+	uint8_t lines = d->rows - d->title;
+	uint8_t row, item, want;
+	char buf[MENU_MAX_COLS + 1];
+	Menu_item_t entry;
+
+	if (menu_sel < v->top)
+	{
+		v->top = menu_sel;
+	}
+	else if (menu_sel >= v->top + lines)
+	{
+		v->top = menu_sel - lines + 1;
+	}
+
+	if (d->title && v->shown[0] == MENU_SHOWN_UNKNOWN)
+	{
+		menu_compose(buf, d->cols, menu_current.title, 0, 0);
+		d->line(0, buf, 0);
+		v->shown[0] = 0;
+		menu_lines++;
+	}
+
+	for (row = 0; row < lines; row++)
+	{
+		item = v->top + row;
+		if (item >= menu_current.count)
+			want = MENU_SHOWN_BLANK;
+		else
+			want = item | ((item == menu_sel) ? MENU_SHOWN_SELECTED : 0);
+
+		if (v->shown[d->title + row] == want)
+			continue;
+
+		if (want == MENU_SHOWN_BLANK)
+		{
+			memset(buf, ' ', d->cols);
+			buf[d->cols] = '\0';
+		}
+		else
+		{
+			memcpy_P(&entry, &menu_current.items[item], sizeof(entry));
+			menu_compose(buf, d->cols, entry.label, (want & MENU_SHOWN_SELECTED) ? '>' : ' ', entry.child != 0);
+		}
+		d->line(d->title + row, buf, want != MENU_SHOWN_BLANK && (want & MENU_SHOWN_SELECTED));
+		v->shown[d->title + row] = want;
+		menu_lines++;
+	}
+
+	if (d->end)
+		d->end();
+}
+
+// forget what a display shows: the next update draws every line
+static void menu_invalidate(menu_view_t *v)
+{
+	memset(v->shown, MENU_SHOWN_UNKNOWN, sizeof(v->shown));
+	if (v->display->begin)
+		v->display->begin();
+}
+
+static void menu_update_all(uint8_t full)
+{
+	uint8_t i;
+
+	for (i = 0; i < menu_view_count; i++)
+	{
+		if (full)
+		{
+			menu_views[i].top = 0;
+			menu_invalidate(&menu_views[i]);
+		}
+		menu_update_view(&menu_views[i]);
+	}
+}
+
+// make path[level] the current page with the given selection
+static void menu_open(uint8_t selected)
+{
+	memcpy_P(&menu_current, menu_path[menu_level], sizeof(menu_current));
+	menu_sel = (selected < menu_current.count) ? selected : 0;
+	menu_update_all(1);
+}
+
+void Menu_init(const Menu_page_t *root)
+{
+	menu_level = 0;
+	menu_path[0] = root;
+	menu_view_count = 0;
+	menu_lines = 0;
+	menu_open(0);
+}
+
+uint8_t Menu_attach(const Menu_display_t *display)
+{
+	menu_view_t *v;
+
+	if (menu_view_count >= MENU_MAX_DISPLAYS || display->rows > MENU_MAX_ROWS ||
+		display->cols > MENU_MAX_COLS || display->rows <= display->title)
+		return 0;
+
+	v = &menu_views[menu_view_count++];
+	v->display = display;
+	v->top = 0;
+	menu_invalidate(v);
+	menu_update_view(v);
+	return 1;
+}
+
+void Menu_redraw(void)
+{
+	uint8_t i;
+
+	for (i = 0; i < menu_view_count; i++)
+	{
+		menu_invalidate(&menu_views[i]);
+		menu_update_view(&menu_views[i]);
+	}
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Navigation
+ *
+ * PURPOSE: Up/down wrap around, enter opens a submenu or runs an action,
+ *          back returns to the parent with its old selection. Only
+ *          opening or leaving a page forces a full redraw.
+ */
+uint8_t Menu_input(uint8_t key)
+{
+	Menu_item_t entry;
+
+	if (key >= MENU_KEY_ITEM)
+	{
+		if (key - MENU_KEY_ITEM >= menu_current.count)
+			return MENU_NONE;
+		menu_sel = key - MENU_KEY_ITEM; // every enter outcome redraws
+		key = MENU_KEY_ENTER;
+	}
+
+	switch (key)
+	{
+	case MENU_KEY_UP:
+		menu_sel = (menu_sel ? menu_sel : menu_current.count) - 1;
+		menu_update_all(0);
+		return MENU_MOVED;
+
+	case MENU_KEY_DOWN:
+		menu_sel = (menu_sel + 1 < menu_current.count) ? menu_sel + 1 : 0;
+		menu_update_all(0);
+		return MENU_MOVED;
+
+	case MENU_KEY_ENTER:
+		memcpy_P(&entry, &menu_current.items[menu_sel], sizeof(entry));
+		if (entry.child)
+		{
+			if (menu_level >= MENU_MAX_DEPTH)
+				return MENU_NONE;
+			menu_path_selected[menu_level] = menu_sel;
+			menu_path[++menu_level] = entry.child;
+			menu_open(0);
+			return MENU_OPENED;
+		}
+		if (entry.action)
+		{
+			entry.action();
+			Menu_redraw(); // the action may have used the screens
+			return MENU_ACTION;
+		}
+		// an item without child and action is "back"
+		// fall through
+
+	case MENU_KEY_BACK:
+		if (menu_level == 0)
+			return MENU_EXIT;
+		menu_level--;
+		menu_open(menu_path_selected[menu_level]);
+		return MENU_OPENED;
+	}
+	return MENU_NONE;
+}
+
+uint8_t Menu_selected(void)
+{
+	return menu_sel;
+}
+
+uint8_t Menu_depth(void)
+{
+	return menu_level;
+}
+
+const Menu_page_t *Menu_page(void)
+{
+	return menu_path[menu_level];
+}
+
+uint16_t Menu_lines_drawn(void)
+{
+	return menu_lines;
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Input Mappers
+ *
+ * PURPOSE: Each device keeps its own conventions; the engine only sees
+ *          MENU_KEY_* values.
+ */
+uint8_t Menu_key_uart(char c)
+{
+	static char last;
+	char prev = last;
+
+	last = c;
+	if (c >= '1' && c <= '9')
+		return MENU_KEY_ITEM + (c - '1');
+
+	switch (c)
+	{
+	case 'w':
+	case 'W':
+		return MENU_KEY_UP;
+	case 's':
+	case 'S':
+		return MENU_KEY_DOWN;
+	case '\n':
+		if (prev == '\r') // CR LF terminals: one enter
+			return MENU_KEY_NONE;
+		return MENU_KEY_ENTER;
+	case '\r':
+	case 'd':
+	case 'D':
+		return MENU_KEY_ENTER;
+	case 'a':
+	case 'A':
+	case 'q':
+	case 'Q':
+	case 0x1B: // Esc
+	case 0x08: // Backspace
+	case 0x7F: // Delete (Backspace on many terminals)
+		return MENU_KEY_BACK;
+	}
+	return MENU_KEY_NONE;
+}
+
+uint8_t Menu_key_keypad(char key, uint8_t type)
+{
+	if (type == KEYPAD_REPEAT)
+	{
+		// holding up/down scrolls, nothing else repeats
+		if (key == 'A')
+			return MENU_KEY_UP;
+		if (key == 'B')
+			return MENU_KEY_DOWN;
+		return MENU_KEY_NONE;
+	}
+	if (type != KEYPAD_PRESS)
+		return MENU_KEY_NONE;
+
+	if (key >= '1' && key <= '9')
+		return MENU_KEY_ITEM + (key - '1');
+	switch (key)
+	{
+	case 'A':
+		return MENU_KEY_UP;
+	case 'B':
+		return MENU_KEY_DOWN;
+	case '#':
+		return MENU_KEY_ENTER;
+	case '*':
+		return MENU_KEY_BACK;
+	}
+	return MENU_KEY_NONE;
+}
+
+uint8_t Menu_key_joystick(int8_t x, int8_t y)
+{
+	static uint8_t armed = 1;
+	uint8_t ax = (x < 0) ? -x : x;
+	uint8_t ay = (y < 0) ? -y : y;
+
+	// one key per deflection: return to the center before the next one
+	if (ax < MENU_JOYSTICK_RELEASE && ay < MENU_JOYSTICK_RELEASE)
+	{
+		armed = 1;
+		return MENU_KEY_NONE;
+	}
+	if (!armed || (ax < MENU_JOYSTICK_THRESHOLD && ay < MENU_JOYSTICK_THRESHOLD))
+		return MENU_KEY_NONE;
+
+	armed = 0;
+	if (ay >= ax)
+		return (y > 0) ? MENU_KEY_UP : MENU_KEY_DOWN;
+	return (x > 0) ? MENU_KEY_ENTER : MENU_KEY_BACK;
+}
+
+uint8_t Menu_key_event(uint8_t type, uint16_t data)
+{
+	if (type == EVENT_UART_RX)
+		return Menu_key_uart((char)data);
+	if (type == EVENT_KEYPAD)
+		return Menu_key_keypad((char)(data & 0xFF), data >> 8);
+	return MENU_KEY_NONE;
+}
+
+/*
+ * Display Targets
+ */
+#ifdef MENU_LCD_ENABLED
+static void menu_lcd_line(uint8_t row, const char *text, uint8_t selected)
+{
+	(void)selected; // the '>' marker is the highlight
+	Lcd_puts_at(row, 0, text);
+}
+
+static void menu_lcd_end(void)
+{
+	Lcd_sync(); // no-op unless LCD_RENDER_DEFERRED left cells pending
+}
+
+const Menu_display_t Menu_lcd = {LCD_ROWS, LCD_COLS, LCD_ROWS > 2, 0, menu_lcd_line, menu_lcd_end};
+#endif
+
+#ifdef MENU_GLCD_ENABLED
+#define MENU_GLCD_COLS 20 // 6 pixel cells from column 4, as lcd_xy()
+
+static void menu_glcd_line(uint8_t row, const char *text, uint8_t selected)
+{
+	lcd_string(row, 0, (char *)text);
+	if (selected)
+		GLCD_Fill_rectangle(row * 8, 4, row * 8 + 7, 4 + MENU_GLCD_COLS * 6 - 1, RASTER_XOR);
+}
+
+const Menu_display_t Menu_glcd = {8, MENU_GLCD_COLS, 1, lcd_clear, menu_glcd_line, GLCD_Flush};
+#endif
+
+#ifdef MENU_UART_ENABLED
+static void menu_uart_begin(void)
+{
+	puts_USART1("\033[2J"); // clear screen (VT100)
+}
+
+static void menu_uart_line(uint8_t row, const char *text, uint8_t selected)
+{
+	row++; // VT100 rows start at 1
+	puts_USART1("\033[");
+	if (row >= 10)
+		putch_USART1('0' + row / 10);
+	putch_USART1('0' + row % 10);
+	puts_USART1(selected ? ";1H\033[7m" : ";1H");
+	puts_USART1((char *)text);
+	puts_USART1(selected ? "\033[0m\033[K" : "\033[K");
+}
+
+const Menu_display_t Menu_uart = {MENU_UART_ROWS, MENU_UART_COLS, 1, menu_uart_begin, menu_uart_line, 0};
+#endif
@@ -0,0 +1,159 @@
+/*
+ * _menu.h - PROGMEM Menu Engine with Incremental Redraw
+ * Educational Version for Assembly→C→Python Learning Progression
+ *
+ * PURPOSE:
+ * One menu engine instead of a hand-written menu in every project. The
+ * whole tree (titles, labels, submenus, callbacks) is a set of constant
+ * tables in flash; the engine keeps only the current path and a few bytes
+ * per display in RAM.
+ *
+ *   static const char s_main[] PROGMEM = "Main";
+ *   static const char s_leds[] PROGMEM = "LEDs on";
+ *   static const char s_exit[] PROGMEM = "Exit";
+ *   static const Menu_item_t main_items[] PROGMEM = {
+ *       {s_leds, 0, leds_on},          // action
+ *       {s_setup, &setup_page, 0},     // submenu
+ *       {s_exit, 0, 0},                // neither: back (exit at the root)
+ *   };
+ *   static const Menu_page_t main_page PROGMEM = {s_main, main_items, MENU_COUNT(main_items)};
+ *
+ *   Menu_init(&main_page);
+ *   Menu_attach(&Menu_lcd);                        // draw on the LCD ...
+ *   Menu_attach(&Menu_uart);                       // ... and mirror to a terminal
+ *   while (Menu_input(Menu_key_uart(getch_USART1())) != MENU_EXIT)
+ *       ;
+ *
+ * INPUT:
+ * Menu_input() takes abstract keys (up, down, enter, back, "item n").
+ * Small mappers turn keypad events, joystick positions, UART characters
+ * or event bus records (_event.h) into these keys, so the same tree works
+ * with any input device.
+ *
+ * INCREMENTAL REDRAW:
+ * Each attached display remembers which item, and whether it was
+ * selected, it last drew on every line. Moving the selection redraws the
+ * two lines that changed (old and new selection), not the whole screen;
+ * only opening a page, scrolling the window or Menu_redraw() rewrite
+ * every line. The character LCD's shadow DDRAM then sends only the cells
+ * that differ inside those lines.
+ *
+ * DISPLAYS (build flags, link the matching driver):
+ *   -DMENU_LCD_ENABLED   Menu_lcd   character LCD (_lcd.c), title line if LCD_ROWS > 2
+ *   -DMENU_GLCD_ENABLED  Menu_glcd  KS0108 (_glcd.c), 8 lines, selection inverted
+ *   -DMENU_UART_ENABLED  Menu_uart  VT100 terminal (_uart.c), selection in reverse video
+ * Other devices: fill in a Menu_display_t with a line() callback.
+ */
+
+#ifndef _MENU_H_
+#define _MENU_H_
+
+#include <stdint.h>
+
+#ifndef MENU_MAX_DEPTH
+#define MENU_MAX_DEPTH 4 // submenu levels below the root
+#endif
+#ifndef MENU_MAX_DISPLAYS
+#define MENU_MAX_DISPLAYS 2
+#endif
+#ifndef MENU_MAX_ROWS
+#define MENU_MAX_ROWS 10 // lines per display, title included
+#endif
+#ifndef MENU_MAX_COLS
+#define MENU_MAX_COLS 24 // characters per line
+#endif
+#ifndef MENU_UART_ROWS
+#define MENU_UART_ROWS 10
+#endif
+#ifndef MENU_UART_COLS
+#define MENU_UART_COLS 24
+#endif
+#ifndef MENU_JOYSTICK_THRESHOLD
+#define MENU_JOYSTICK_THRESHOLD 80 // of 127: deflection that counts as a key
+#endif
+#ifndef MENU_JOYSTICK_RELEASE
+#define MENU_JOYSTICK_RELEASE 32 // back inside this before the next key
+#endif
+
+#define MENU_COUNT(items) (sizeof(items) / sizeof((items)[0]))
+
+/*
+ * Menu Tree (all in PROGMEM)
+ */
+typedef struct Menu_page Menu_page_t;
+
+typedef struct
+{
+	const char *label;        // PROGMEM string
+	const Menu_page_t *child; // submenu, or 0
+	void (*action)(void);     // called on enter, or 0 (no child either: back)
+} Menu_item_t;
+
+struct Menu_page
+{
+	const char *title;        // PROGMEM string
+	const Menu_item_t *items; // PROGMEM array
+	uint8_t count;            // 1..127
+};
+
+/*
+ * Display Target
+ * line() receives a full line of exactly cols characters (padded).
+ */
+typedef struct
+{
+	uint8_t rows;        // lines, including the title line
+	uint8_t cols;        // characters per line (<= MENU_MAX_COLS)
+	uint8_t title;       // 1 = first line shows the page title
+	void (*begin)(void); // optional: clear the screen before a full redraw
+	void (*line)(uint8_t row, const char *text, uint8_t selected);
+	void (*end)(void);   // optional: after each update (flush, sync)
+} Menu_display_t;
+
+#ifdef MENU_LCD_ENABLED
+extern const Menu_display_t Menu_lcd;
+#endif
+#ifdef MENU_GLCD_ENABLED
+extern const Menu_display_t Menu_glcd;
+#endif
+#ifdef MENU_UART_ENABLED
+extern const Menu_display_t Menu_uart;
+#endif
+
+/*
+ * Keys (Menu_input) and Results
+ */
+#define MENU_KEY_NONE 0
+#define MENU_KEY_UP 1
+#define MENU_KEY_DOWN 2
+#define MENU_KEY_ENTER 3
+#define MENU_KEY_BACK 4
+#define MENU_KEY_ITEM 0x10 // + index: select and enter item directly
+
+#define MENU_NONE 0   // key ignored
+#define MENU_MOVED 1  // selection changed
+#define MENU_OPENED 2 // another page is shown (submenu or back)
+#define MENU_ACTION 3 // an item's callback ran
+#define MENU_EXIT 4   // back at the root page
+
+/*
+ * Engine
+ */
+void Menu_init(const Menu_page_t *root);          // PROGMEM root page, forgets displays
+uint8_t Menu_attach(const Menu_display_t *display); // draws it; 0 = MENU_MAX_DISPLAYS in use
+uint8_t Menu_input(uint8_t key);                  // MENU_KEY_*, returns MENU_NONE ... MENU_EXIT
+void Menu_redraw(void);                           // after other output used the screens
+uint8_t Menu_selected(void);                      // index on the current page
+uint8_t Menu_depth(void);                         // 0 = root page
+const Menu_page_t *Menu_page(void);               // current page (PROGMEM)
+uint16_t Menu_lines_drawn(void);                  // line() calls since Menu_init
+
+/*
+ * Input Mappers (return MENU_KEY_NONE for anything else)
+ */
+uint8_t Menu_key_uart(char c);                    // w/s, Enter, a/q/Esc/Backspace, 1..9
+uint8_t Menu_key_keypad(char key, uint8_t type);  // A/B, #, *, 1..9 (KEYPAD_REPEAT scrolls)
+uint8_t Menu_key_joystick(int8_t x, int8_t y);    // up/down, right = enter, left = back
+uint8_t Menu_key_event(uint8_t type, uint16_t data); // Event_t fields: EVENT_UART_RX, EVENT_KEYPAD
+
+#endif // _MENU_H_
@@ -28,6 +28,11 @@
 #define F_CPU 16000000UL
 #endif
 #include <util/delay.h>
+#ifdef DEBOUNCE_ENABLED
+#include "_debounce.h"
+
+#define PORT_BUTTONS 0 // debounce channel of the PORTD buttons
+#endif
 
 /*
  * EDUCATIONAL FUNCTION: Complete Port Initialization
@@ -86,6 +91,9 @@ void Port_init(void)
 	 */
 	DDRD = 0x00;  // Configure PORTD as input
 	PORTD = 0xFF; // Enable internal pull-up resistors
+#ifdef DEBOUNCE_ENABLED
+	Debounce_attach(PORT_BUTTONS, &PIND, 0xFF, 0xFF); // sampled by the Timer2 tick
+#endif
 
 	/*
 	 * PORTE CONFIGURATION: LCD Control and Special Functions
@@ -176,8 +184,39 @@ void led_all_on(void)
  *
  * PURPOSE: Provide easy-to-use button input for learning
  * LEARNING: Shows input debouncing and state management
+ *
+ * With DEBOUNCE_ENABLED the functions read the vertical-counter
+ * debouncer (_debounce.h) instead of the raw pins: a read is O(1) and a
+ * bounce never shows up as a second press.
  */
 
+#ifdef DEBOUNCE_ENABLED
+/* Read specific button state (0-7), debounced */
+unsigned char button_pressed(unsigned char button_number)
+{
+	if (button_number < 8)
+	{
+		return (Debounce_state() & DEBOUNCE_INPUT(PORT_BUTTONS, button_number)) != 0;
+	}
+	return 0;
+}
+
+/* Read all button states as 8-bit value, debounced */
+unsigned char read_buttons(void)
+{
+	return (unsigned char)(Debounce_state() >> (PORT_BUTTONS * 8));
+}
+
+/* Wait for the next debounced press of any button (needs the Timer2 tick) */
+void wait_for_button_press(void)
+{
+	const uint32_t buttons = (uint32_t)0xFF << (PORT_BUTTONS * 8);
+
+	Debounce_get_press(buttons); // forget presses from before the call
+	while (!Debounce_get_press(buttons))
+		;
+}
+#else
 /* Read specific button state (0-7) */
 unsigned char button_pressed(unsigned char button_number)
 {
@@ -213,6 +252,7 @@ void wait_for_button_press(void)
 	/* Simple debounce delay */
 	_delay_ms(50);
 }
+#endif
 
 /*
  * EDUCATIONAL FUNCTION: Port Pattern Demonstrations
@@ -30,6 +30,8 @@ void led_all_on(void);                     // Turn all LEDs on
 /*
  * BUTTON INPUT FUNCTIONS
  * Educational focus: User input and event detection
+ * Raw PIND reads; with -DDEBOUNCE_ENABLED they return debounced states
+ * (_debounce.h, sampled by the Timer2 tick)
  */
 unsigned char button_pressed(unsigned char button_number); // Check if button pressed (0-7)
 unsigned char read_buttons(void);                          // Read all button states
@@ -0,0 +1,398 @@
+/*
+ * _raster.c - Integer Rasterizers for Page-Organized Monochrome Displays
+ * Part of Assembly → C → Python Learning Progression
+ *
+ * EDUCATIONAL OBJECTIVES:
+ * 1. Bresenham line: error term instead of slope (no division per point)
+ * 2. Midpoint circle/ellipse: decision variable updated with additions
+ * 3. Page-aware fills: one masked byte per page and column instead of
+ *    eight single-pixel read-modify-writes
+ * 4. Separate the algorithm (this file) from the hardware (driver callbacks)
+ *
+ * COST PER PIXEL (outline shapes):
+ * A few 16-bit additions and compares plus the driver's pixel callback.
+ * Multiplications appear only once per shape (ellipse setup) or once per
+ * column (filled circles/ellipses), never per pixel.
+ */
+
+#include "_raster.h"
+
+#define RASTER_MAX_RADIUS 127 // Keeps ellipse terms inside 32 bits
+
+/*
+ * Clip helpers: 1 if something is left inside [0, limit)
+ */
+static uint8_t raster_clip(int16_t *a, int16_t *b, uint8_t limit)
+{
+	if (*a > *b)
+	{
+		int16_t swap = *a;
+		*a = *b;
+		*b = swap;
+	}
+	if ((*b < 0) || (*a >= limit))
+	{
+		return 0;
+	}
+	if (*a < 0)
+	{
+		*a = 0;
+	}
+	if (*b >= limit)
+	{
+		*b = limit - 1;
+	}
+	return 1;
+}
+
+/*
+ * Rows y1..y2 (already clipped, y1 <= y2) over columns x1..x2 as spans:
+ * the first and last page get partial masks, pages between get 0xFF.
+ */
+static void raster_rows(const Raster_target_t *t, uint8_t x1, uint8_t x2, uint8_t y1, uint8_t y2, uint8_t color)
+{
+	uint8_t page = y1 >> 3;
+	uint8_t last = y2 >> 3;
+	uint8_t mask = 0xFF << (y1 & 7);
+
+	for (; page < last; page++)
+	{
+		t->span(page, x1, x2, mask, color);
+		mask = 0xFF;
+	}
+	mask &= 0xFF >> (7 - (y2 & 7));
+	t->span(page, x1, x2, mask, color);
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Single Pixel (clipped)
+ */
+void Raster_pixel(const Raster_target_t *t, int16_t x, int16_t y, uint8_t color)
+{
+	if ((x >= 0) && (y >= 0) && (x < t->width) && (y < t->height))
+	{
+		t->pixel((uint8_t)x, (uint8_t)y, color);
+	}
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Horizontal Line
+ *
+ * PURPOSE: All pixels share one page and one bit -> a single span
+ */
+void Raster_hline(const Raster_target_t *t, int16_t x1, int16_t x2, int16_t y, uint8_t color)
+{
+	if ((y < 0) || (y >= t->height) || !raster_clip(&x1, &x2, t->width))
+	{
+		return;
+	}
+	t->span((uint8_t)y >> 3, (uint8_t)x1, (uint8_t)x2, 1 << (y & 7), color);
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Vertical Line
+ *
+ * PURPOSE: One masked byte per page instead of one write per pixel
+ */
+void Raster_vline(const Raster_target_t *t, int16_t x, int16_t y1, int16_t y2, uint8_t color)
+{
+	if ((x < 0) || (x >= t->width) || !raster_clip(&y1, &y2, t->height))
+	{
+		return;
+	}
+	raster_rows(t, (uint8_t)x, (uint8_t)x, (uint8_t)y1, (uint8_t)y2, color);
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Bresenham Line
+ *
+ * PURPOSE: Step along the major axis; the error term decides when the
+ *          minor axis moves. err = dx - dy tracks the distance to the
+ *          ideal line times (dx + dy), so only additions are needed.
+ */
+void Raster_line(const Raster_target_t *t, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint8_t color)
+{
+	int16_t dx, dy, sx, sy, err, e2;
+
+	if (y1 == y2)
+	{
+		Raster_hline(t, x1, x2, y1, color);
+		return;
+	}
+	if (x1 == x2)
+	{
+		Raster_vline(t, x1, y1, y2, color);
+		return;
+	}
+
+	dx = (x2 > x1) ? (x2 - x1) : (x1 - x2);
+	dy = (y2 > y1) ? (y2 - y1) : (y1 - y2);
+	sx = (x1 < x2) ? 1 : -1;
+	sy = (y1 < y2) ? 1 : -1;
+	err = dx - dy;
+
+	while (1)
+	{
+		Raster_pixel(t, x1, y1, color);
+		if ((x1 == x2) && (y1 == y2))
+		{
+			break;
+		}
+		e2 = err << 1;
+		if (e2 > -dy)
+		{
+			err -= dy;
+			x1 += sx;
+		}
+		if (e2 < dx)
+		{
+			err += dx;
+			y1 += sy;
+		}
+	}
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Rectangle Outline
+ *
+ * NOTE: Corners are drawn once, so RASTER_XOR works as expected
+ */
+void Raster_rect(const Raster_target_t *t, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint8_t color)
+{
+	int16_t swap;
+
+	if (x1 > x2)
+	{
+		swap = x1;
+		x1 = x2;
+		x2 = swap;
+	}
+	if (y1 > y2)
+	{
+		swap = y1;
+		y1 = y2;
+		y2 = swap;
+	}
+
+	Raster_hline(t, x1, x2, y1, color);
+	if (y2 != y1)
+	{
+		Raster_hline(t, x1, x2, y2, color);
+	}
+	if (y2 - y1 > 1)
+	{
+		Raster_vline(t, x1, y1 + 1, y2 - 1, color);
+		if (x2 != x1)
+		{
+			Raster_vline(t, x2, y1 + 1, y2 - 1, color);
+		}
+	}
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Filled Rectangle
+ *
+ * PURPOSE: Whole page bytes: at most (pages) spans for any height
+ */
+void Raster_fill_rect(const Raster_target_t *t, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint8_t color)
+{
+	if (!raster_clip(&x1, &x2, t->width) || !raster_clip(&y1, &y2, t->height))
+	{
+		return;
+	}
+	raster_rows(t, (uint8_t)x1, (uint8_t)x2, (uint8_t)y1, (uint8_t)y2, color);
+}
+
+/*
+ * Plot (cx +- a, cy +- b) without drawing a point twice (XOR safe)
+ */
+static void raster_plot4(const Raster_target_t *t, int16_t cx, int16_t cy, int16_t a, int16_t b, uint8_t color)
+{
+	Raster_pixel(t, cx + a, cy + b, color);
+	if (a != 0)
+	{
+		Raster_pixel(t, cx - a, cy + b, color);
+	}
+	if (b != 0)
+	{
+		Raster_pixel(t, cx + a, cy - b, color);
+		if (a != 0)
+		{
+			Raster_pixel(t, cx - a, cy - b, color);
+		}
+	}
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Midpoint Circle
+ *
+ * PURPOSE: Compute one octant, mirror it 8 ways.
+ *          err < 0: midpoint inside the circle -> keep x
+ *          err >= 0: midpoint outside -> step x inwards
+ */
+void Raster_circle(const Raster_target_t *t, int16_t cx, int16_t cy, uint8_t r, uint8_t color)
+{
+	int16_t x = r;
+	int16_t y = 0;
+	int16_t err = 1 - (int16_t)r;
+
+	while (x >= y)
+	{
+		raster_plot4(t, cx, cy, x, y, color);
+		if (x != y)
+		{
+			raster_plot4(t, cx, cy, y, x, color);
+		}
+		y++;
+		if (err < 0)
+		{
+			err += (y << 1) + 1;
+		}
+		else
+		{
+			x--;
+			err += ((y - x) << 1) + 1;
+		}
+	}
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Filled Circle
+ *
+ * PURPOSE: One vertical span per column. The half height h shrinks as the
+ *          column moves away from the centre; dx^2 + h^2 is kept up to
+ *          date with additions only.
+ */
+void Raster_fill_circle(const Raster_target_t *t, int16_t cx, int16_t cy, uint8_t r, uint8_t color)
+{
+	int16_t dx, h = r;
+	int32_t limit = (int32_t)r * r + r; // (r + 0.5)^2 rounded: matches the outline
+	int32_t dist = (int32_t)r * r;		// dx^2 + h^2
+
+	for (dx = 0; dx <= r; dx++)
+	{
+		while (dist > limit)
+		{
+			dist -= (h << 1) - 1; // h^2 -> (h - 1)^2
+			h--;
+		}
+		Raster_vline(t, cx + dx, cy - h, cy + h, color);
+		if (dx != 0)
+		{
+			Raster_vline(t, cx - dx, cy - h, cy + h, color);
+		}
+		dist += (dx << 1) + 1; // dx^2 -> (dx + 1)^2
+	}
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Midpoint Ellipse
+ *
+ * PURPOSE: Region 1 (slope > -1) steps x, region 2 steps y. The decision
+ *          variable p and the gradients px = 2*ry^2*x, py = 2*rx^2*y are
+ *          updated with additions; multiplications happen only in setup.
+ */
+void Raster_ellipse(const Raster_target_t *t, int16_t cx, int16_t cy, uint8_t rx, uint8_t ry, uint8_t color)
+{
+	int32_t a2, b2, px, py, p;
+	int16_t x = 0;
+	int16_t y;
+
+	if (rx > RASTER_MAX_RADIUS)
+		rx = RASTER_MAX_RADIUS;
+	if (ry > RASTER_MAX_RADIUS)
+		ry = RASTER_MAX_RADIUS;
+
+	if (rx == 0)
+	{
+		Raster_vline(t, cx, cy - ry, cy + ry, color);
+		return;
+	}
+	if (ry == 0)
+	{
+		Raster_hline(t, cx - rx, cx + rx, cy, color);
+		return;
+	}
+
+	a2 = (int32_t)rx * rx;
+	b2 = (int32_t)ry * ry;
+	y = ry;
+	px = 0;
+	py = 2 * a2 * y;
+
+	// Region 1
+	p = b2 - a2 * ry + (a2 >> 2);
+	while (px < py)
+	{
+		raster_plot4(t, cx, cy, x, y, color);
+		x++;
+		px += 2 * b2;
+		if (p < 0)
+		{
+			p += b2 + px;
+		}
+		else
+		{
+			y--;
+			py -= 2 * a2;
+			p += b2 + px - py;
+		}
+	}
+
+	// Region 2
+	p = b2 * x * x + b2 * x + (b2 >> 2) + a2 * (int32_t)(y - 1) * (y - 1) - a2 * b2;
+	while (y >= 0)
+	{
+		raster_plot4(t, cx, cy, x, y, color);
+		y--;
+		py -= 2 * a2;
+		if (p > 0)
+		{
+			p += a2 - py;
+		}
+		else
+		{
+			x++;
+			px += 2 * b2;
+			p += a2 - py + px;
+		}
+	}
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Filled Ellipse
+ *
+ * PURPOSE: Same column scheme as the filled circle with the condition
+ *          dx^2 * ry^2 + h^2 * rx^2 <= rx^2 * ry^2
+ */
+void Raster_fill_ellipse(const Raster_target_t *t, int16_t cx, int16_t cy, uint8_t rx, uint8_t ry, uint8_t color)
+{
+	int32_t a2, b2, limit, dist;
+	int16_t dx, h;
+
+	if (rx > RASTER_MAX_RADIUS)
+		rx = RASTER_MAX_RADIUS;
+	if (ry > RASTER_MAX_RADIUS)
+		ry = RASTER_MAX_RADIUS;
+
+	a2 = (int32_t)rx * rx;
+	b2 = (int32_t)ry * ry;
+	limit = a2 * b2 + ((a2 > b2) ? a2 : b2); // half-pixel tolerance like the circle
+	h = ry;
+	dist = a2 * b2; // dx^2 * b2 + h^2 * a2 for dx = 0, h = ry
+
+	for (dx = 0; dx <= rx; dx++)
+	{
+		while ((h > 0) && (dist > limit))
+		{
+			dist -= (int32_t)((h << 1) - 1) * a2;
+			h--;
+		}
+		Raster_vline(t, cx + dx, cy - h, cy + h, color);
+		if (dx != 0)
+		{
+			Raster_vline(t, cx - dx, cy - h, cy + h, color);
+		}
+		dist += (int32_t)((dx << 1) + 1) * b2;
+	}
+}
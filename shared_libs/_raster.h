@@ -0,0 +1,83 @@
+/*
+ * _raster.h - Integer Rasterizers for Page-Organized Monochrome Displays
+ * Educational Version for Assembly→C→Python Learning Progression
+ *
+ * PURPOSE:
+ * One implementation of lines, rectangles, circles and ellipses for all
+ * KS0108 drivers (_glcd.c, ks0108_complete.c, AVR-KS0108). Only integer
+ * additions, subtractions and shifts are used per pixel - no multiply,
+ * division or sqrt inside the loops.
+ *
+ * PAGE MEMORY AND SPANS:
+ * The KS0108 stores 8 vertical pixels per byte (one page). Filling pixel
+ * by pixel would read-modify-write the same byte up to 8 times. Fills are
+ * therefore cut into spans: "columns x1..x2 of page p, rows given by
+ * mask". A driver applies a span with one read-modify-write per byte.
+ *
+ * COORDINATES:
+ * x = column (0..width-1, left to right), y = row (0..height-1, top to
+ * bottom). Signed 16-bit arguments allow shapes that are partly off the
+ * screen; everything outside is clipped.
+ *
+ * DRIVER INTERFACE:
+ *   static void my_pixel(uint8_t x, uint8_t y, uint8_t color) { ... }
+ *   static void my_span(uint8_t page, uint8_t x1, uint8_t x2,
+ *                       uint8_t mask, uint8_t color) { ... }
+ *   static const Raster_target_t my_target = {128, 64, my_pixel, my_span, 0};
+ *   Raster_line(&my_target, 0, 0, 127, 63, RASTER_SET);
+ */
+
+#ifndef _RASTER_H_
+#define _RASTER_H_
+
+#include <stdint.h>
+
+/*
+ * Colors (same values as KS0108_PIXEL_OFF/ON/XOR)
+ */
+#define RASTER_CLEAR 0
+#define RASTER_SET 1
+#define RASTER_XOR 2
+
+/*
+ * Drawing Target - supplied by the display driver
+ * Callbacks receive clipped, in-range coordinates only.
+ */
+typedef struct
+{
+	uint8_t width;  // Pixels
+	uint8_t height; // Pixels, multiple of 8
+	void (*pixel)(uint8_t x, uint8_t y, uint8_t color);
+	void (*span)(uint8_t page, uint8_t x1, uint8_t x2, uint8_t mask, uint8_t color);
+	// Optional (0 = none): store data[0..x2-x1] as whole bytes in columns
+	// x1..x2 of a page - lets text and images stream without read-modify-write
+	void (*put)(uint8_t page, uint8_t x1, uint8_t x2, const uint8_t *data);
+} Raster_target_t;
+
+/*
+ * Apply a span mask to one byte (for use inside span callbacks)
+ */
+static inline uint8_t Raster_apply(uint8_t data, uint8_t mask, uint8_t color)
+{
+	if (color == RASTER_SET)
+		return data | mask;
+	if (color == RASTER_CLEAR)
+		return data & (uint8_t)~mask;
+	return data ^ mask;
+}
+
+/*
+ * Primitives
+ */
+void Raster_pixel(const Raster_target_t *t, int16_t x, int16_t y, uint8_t color);
+void Raster_hline(const Raster_target_t *t, int16_t x1, int16_t x2, int16_t y, uint8_t color);
+void Raster_vline(const Raster_target_t *t, int16_t x, int16_t y1, int16_t y2, uint8_t color);
+void Raster_line(const Raster_target_t *t, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint8_t color);
+void Raster_rect(const Raster_target_t *t, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint8_t color);
+void Raster_fill_rect(const Raster_target_t *t, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint8_t color);
+void Raster_circle(const Raster_target_t *t, int16_t cx, int16_t cy, uint8_t r, uint8_t color);
+void Raster_fill_circle(const Raster_target_t *t, int16_t cx, int16_t cy, uint8_t r, uint8_t color);
+void Raster_ellipse(const Raster_target_t *t, int16_t cx, int16_t cy, uint8_t rx, uint8_t ry, uint8_t color);
+void Raster_fill_ellipse(const Raster_target_t *t, int16_t cx, int16_t cy, uint8_t rx, uint8_t ry, uint8_t color);
+
+#endif // _RASTER_H_
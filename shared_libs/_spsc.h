@@ -0,0 +1,111 @@
+/*
+ * _spsc.h - ATmega128 Lock-Free Single-Producer/Single-Consumer Byte Ring
+ * Educational Version for Assembly→C→Python Learning Progression
+ *
+ * PURPOSE:
+ * Byte FIFO shared between exactly one producer and one consumer, for
+ * example a UART RX ISR (producer) and the main program (consumer).
+ * No interrupts are disabled and no shared counter exists:
+ * - head is written ONLY by the producer
+ * - tail is written ONLY by the consumer
+ * - both are free-running 8-bit counters; a single-byte store is atomic
+ *   on AVR, so each side always sees a consistent index
+ * - fill level = (uint8_t)(head - tail), buffer index = counter & mask
+ *
+ * RULES:
+ * - Size must be a power of two between 2 and 128
+ * - Only one context may call the put functions, only one the get
+ *   functions (who is producer and who is consumer is up to the user)
+ *
+ * EXAMPLE:
+ *   SPSC_RING_DEFINE(uart_rx_ring, 64);
+ *   ISR(USART1_RX_vect) { Spsc_put(&uart_rx_ring, UDR1); }
+ *   if (!Spsc_is_empty(&uart_rx_ring)) c = Spsc_get(&uart_rx_ring);
+ */
+
+#ifndef _SPSC_H_
+#define _SPSC_H_
+
+#include <stdint.h>
+
+typedef struct
+{
+	volatile uint8_t head; // Write counter (producer only)
+	volatile uint8_t tail; // Read counter (consumer only)
+	uint8_t mask;          // Size - 1
+	volatile uint8_t *buffer;
+} Spsc_ring_t;
+
+/*
+ * Define a ring with its storage. Fails to compile for invalid sizes.
+ */
+#define SPSC_RING_DEFINE(name, size)                                                    \
+	typedef char name##_size_must_be_power_of_two_max_128                               \
+		[(((size) & ((size) - 1)) == 0 && (size) >= 2 && (size) <= 128) ? 1 : -1];      \
+	static volatile uint8_t name##_storage[(size)];                                     \
+	static Spsc_ring_t name = {0, 0, (size) - 1, name##_storage}
+
+/* Compiler barrier: data must be stored before the index that publishes it
+ * (host/spsc_test.c replaces it to interrupt exactly at this point) */
+#ifndef SPSC_BARRIER
+#define SPSC_BARRIER() __asm__ __volatile__("" ::: "memory")
+#endif
+
+static inline void Spsc_reset(Spsc_ring_t *ring)
+{
+	ring->head = 0;
+	ring->tail = 0;
+}
+
+static inline uint8_t Spsc_count(const Spsc_ring_t *ring)
+{
+	return (uint8_t)(ring->head - ring->tail);
+}
+
+static inline uint8_t Spsc_is_empty(const Spsc_ring_t *ring)
+{
+	return ring->head == ring->tail;
+}
+
+static inline uint8_t Spsc_free(const Spsc_ring_t *ring)
+{
+	return (uint8_t)(ring->mask + 1) - Spsc_count(ring);
+}
+
+/*
+ * Producer side: returns 1 if stored, 0 if the ring was full
+ */
+static inline uint8_t Spsc_put(Spsc_ring_t *ring, uint8_t data)
+{
+	uint8_t head = ring->head;
+
+	if ((uint8_t)(head - ring->tail) > ring->mask)
+	{
+		return 0;
+	}
+
+	ring->buffer[head & ring->mask] = data;
+	SPSC_BARRIER();
+	ring->head = head + 1;
+	return 1;
+}
+
+/*
+ * Consumer side: call only when Spsc_is_empty() returned 0
+ */
+static inline uint8_t Spsc_get(Spsc_ring_t *ring)
+{
+	uint8_t tail = ring->tail;
+	uint8_t data = ring->buffer[tail & ring->mask];
+
+	SPSC_BARRIER();
+	ring->tail = tail + 1;
+	return data;
+}
+
+static inline uint8_t Spsc_peek(const Spsc_ring_t *ring)
+{
+	return ring->buffer[ring->tail & ring->mask];
+}
+
+#endif // _SPSC_H_
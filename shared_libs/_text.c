@@ -0,0 +1,164 @@
+/*
+ * _text.c - PROGMEM Font Renderer for Page-Organized Displays
+ * Part of Assembly → C → Python Learning Progression
+ *
+ * EDUCATIONAL OBJECTIVES:
+ * 1. Font data in flash: only the 11-byte descriptor of the active font
+ *    is copied to RAM
+ * 2. Proportional fonts: width table + offset table, O(1) glyph lookup
+ * 3. Fast path vs general path: page-aligned text is a plain byte copy,
+ *    everything else is a shifted blit (_bitmap.c)
+ */
+
+#include "_text.h"
+
+static Text_font_t text_font; // RAM copy of the active PROGMEM descriptor
+
+void Text_set_font(const Text_font_t *font)
+{
+	memcpy_P(&text_font, font, sizeof(text_font));
+}
+
+uint8_t Text_height(void)
+{
+	return text_font.height;
+}
+
+static uint8_t text_glyph_width(uint8_t index)
+{
+	return text_font.widths ? pgm_read_byte(&text_font.widths[index]) : text_font.width;
+}
+
+static const uint8_t *text_glyph_data(uint8_t index)
+{
+	if (text_font.offsets)
+	{
+		return text_font.bitmaps + pgm_read_word(&text_font.offsets[index]);
+	}
+	return text_font.bitmaps + (uint16_t)index * text_font.width * ((text_font.height + 7) >> 3);
+}
+
+uint8_t Text_char_width(char c)
+{
+	uint8_t code = (uint8_t)c;
+
+	if ((code < text_font.first) || (code > text_font.last))
+	{
+		return text_font.width + text_font.spacing;
+	}
+	return text_glyph_width(code - text_font.first) + text_font.spacing;
+}
+
+uint16_t Text_width(const char *s)
+{
+	uint16_t width = 0;
+
+	while (*s)
+	{
+		width += Text_char_width(*s++);
+	}
+	return width;
+}
+
+uint16_t Text_width_P(const char *s)
+{
+	uint16_t width = 0;
+	char c;
+
+	while ((c = pgm_read_byte(s++)) != '\0')
+	{
+		width += Text_char_width(c);
+	}
+	return width;
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Draw One Glyph
+ *
+ * PURPOSE: COPY mode fills the whole cell (glyph + spacing, all pages of
+ *          the font height) so new text cleanly replaces old text.
+ *          Fast path: one put() of width + spacing bytes per page.
+ */
+void Text_glyph(const Raster_target_t *t, int16_t x, int16_t y, const uint8_t *data,
+				uint8_t width, uint8_t height, uint8_t spacing, uint8_t mode)
+{
+	uint8_t buf[TEXT_MAX_GLYPH_WIDTH];
+	uint8_t pages = (height + 7) >> 3;
+	uint8_t cell = width + spacing;
+	uint8_t page, i;
+
+	if (cell == 0)
+	{
+		return;
+	}
+	if (mode == BITMAP_COPY)
+	{
+		height = pages << 3;
+	}
+
+	if (t->put && (mode == BITMAP_COPY) && ((y & 7) == 0) && (cell <= TEXT_MAX_GLYPH_WIDTH) &&
+		(x >= 0) && (y >= 0) && (x + cell <= t->width) && (y + height <= t->height))
+	{
+		for (page = y >> 3; pages > 0; pages--, page++)
+		{
+			for (i = 0; i < width; i++)
+			{
+				buf[i] = pgm_read_byte(data++);
+			}
+			for (; i < cell; i++)
+			{
+				buf[i] = 0x00;
+			}
+			t->put(page, (uint8_t)x, (uint8_t)(x + cell - 1), buf);
+		}
+		return;
+	}
+
+	Bitmap_blit(t, x, y, width, height, data, BITMAP_RAW, mode);
+	if ((mode == BITMAP_COPY) && spacing)
+	{
+		Raster_fill_rect(t, x + width, y, x + cell - 1, y + height - 1, RASTER_CLEAR);
+	}
+}
+
+int16_t Text_char(const Raster_target_t *t, int16_t x, int16_t y, char c, uint8_t mode)
+{
+	uint8_t code = (uint8_t)c;
+	uint8_t index, width;
+
+	if ((code < text_font.first) || (code > text_font.last))
+	{
+		// Blank cell: clears in COPY mode, just advances otherwise
+		width = text_font.width + text_font.spacing;
+		if ((mode == BITMAP_COPY) && width)
+		{
+			Raster_fill_rect(t, x, y, x + width - 1, y + (((text_font.height + 7) >> 3) << 3) - 1, RASTER_CLEAR);
+		}
+		return x + width;
+	}
+
+	index = code - text_font.first;
+	width = text_glyph_width(index);
+	Text_glyph(t, x, y, text_glyph_data(index), width, text_font.height, text_font.spacing, mode);
+	return x + width + text_font.spacing;
+}
+
+int16_t Text_string(const Raster_target_t *t, int16_t x, int16_t y, const char *s, uint8_t mode)
+{
+	while (*s && (x < t->width))
+	{
+		x = Text_char(t, x, y, *s++, mode);
+	}
+	return x;
+}
+
+int16_t Text_string_P(const Raster_target_t *t, int16_t x, int16_t y, const char *s, uint8_t mode)
+{
+	char c;
+
+	while (((c = pgm_read_byte(s++)) != '\0') && (x < t->width))
+	{
+		x = Text_char(t, x, y, c, mode);
+	}
+	return x;
+}
@@ -0,0 +1,72 @@
+/*
+ * _text.h - PROGMEM Font Renderer for Page-Organized Displays
+ * Educational Version for Assembly→C→Python Learning Progression
+ *
+ * PURPOSE:
+ * Print text in any PROGMEM font (fixed or proportional, any height) at
+ * any pixel position through a Raster_target_t, the same way _raster.c
+ * draws shapes and _bitmap.c draws images.
+ *
+ * FONT FORMAT (Text_font_t, stored in PROGMEM):
+ * Glyphs are page-major images as in _bitmap.h: rows 0-7 of every column,
+ * then rows 8-15, ... bit 0 = top. Fixed-width fonts index the glyph data
+ * directly; proportional fonts add a width and an offset table.
+ * Characters outside first..last print as a blank cell of font width.
+ *
+ * Fonts are generated from ASCII-art sources (shared_libs/fonts/<name>.glyphs):
+ *   python tools/glcd_fontgen.py -o shared_libs/_fonts shared_libs/fonts/<name>.glyphs ...
+ *   Text_font_5x7        fixed 5x7, the core font of _glcd.c (declared in _glcd.h)
+ *   Text_font_prop_7     proportional 7 pixel (_fonts.h)
+ *   Text_font_digits_16  10x16 digits for dashboards (_fonts.h)
+ *
+ * FAST PATH:
+ * y on a page boundary (multiple of 8), BITMAP_COPY mode and a target
+ * with a put() callback: each glyph page is copied to a small RAM buffer
+ * and stored with one put() - whole bytes, no shifting, no read-modify-
+ * write, and the panel address is set once per glyph row. Anything else
+ * (other y, BITMAP_OR, clipping) goes through the shifting blitter.
+ *
+ * MODES (from _bitmap.h):
+ *   BITMAP_COPY  glyph cells replace the background (text over old text)
+ *   BITMAP_OR    only set pixels are drawn (text over graphics)
+ *   BITMAP_XOR   inverts the glyph pixels
+ */
+
+#ifndef _TEXT_H_
+#define _TEXT_H_
+
+#include <stdint.h>
+#include <avr/pgmspace.h>
+#include "_raster.h"
+#include "_bitmap.h"
+
+#define TEXT_MAX_GLYPH_WIDTH 24 // wider glyphs use the general path
+
+typedef struct
+{
+	uint8_t first;           // first character code
+	uint8_t last;            // last character code
+	uint8_t width;           // fixed width, or widest glyph (proportional)
+	uint8_t height;          // pixel rows
+	uint8_t spacing;         // blank columns after each glyph
+	const uint8_t *widths;   // PROGMEM width per glyph, 0 = fixed width
+	const uint16_t *offsets; // PROGMEM glyph start in bitmaps, 0 = fixed width
+	const uint8_t *bitmaps;  // PROGMEM glyph data, page-major
+} Text_font_t;
+
+void Text_set_font(const Text_font_t *font); // PROGMEM descriptor
+uint8_t Text_height(void);
+uint8_t Text_char_width(char c);             // advance including spacing
+uint16_t Text_width(const char *s);
+uint16_t Text_width_P(const char *s);
+
+/* x = column, y = row (as in _raster.h); return the x after the text */
+int16_t Text_char(const Raster_target_t *t, int16_t x, int16_t y, char c, uint8_t mode);
+int16_t Text_string(const Raster_target_t *t, int16_t x, int16_t y, const char *s, uint8_t mode);
+int16_t Text_string_P(const Raster_target_t *t, int16_t x, int16_t y, const char *s, uint8_t mode);
+
+/* One glyph from raw page-major PROGMEM data (used by other font formats) */
+void Text_glyph(const Raster_target_t *t, int16_t x, int16_t y, const uint8_t *data,
+				uint8_t width, uint8_t height, uint8_t spacing, uint8_t mode);
+
+#endif // _TEXT_H_
@@ -28,10 +28,10 @@
  * TIMING CALCULATIONS:
  * Timer frequency = F_CPU / prescaler
  * Overflow period = (256 - start_value) / timer_frequency
- * For 1ms timing with 64 prescaler:
- * Timer freq = 16MHz / 64 = 250kHz
- * Count needed = 250 (for 1ms)
- * Start value = 256 - 250 = 6
+ * For 1ms timing with 64 prescaler (TIMER2_1MS_TICKS in _timer2.h):
+ * Timer freq = 16MHz / 64 = 250kHz      7.3728MHz / 64 = 115.2kHz
+ * Count needed = 250 (for 1ms)          115 (0.998ms, nearest count)
+ * Start value = 256 - 250 = 6           256 - 115 = 141
  *
  * ASSEMBLY EQUIVALENT CONCEPTS:
  * - TCCR2 = control  ≡  LDI R16, control; OUT TCCR2, R16
@@ -55,31 +55,34 @@
 #endif
 #include "_main.h"
 #include "_timer2.h"
+#include "_atomic.h"
+#ifdef EVENT_BUS_ENABLED
+#include "_event.h"
+#endif
+#ifdef DEBOUNCE_ENABLED
+#include "_debounce.h"
+#endif
+#ifdef KEYPAD_ENABLED
+#include "_keypad.h"
+#if KEYPAD_OWN_TIMER
+#error "KEYPAD_OWN_TIMER reprograms Timer2: use the system tick hook (KEYPAD_ENABLED) instead"
+#endif
+#endif
 
 // Only compile Timer2 functions if not using self-contained assembly example
 #ifndef ASSEMBLY_BLINK_BASIC
 
 /*
- * EDUCATIONAL CONSTANTS: Timer2 Prescaler Values
- * These control the timer clock frequency for different timing requirements
+ * EDUCATIONAL CONSTANTS: Timer2 Prescaler and Start Value
+ * The TIMER2_PRESCALE_* values are in _timer2.h. On the ATmega128 Timer2
+ * has the same clock select table as Timer1: CS22:0 = 001 /1, 010 /8,
+ * 011 /64, 100 /256, 101 /1024, 11x external clock on T2 (Timer0 is the
+ * one with /32 and /128).
  */
-#define TIMER2_STOP 0x00		  // Timer stopped (CS22:0 = 000)
-#define TIMER2_PRESCALE_1 0x01	  // No prescaling (CS22:0 = 001)
-#define TIMER2_PRESCALE_8 0x02	  // Prescaler 8 (CS22:0 = 010)
-#define TIMER2_PRESCALE_32 0x03	  // Prescaler 32 (CS22:0 = 011)
-#define TIMER2_PRESCALE_64 0x04	  // Prescaler 64 (CS22:0 = 100)
-#define TIMER2_PRESCALE_128 0x05  // Prescaler 128 (CS22:0 = 101)
-#define TIMER2_PRESCALE_256 0x06  // Prescaler 256 (CS22:0 = 110)
-#define TIMER2_PRESCALE_1024 0x07 // Prescaler 1024 (CS22:0 = 111)
+#define TIMER2_1MS_START (256 - TIMER2_1MS_TICKS) // 1ms with prescaler 64 (6 at 16MHz, 141 at 7.3728MHz)
 
-/*
- * EDUCATIONAL CONSTANTS: Timer2 Start Values for Common Timings
- * Pre-calculated values for convenient timing intervals
- */
-#define TIMER2_1MS_START 6	  // Start value for 1ms with prescaler 64
-#define TIMER2_2MS_START 131  // Start value for 2ms with prescaler 64
-#define TIMER2_5MS_START 131  // Start value for 5ms with prescaler 256
-#define TIMER2_10MS_START 131 // Start value for 10ms with prescaler 256
+// The system tick must fit the 8-bit counter (F_CPU up to 16.3MHz)
+typedef char timer2_tick_must_fit_8_bits[(TIMER2_1MS_TICKS >= 1 && TIMER2_1MS_TICKS <= 256) ? 1 : -1];
 
 /*
  * EDUCATIONAL VARIABLES
@@ -121,15 +124,15 @@ unsigned char timer2_start_value = TIMER2_1MS_START;		 // Current timer start va
  *   OCIE2 = Output Compare Interrupt Enable 2
  *
  * TIMING CALCULATION FOR 1ms:
- * Timer frequency = 16MHz / 64 = 250kHz
- * For 1ms period: need 250 counts
- * Start value = 256 - 250 = 6 (but we use 26 for practical reasons)
- * Actual period = (256 - 26) / 250kHz = 0.92ms ≈ 1ms
+ * Timer frequency = F_CPU / 64 (250kHz at 16MHz)
+ * For 1ms period: need TIMER2_1MS_TICKS counts (250 at 16MHz)
+ * Start value = 256 - TIMER2_1MS_TICKS (6 at 16MHz)
+ * Actual period = TIMER2_TICK_US (1000us at 16MHz, 998us at 7.3728MHz)
  *
- * ASSEMBLY EQUIVALENT:
+ * ASSEMBLY EQUIVALENT (16MHz):
  * LDI R16, 0x00; OUT TCCR2, R16         ; Stop timer
- * LDI R16, 26; OUT TCNT2, R16           ; Set start value
- * LDI R16, 0x04; OUT TCCR2, R16         ; Start with prescaler 64
+ * LDI R16, 6; OUT TCNT2, R16            ; Set start value
+ * LDI R16, 0x03; OUT TCCR2, R16         ; Start with prescaler 64 (CS22:0 = 011)
  * LDI R16, 0x40; STS TIMSK, R16         ; Enable overflow interrupt
  */
 void Timer2_init(void)
@@ -143,15 +146,15 @@ void Timer2_init(void)
 	/*
 	 * STEP 2: Set initial timer value
 	 * Timer counts from this value to 255, then overflows
-	 * Value 26 gives approximately 1ms period with prescaler 64
-	 * Calculation: (256 - 26) * (64/16MHz) = 0.92ms ≈ 1ms
+	 * 256 - TIMER2_1MS_TICKS gives approximately 1ms with prescaler 64
+	 * Calculation: (256 - 6) * (64/16MHz) = 1ms
 	 */
 	TCNT2 = timer2_start_value; // Set start value for desired timing
 
 	/*
 	 * STEP 3: Configure Timer2 for Normal mode with prescaler
 	 * Normal mode: timer counts up, overflows at 255
-	 * Prescaler 64: reduces 16MHz clock to 250kHz
+	 * Prescaler 64 (CS22:0 = 011): reduces 16MHz clock to 250kHz
 	 */
 	TCCR2 = timer2_prescaler; // Start timer with prescaler 64
 
@@ -166,8 +169,8 @@ void Timer2_init(void)
 	 * EDUCATIONAL NOTE:
 	 * Timer2 is now configured for periodic 1ms interrupts
 	 * - Mode: Normal (count up, overflow at 255)
-	 * - Prescaler: 64 (250kHz timer frequency)
-	 * - Period: ~1ms per overflow
+	 * - Prescaler: 64 (250kHz timer frequency at 16MHz)
+	 * - Period: TIMER2_TICK_US per overflow (~1ms)
 	 * - Interrupt: Enabled on overflow
 	 * ISR removed from shared library. Applications should define
 	 * ISR(TIMER2_OVF_vect) and call Timer2_ovf_handler().
@@ -220,6 +223,22 @@ void Timer2_ovf_handler(void)
 	 */
 	system_milliseconds++;
 
+#ifdef DEBOUNCE_ENABLED
+	/*
+	 * STEP 2b: Sample buttons and switches (vertical-counter debouncer)
+	 * A few byte operations per channel, no loops over individual inputs
+	 */
+	Debounce_tick();
+#endif
+
+#ifdef KEYPAD_ENABLED
+	/*
+	 * STEP 2c: Scan one keypad row (the row selected on the last tick
+	 * has settled for a whole tick)
+	 */
+	Keypad_tick();
+#endif
+
 	/*
 	 * STEP 3: Increment main timer counter
 	 * Used for primary task scheduling
@@ -235,6 +254,9 @@ void Timer2_ovf_handler(void)
 	{
 		Task1_Of_Timer2 = 1; // Signal task 1 ready
 		Count_Of_Timer2 = 0; // Reset counter
+#ifdef EVENT_BUS_ENABLED
+		Event_post(EVENT_TIMER2_TASK1, EVENT_PRIORITY_LOW, 0);
+#endif
 	}
 
 	/*
@@ -248,6 +270,9 @@ void Timer2_ovf_handler(void)
 	{
 		Task2_Of_Timer2 = 1; // Signal task 2 ready
 		count2 = 0;			 // Reset counter
+#ifdef EVENT_BUS_ENABLED
+		Event_post(EVENT_TIMER2_TASK2, EVENT_PRIORITY_LOW, 0);
+#endif
 	}
 
 	/*
@@ -261,6 +286,9 @@ void Timer2_ovf_handler(void)
 	{
 		Task3_Of_Timer2 = 1; // Signal task 3 ready
 		count3 = 0;			 // Reset counter
+#ifdef EVENT_BUS_ENABLED
+		Event_post(EVENT_TIMER2_TASK3, EVENT_PRIORITY_LOW, 0);
+#endif
 	}
 
 	/*
@@ -289,6 +317,61 @@ void Timer2_ovf_handler(void)
  * Applications using CTC mode should define ISR(TIMER2_COMP_vect)
  * locally and call appropriate helper functions if needed. */
 
+/*
+ * EDUCATIONAL FUNCTION: Read System Time
+ *
+ * PURPOSE: Provide consistent multi-byte time readings to the main program
+ * LEARNING: A 32-bit counter is updated by the ISR one byte at a time, so
+ *           the main program must block interrupts while copying it
+ */
+unsigned long Timer2_get_milliseconds(void)
+{
+	return Atomic_read_u32(&system_milliseconds);
+}
+
+/*
+ * EDUCATIONAL FUNCTION: Read Fine-Grained Timer Ticks
+ *
+ * PURPOSE: Timestamp with one TCNT2 count resolution (64 / F_CPU: 4us at
+ *          16MHz, 8.68us at 7.3728MHz; TIMER2_TICKS_TO_US() converts)
+ * LEARNING: Combines the software millisecond counter with the hardware
+ *           counter. If the counter wrapped but the ISR has not yet counted
+ *           the new millisecond, it is added here.
+ *
+ *           The overflow handler reloads TCNT2 and so throws away the
+ *           counts since the overflow. Between the overflow and the reload
+ *           the result is therefore held at the millisecond boundary:
+ *           any later reading (count from the start value) is never smaller.
+ *
+ * RETURNS: Ticks since Timer2_init() (TIMER2_1MS_TICKS per millisecond),
+ *          never decreasing
+ * NOTE: Only valid with the default 1ms configuration (TIMER2_1MS_START)
+ */
+unsigned long Timer2_get_ticks(void)
+{
+	unsigned char sreg_backup = SREG;
+	cli();
+
+	unsigned long ms = system_milliseconds;
+	unsigned char count = TCNT2;
+
+	if ((TIFR & (1 << TOV2)) || count < timer2_start_value)
+	{
+		/* Overflow pending (ISR not yet run) or inside the overflow ISR
+		 * before the reload: the new millisecond has started, but its
+		 * counts will be discarded by the reload */
+		ms++;
+		count = 0;
+	}
+	else
+	{
+		count -= timer2_start_value;
+	}
+
+	SREG = sreg_backup;
+	return ms * TIMER2_1MS_TICKS + count;
+}
+
 /*
  * EDUCATIONAL FUNCTION: Task Management Helpers
  *
@@ -297,36 +380,22 @@ void Timer2_ovf_handler(void)
  */
 
 // Check if Task 1 is ready and clear flag
+// Test and clear happen atomically so a tick between them is not lost
 unsigned char Timer2_check_task1(void)
 {
-	if (Task1_Of_Timer2)
-	{
-		Task1_Of_Timer2 = 0;
-		return 1;
-	}
-	return 0;
+	return Atomic_test_and_clear_u16(&Task1_Of_Timer2) != 0;
 }
 
 // Check if Task 2 is ready and clear flag
 unsigned char Timer2_check_task2(void)
 {
-	if (Task2_Of_Timer2)
-	{
-		Task2_Of_Timer2 = 0;
-		return 1;
-	}
-	return 0;
+	return Atomic_test_and_clear_u16(&Task2_Of_Timer2) != 0;
 }
 
 // Check if Task 3 is ready and clear flag
 unsigned char Timer2_check_task3(void)
 {
-	if (Task3_Of_Timer2)
-	{
-		Task3_Of_Timer2 = 0;
-		return 1;
-	}
-	return 0;
+	return Atomic_test_and_clear_u16(&Task3_Of_Timer2) != 0;
 }
 
 #endif // !ASSEMBLY_BLINK_BASIC
\ No newline at end of file
@@ -10,7 +10,7 @@
 /*
  * Core Timer2 Functions - Basic Timing Operations
  */
-void Timer2_init(void);  // Initialize Timer2 for 1ms interrupts
+void Timer2_init(void);  // Initialize Timer2 for ~1ms interrupts (TIMER2_TICK_US)
 void Timer2_start(void); // Start Timer2 operation
 void Timer2_stop(void);  // Stop Timer2 operation
 
@@ -21,6 +21,7 @@ void Timer2_set_prescaler(unsigned char prescaler);   // Change timer frequency
 void Timer2_set_period_ms(unsigned int period_ms);    // Set timer period in milliseconds
 unsigned long Timer2_get_milliseconds(void);          // Get system uptime in ms
 unsigned char Timer2_delay_ms(unsigned int delay_ms); // Non-blocking delay function
+unsigned long Timer2_get_ticks(void);                 // Get uptime in Timer2 counts (4us at 16MHz)
 
 /*
  * Task Management Functions - Real-Time Scheduling
@@ -47,22 +48,33 @@ extern unsigned char timer2_start_value;           // Current timer start value
 
 /*
  * Timer2 Constants for Educational Reference
+ * The system tick is derived from F_CPU: Timer2 counts at F_CPU / 64 and
+ * overflows after TIMER2_1MS_TICKS counts (rounded to the nearest count).
+ *   16MHz:     250000Hz, 250 counts = 1.000ms, one count = 4us
+ *   7.3728MHz: 115200Hz, 115 counts = 0.998ms, one count = 8.68us
  */
-#define TIMER2_MAX_COUNT 255        // Maximum 8-bit timer value
-#define TIMER2_OVERFLOW_FREQ 250000 // Timer frequency with prescaler 64 (16MHz/64)
-#define TIMER2_1MS_TICKS 250        // Ticks needed for 1ms (250000Hz / 1000)
+#ifndef F_CPU
+#define F_CPU 16000000UL
+#endif
+#define TIMER2_MAX_COUNT 255                                      // Maximum 8-bit timer value
+#define TIMER2_PRESCALER 64                                       // Clock divider used by Timer2_init()
+#define TIMER2_OVERFLOW_FREQ ((F_CPU) / TIMER2_PRESCALER)          // Timer count frequency in Hz
+#define TIMER2_1MS_TICKS ((TIMER2_OVERFLOW_FREQ + 500UL) / 1000UL) // Counts per system tick
+#define TIMER2_TICK_US ((TIMER2_1MS_TICKS * 1000000UL + TIMER2_OVERFLOW_FREQ / 2) / TIMER2_OVERFLOW_FREQ) // System tick period
+#define TIMER2_TICKS_TO_US(ticks) ((unsigned long)(ticks) * 1000UL / TIMER2_1MS_TICKS) // Timer2_get_ticks() units to us
 
 /*
- * Prescaler Constants (redefined for header access)
+ * Prescaler Constants (CS22:0 of TCCR2; the ATmega128 Timer2 has no /32 or
+ * /128, those belong to Timer0)
  */
-#define TIMER2_STOP 0x00          // Timer stopped
-#define TIMER2_PRESCALE_1 0x01    // No prescaling (16MHz)
-#define TIMER2_PRESCALE_8 0x02    // Prescaler 8 (2MHz)
-#define TIMER2_PRESCALE_32 0x03   // Prescaler 32 (500kHz)
-#define TIMER2_PRESCALE_64 0x04   // Prescaler 64 (250kHz) - default
-#define TIMER2_PRESCALE_128 0x05  // Prescaler 128 (125kHz)
-#define TIMER2_PRESCALE_256 0x06  // Prescaler 256 (62.5kHz)
-#define TIMER2_PRESCALE_1024 0x07 // Prescaler 1024 (15.625kHz)
+#define TIMER2_STOP 0x00                // Timer stopped
+#define TIMER2_PRESCALE_1 0x01          // No prescaling
+#define TIMER2_PRESCALE_8 0x02          // Prescaler 8
+#define TIMER2_PRESCALE_64 0x03         // Prescaler 64 - default
+#define TIMER2_PRESCALE_256 0x04        // Prescaler 256
+#define TIMER2_PRESCALE_1024 0x05       // Prescaler 1024
+#define TIMER2_EXTERNAL_FALLING 0x06    // External clock on T2, falling edge
+#define TIMER2_EXTERNAL_RISING 0x07     // External clock on T2, rising edge
 
 /*
  * Common Timing Intervals (in timer ticks at 1ms per tick)
@@ -26,6 +26,10 @@
 #endif
 #include "_main.h"
 #include "_uart.h"
+#include "_atomic.h"
+#ifdef EVENT_BUS_ENABLED
+#include "_event.h"
+#endif
 
 // Only compile UART functions if not using self-contained assembly example
 #ifndef ASSEMBLY_BLINK_BASIC
@@ -206,6 +210,9 @@ void uart_rx_interrupt_handler(void)
 	uart_rx_buffer = UDR1;		   // Read received character
 	uart_rx_flag = 1;			   // Set flag for main program
 	uart_command = uart_rx_buffer; // Store for command processing
+#ifdef EVENT_BUS_ENABLED
+	Event_post(EVENT_UART_RX, EVENT_PRIORITY_HIGH, uart_rx_buffer);
+#endif
 }
 
 /*
@@ -214,12 +221,8 @@ void uart_rx_interrupt_handler(void)
  */
 unsigned char USART1_data_available(void)
 {
-	if (uart_rx_flag)
-	{
-		uart_rx_flag = 0; // Clear flag
-		return 1;		  // Data available
-	}
-	return 0; // No new data
+	// Test and clear atomically: a byte arriving in between is not lost
+	return Atomic_test_and_clear_u8(&uart_rx_flag);
 }
 
 /*
@@ -0,0 +1,13 @@
+/*
+ * host/avr/interrupt.h - avr-libc shim for the host build of the GLCD stack
+ * No interrupts on the host: a "timer ISR" is called by the program itself.
+ */
+
+#ifndef _HOST_AVR_INTERRUPT_H_
+#define _HOST_AVR_INTERRUPT_H_
+
+#define sei()
+#define cli()
+#define ISR(vector, ...) void vector(void)
+
+#endif // _HOST_AVR_INTERRUPT_H_
@@ -0,0 +1,14 @@
+/*
+ * host/avr/io.h - avr-libc shim for the host build of the GLCD stack
+ * Only what the graphics modules use outside the bus backend.
+ */
+
+#ifndef _HOST_AVR_IO_H_
+#define _HOST_AVR_IO_H_
+
+#include <stdint.h>
+
+static volatile uint8_t SREG; // status register save/restore around cli()
+#define SREG_I 7               // always clear: the host never runs interrupts
+
+#endif // _HOST_AVR_IO_H_
@@ -0,0 +1,71 @@
+#!/bin/sh
+# Build the GLCD stack for the PC against the KS0108 emulator backend
+# (_glcd_host.h), the expression engine tests (calc_test) and the SPSC ring
+# interleaving tests (spsc_test).
+# The AVR headers come from the shims in this directory.
+# Binaries go to build/ (ignored by git), not into the source tree.
+cd "$(dirname "$0")"
+mkdir -p build
+echo Building glcd_frames with the KS0108 emulator backend...
+
+gcc \
+-std=gnu99 \
+-O2 \
+-Wall \
+-funsigned-char \
+-DGLCD_BACKEND=GLCD_BACKEND_HOST \
+-I. \
+-I.. \
+glcd_frames.c \
+../_glcd.c \
+../_raster.c \
+../_bitmap.c \
+../_chart.c \
+../_text.c \
+../_fonts.c \
+../AVR-KS0108/KS0108.c \
+-o build/glcd_frames
+
+if [ $? -ne 0 ]; then
+    echo "Build failed!"
+    exit 1
+fi
+
+echo Building calc_test...
+
+gcc \
+-std=gnu99 \
+-O2 \
+-Wall \
+-Wextra \
+-funsigned-char \
+-I. \
+-I.. \
+calc_test.c \
+../_calc.c \
+-o build/calc_test
+
+if [ $? -ne 0 ]; then
+    echo "Build failed!"
+    exit 1
+fi
+
+echo Building spsc_test...
+
+gcc \
+-std=gnu99 \
+-O2 \
+-Wall \
+-Wextra \
+-funsigned-char \
+-I. \
+-I.. \
+spsc_test.c \
+-o build/spsc_test
+
+if [ $? -eq 0 ]; then
+    echo "Build successful: build/glcd_frames [-o out_dir] [-g golden_dir], build/calc_test, build/spsc_test"
+else
+    echo "Build failed!"
+    exit 1
+fi
@@ -0,0 +1,186 @@
+/*
+ * calc_test.c - Expression Engine Tests on the PC (host build)
+ * Part of Assembly → C → Python Learning Progression
+ *
+ * EDUCATIONAL OBJECTIVES:
+ * 1. Run the unchanged _calc.c on a PC through the avr-libc shims
+ * 2. Check every result code and the edge values of both number formats
+ * 3. Fail loudly: the exit status is non-zero when any check fails
+ *
+ * USAGE (after ./build_host.sh in shared_libs/host):
+ *   build/calc_test
+ *
+ * The cycle benchmark stays on the target (Keypad_Calculator_App demo 5);
+ * this program only checks correctness.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include "_calc.h"
+
+#define Q(x) ((int32_t)((x) * CALC_FIXED_ONE)) // exact Q16.16 constants only
+
+typedef struct
+{
+    const char *expr;
+    uint8_t mode;
+    uint8_t error;
+    int32_t value; // expected result when error == CALC_OK
+} eval_case_t;
+
+typedef struct
+{
+    int32_t value;
+    uint8_t mode;
+    const char *text;
+} format_case_t;
+
+static const eval_case_t eval_cases[] = {
+    // precedence and left-to-right evaluation
+    {"1+2*3", CALC_MODE_INT, CALC_OK, 7},
+    {"(1+2)*3", CALC_MODE_INT, CALC_OK, 9},
+    {"2*3+4*5", CALC_MODE_INT, CALC_OK, 26},
+    {"8-2*3", CALC_MODE_INT, CALC_OK, 2},
+    {"10-4-3", CALC_MODE_INT, CALC_OK, 3},
+    {"100/10/5", CALC_MODE_INT, CALC_OK, 2},
+    {" 7 * ( 2 + 1 ) ", CALC_MODE_INT, CALC_OK, 21},
+    {"((1+2)*(3+4)-5)*(6-(7+8)/9)", CALC_MODE_INT, CALC_OK, 80},
+
+    // unary minus and plus
+    {"-5+3", CALC_MODE_INT, CALC_OK, -2},
+    {"(12+3)*-4/5", CALC_MODE_INT, CALC_OK, -12},
+    {"-(2+3)", CALC_MODE_INT, CALC_OK, -5},
+    {"--3", CALC_MODE_INT, CALC_OK, 3},
+    {"+4", CALC_MODE_INT, CALC_OK, 4},
+    {"-2*-3", CALC_MODE_INT, CALC_OK, 6},
+    {"2--3", CALC_MODE_INT, CALC_OK, 5},
+    {"-7/2", CALC_MODE_INT, CALC_OK, -3},
+    {"7/-2", CALC_MODE_INT, CALC_OK, -3},
+
+    // INT range
+    {"2147483647", CALC_MODE_INT, CALC_OK, INT32_MAX},
+    {"-2147483647-1", CALC_MODE_INT, CALC_OK, INT32_MIN},
+    {"2147483648", CALC_MODE_INT, CALC_ERR_OVERFLOW, 0},
+    {"2147483647+1", CALC_MODE_INT, CALC_ERR_OVERFLOW, 0},
+    {"-2147483647-2", CALC_MODE_INT, CALC_ERR_OVERFLOW, 0},
+    {"65536*32768", CALC_MODE_INT, CALC_ERR_OVERFLOW, 0},
+    {"65536*-32768", CALC_MODE_INT, CALC_OK, INT32_MIN},
+    {"(-2147483647-1)/-1", CALC_MODE_INT, CALC_ERR_OVERFLOW, 0},
+    {"-(-2147483647-1)", CALC_MODE_INT, CALC_ERR_OVERFLOW, 0},
+
+    // division by zero
+    {"1/0", CALC_MODE_INT, CALC_ERR_DIV_ZERO, 0},
+    {"1/(3-3)", CALC_MODE_INT, CALC_ERR_DIV_ZERO, 0},
+    {"1/0", CALC_MODE_FIXED, CALC_ERR_DIV_ZERO, 0},
+    {"0/5", CALC_MODE_INT, CALC_OK, 0},
+
+    // parentheses
+    {"(1+2", CALC_MODE_INT, CALC_ERR_PAREN, 0},
+    {"1+2)", CALC_MODE_INT, CALC_ERR_PAREN, 0},
+    {"((1)", CALC_MODE_INT, CALC_ERR_PAREN, 0},
+    {"()", CALC_MODE_INT, CALC_ERR_SYNTAX, 0},
+
+    // syntax
+    {"", CALC_MODE_INT, CALC_ERR_SYNTAX, 0},
+    {"1+", CALC_MODE_INT, CALC_ERR_SYNTAX, 0},
+    {"1+*2", CALC_MODE_INT, CALC_ERR_SYNTAX, 0},
+    {"*2", CALC_MODE_INT, CALC_ERR_SYNTAX, 0},
+    {"2 3", CALC_MODE_INT, CALC_ERR_SYNTAX, 0},
+    {"2(3)", CALC_MODE_INT, CALC_ERR_SYNTAX, 0},
+    {"1.5", CALC_MODE_INT, CALC_ERR_SYNTAX, 0},
+    {".", CALC_MODE_FIXED, CALC_ERR_SYNTAX, 0},
+    {"1x", CALC_MODE_INT, CALC_ERR_SYNTAX, 0},
+
+    // stack depth (CALC_STACK_DEPTH pending values or operators)
+    {"((((((((((((((((1))))))))))))))))", CALC_MODE_INT, CALC_OK, 1},
+    {"(((((((((((((((((1)))))))))))))))))", CALC_MODE_INT, CALC_ERR_DEPTH, 0},
+    {"----------------1", CALC_MODE_INT, CALC_OK, 1},
+    {"-----------------1", CALC_MODE_INT, CALC_ERR_DEPTH, 0},
+
+    // Q16.16
+    {"2.5*(1.5-0.25)", CALC_MODE_FIXED, CALC_OK, Q(3.125)},
+    {"1/3", CALC_MODE_FIXED, CALC_OK, 21845},
+    {"-10/4", CALC_MODE_FIXED, CALC_OK, Q(-2.5)},
+    {"0.5*-0.5", CALC_MODE_FIXED, CALC_OK, Q(-0.25)},
+    {"0.00001", CALC_MODE_FIXED, CALC_OK, 0},
+    {"32767", CALC_MODE_FIXED, CALC_OK, Q(32767)},
+    {"-32767-1", CALC_MODE_FIXED, CALC_OK, INT32_MIN},
+    {"32768", CALC_MODE_FIXED, CALC_ERR_OVERFLOW, 0},
+    {"32767+1", CALC_MODE_FIXED, CALC_ERR_OVERFLOW, 0},
+    {"200*200", CALC_MODE_FIXED, CALC_ERR_OVERFLOW, 0},
+    {"1/0.00002", CALC_MODE_FIXED, CALC_ERR_DIV_ZERO, 0}, // below the resolution: 0
+    {"30000/0.5", CALC_MODE_FIXED, CALC_ERR_OVERFLOW, 0},
+};
+
+static const format_case_t format_cases[] = {
+    {0, CALC_MODE_INT, "0"},
+    {7, CALC_MODE_INT, "7"},
+    {-7, CALC_MODE_INT, "-7"},
+    {1000000, CALC_MODE_INT, "1000000"},
+    {INT32_MAX, CALC_MODE_INT, "2147483647"},
+    {INT32_MIN, CALC_MODE_INT, "-2147483648"},
+    {0, CALC_MODE_FIXED, "0"},
+    {Q(2), CALC_MODE_FIXED, "2"},
+    {Q(3.125), CALC_MODE_FIXED, "3.125"},
+    {Q(-0.5), CALC_MODE_FIXED, "-0.5"},
+    {21845, CALC_MODE_FIXED, "0.3333"},     // 1/3
+    {Q(0.0625), CALC_MODE_FIXED, "0.0625"}, // leading zeros after the point
+    {Q(-32768), CALC_MODE_FIXED, "-32768"}, // INT32_MIN
+    {INT32_MAX, CALC_MODE_FIXED, "32768"},  // 32767.99998 rounds up
+    {-1, CALC_MODE_FIXED, "0"},             // -0.00001: no "-0"
+    {1, CALC_MODE_FIXED, "0"},
+    {-7, CALC_MODE_FIXED, "-0.0001"},       // -0.000107 rounds to 4 decimals
+};
+
+#define COUNT(a) (sizeof(a) / sizeof((a)[0]))
+
+int main(void)
+{
+    unsigned int i, failed = 0;
+    int32_t value;
+    uint8_t err, len;
+    char text[CALC_FORMAT_SIZE + 4];
+
+    for (i = 0; i < COUNT(eval_cases); i++)
+    {
+        const eval_case_t *t = &eval_cases[i];
+
+        value = 0x5A5A5A5A; // must stay unchanged on an error
+        err = Calc_eval(t->expr, t->mode, &value);
+        if ((err != t->error) || (err == CALC_OK && value != t->value) ||
+            (err != CALC_OK && value != 0x5A5A5A5A))
+        {
+            printf("FAIL eval %-36s %s: error %u value %ld, expected error %u value %ld\n", t->expr,
+                   t->mode == CALC_MODE_FIXED ? "Q16" : "INT", err, (long)value, t->error, (long)t->value);
+            failed++;
+        }
+    }
+
+    for (i = 0; i < COUNT(format_cases); i++)
+    {
+        const format_case_t *t = &format_cases[i];
+
+        memset(text, '#', sizeof(text));
+        len = Calc_format(t->value, t->mode, text);
+        if (strcmp(text, t->text) != 0 || len != strlen(t->text) || len >= CALC_FORMAT_SIZE)
+        {
+            printf("FAIL format %ld %s: \"%s\" (length %u), expected \"%s\"\n", (long)t->value,
+                   t->mode == CALC_MODE_FIXED ? "Q16" : "INT", text, len, t->text);
+            failed++;
+        }
+    }
+
+    for (i = CALC_OK; i <= CALC_ERR_DEPTH; i++)
+    {
+        if (Calc_error_P(i) == 0 || strlen(Calc_error_P(i)) == 0)
+        {
+            printf("FAIL no message for error %u\n", i);
+            failed++;
+        }
+    }
+
+    printf("calc_test: %u checks, %u failed\n",
+           (unsigned int)(COUNT(eval_cases) + COUNT(format_cases) + CALC_ERR_DEPTH + 1), failed);
+    return failed != 0;
+}
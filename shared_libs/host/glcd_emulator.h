@@ -0,0 +1,32 @@
+/*
+ * glcd_emulator.h - KS0108 Emulator API (host build only)
+ * Educational Version for Assembly→C→Python Learning Progression
+ *
+ * PURPOSE:
+ * Look at what the emulated panel shows after the unchanged GLCD code ran
+ * on a PC: capture frames as PBM images, compare them with golden images,
+ * and check that the panel RAM matches ScreenBuffer. The bus cost of a
+ * frame comes from the core's own GLCD_Get_bus_stats().
+ *
+ * Implemented by the emulator backend (_glcd_host.h), which is compiled
+ * into _glcd.c with -DGLCD_BACKEND=GLCD_BACKEND_HOST.
+ *
+ * Coordinates as on the panel: x = column 0..127, y = row 0..63 (after the
+ * display start line is applied).
+ */
+
+#ifndef _GLCD_EMULATOR_H_
+#define _GLCD_EMULATOR_H_
+
+#define GLCD_HOST_WIDTH 128
+#define GLCD_HOST_HEIGHT 64
+
+unsigned char GLCD_Host_pixel(unsigned char x, unsigned char y); /* 1 = pixel shown dark */
+unsigned char GLCD_Host_ram(unsigned char page, unsigned char column); /* controller RAM byte */
+unsigned int GLCD_Host_diff_buffer(void);       /* RAM bytes that differ from ScreenBuffer */
+unsigned long GLCD_Host_bad_commands(void);     /* invalid instructions since lcd_init */
+
+int GLCD_Host_save_pbm(const char *path);       /* 0 = written */
+long GLCD_Host_compare_pbm(const char *path);   /* differing pixels, -1 = no/bad golden file */
+
+#endif // _GLCD_EMULATOR_H_
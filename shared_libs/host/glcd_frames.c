@@ -0,0 +1,219 @@
+/*
+ * glcd_frames.c - Reference Frames on the KS0108 Emulator (host build)
+ * Part of Assembly → C → Python Learning Progression
+ *
+ * EDUCATIONAL OBJECTIVES:
+ * 1. Run the unchanged GLCD code on a PC against an emulated panel
+ * 2. Regression check: compare every frame with a golden PBM image
+ * 3. Measure each frame: commands, data bytes and bus time
+ *
+ * USAGE (after ./build_host.sh in shared_libs/host):
+ *   build/glcd_frames              print the bus cost table
+ *   build/glcd_frames -o out       also write out/NN_name.pbm
+ *   build/glcd_frames -g golden    compare with golden/NN_name.pbm, exit 1 on a mismatch
+ *
+ * The golden images are committed in shared_libs/host/golden and
+ * ./test_host.sh compares against them. A faster renderer must keep the
+ * pictures identical and lower the numbers in the table. After an
+ * intended change of a picture, regenerate with -o golden, look at the
+ * new images and commit them with the change.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "_glcd.h"
+#include "_bitmap.h"
+#include "_chart.h"
+#include "_text.h"
+#include "_fonts.h"
+#include "AVR-KS0108/KS0108.h"
+#include "AVR-KS0108/Font5x8.h"
+#include "glcd_emulator.h"
+
+typedef struct
+{
+    const char *name;
+    unsigned char mode; // GLCD_RENDER_IMMEDIATE or GLCD_RENDER_DEFERRED
+    void (*draw)(void);
+} frame_t;
+
+static const uint8_t SMILEY[] = {
+    BITMAP_HEADER(8, 8, BITMAP_RAW),
+    0x3C, 0x42, 0xA5, 0x91, 0x91, 0xA5, 0x42, 0x3C};
+
+static void frame_text(void)
+{
+    lcd_string(0, 0, "ABCDEFGHIJKLMNOPQRSTU");
+    lcd_string(1, 0, "abcdefghijklmnopqrstu");
+    lcd_string(2, 0, "0123456789 !\"#$%&'()*");
+    lcd_string(4, 5, "Left|Right"); // crosses the controller boundary
+    lcd_string(7, 0, "+-*/<=>?@[\\]^_`{|}~");
+}
+
+static void frame_shapes(void)
+{
+    GLCD_Rectangle(0, 0, 63, 127);
+    GLCD_Line(0, 0, 63, 127);
+    GLCD_Line(63, 0, 0, 127);
+    GLCD_Circle(32, 64, 30);
+    GLCD_Ellipse(32, 30, 12, 24);
+    GLCD_Rectangle(20, 90, 44, 120);
+}
+
+static void frame_fills(void)
+{
+    GLCD_Fill_rectangle(4, 4, 59, 60, RASTER_SET);
+    GLCD_Fill_circle(32, 32, 20, RASTER_XOR);
+    GLCD_Fill_ellipse(32, 96, 28, 20, RASTER_SET);
+    GLCD_Fill_rectangle(20, 70, 44, 122, RASTER_XOR);
+}
+
+static void frame_fonts(void)
+{
+    Text_set_font(&Text_font_5x7);
+    Text_string(&GLCD_raster, 0, 0, "5x7 aligned", BITMAP_COPY);
+    Text_string(&GLCD_raster, 3, 11, "5x7 at y=11", BITMAP_COPY);
+    Text_set_font(&Text_font_prop_7);
+    Text_string(&GLCD_raster, 0, 24, "Proportional: Wij 1.5", BITMAP_COPY);
+    Text_set_font(&Text_font_digits_16);
+    Text_string(&GLCD_raster, 0, 40, "12:34.5", BITMAP_COPY);
+    Text_string(&GLCD_raster, 90, 37, "99%", BITMAP_OR);
+}
+
+static void frame_sprites(void)
+{
+    unsigned char i;
+
+    GLCD_Fill_rectangle(16, 0, 47, 127, RASTER_SET);
+    for (i = 0; i < 15; i++)
+    {
+        Bitmap_draw(&GLCD_raster, i * 9 - 4, i * 4 - 2, SMILEY, BITMAP_XOR); // clipped at both ends
+    }
+    Bitmap_draw(&GLCD_raster, 60, 28, SMILEY, BITMAP_COPY);
+}
+
+// waterfall chart: exercises the display start line
+static void frame_scroll(void)
+{
+    int16_t values[2];
+    int16_t wave = 0, step = 7;
+    unsigned int n;
+
+    Chart_init(2, 1);
+    Chart_set_range(0, -100, 100);
+    Chart_set_range(1, 0, 1000);
+    for (n = 0; n < 100; n++)
+    {
+        wave += step;
+        if ((wave >= 90) || (wave <= -90))
+            step = -step;
+        values[0] = wave;
+        values[1] = (int16_t)(n * 10);
+        Chart_sample(values);
+    }
+}
+
+// the AVR-KS0108 API layer (deferred, GLCD_Render sends the frame)
+static void frame_ks0108_api(void)
+{
+    GLCD_SetFont(Font5x8, 5, 8, GLCD_Overwrite);
+    GLCD_GotoXY(2, 2);
+    GLCD_PrintString("KS0108 API");
+    GLCD_SetFont(Font5x8, 5, 8, GLCD_Merge);
+    GLCD_GotoXY(70, 5);
+    GLCD_PrintString("merge");
+    GLCD_DrawRectangle(0, 14, 127, 63, GLCD_Black);
+    GLCD_FillCircle(40, 40, 18, GLCD_Black);
+    GLCD_DrawLine(4, 60, 124, 18, GLCD_Black);
+    GLCD_InvertRectangle(30, 30, 110, 50);
+    GLCD_DrawEllipse(95, 38, 25, 12, GLCD_Black);
+    GLCD_Render();
+}
+
+static const frame_t frames[] = {
+    {"text", GLCD_RENDER_IMMEDIATE, frame_text},
+    {"shapes", GLCD_RENDER_IMMEDIATE, frame_shapes},
+    {"shapes_deferred", GLCD_RENDER_DEFERRED, frame_shapes}, // same picture, fewer writes
+    {"fills", GLCD_RENDER_DEFERRED, frame_fills},
+    {"fonts", GLCD_RENDER_DEFERRED, frame_fonts},
+    {"sprites", GLCD_RENDER_DEFERRED, frame_sprites},
+    {"scroll", GLCD_RENDER_IMMEDIATE, frame_scroll},
+    {"ks0108_api", GLCD_RENDER_DEFERRED, frame_ks0108_api},
+};
+
+int main(int argc, char **argv)
+{
+    const char *out_dir = 0, *golden_dir = 0;
+    char path[256];
+    GLCD_bus_stats_t stats;
+    unsigned int i, ram_diff;
+    long golden_diff;
+    int failed = 0;
+
+    for (i = 1; i < (unsigned int)argc; i++)
+    {
+        if ((strcmp(argv[i], "-o") == 0) && (i + 1 < (unsigned int)argc))
+            out_dir = argv[++i];
+        else if ((strcmp(argv[i], "-g") == 0) && (i + 1 < (unsigned int)argc))
+            golden_dir = argv[++i];
+        else
+        {
+            fprintf(stderr, "usage: %s [-o out_dir] [-g golden_dir]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    lcd_init();
+    printf("%-3s %-16s %8s %8s %8s %8s  %s\n", "#", "frame", "commands", "data", "bus_us", "ram!=buf", "golden");
+
+    for (i = 0; i < sizeof(frames) / sizeof(frames[0]); i++)
+    {
+        // every frame starts from a blank panel at start line 0
+        GLCD_Set_render_mode(GLCD_RENDER_IMMEDIATE);
+        GLCD_Set_start_line(0);
+        lcd_clear();
+
+        GLCD_Set_render_mode(frames[i].mode);
+        GLCD_Reset_bus_stats();
+        frames[i].draw();
+        GLCD_Flush(); // nothing to send in immediate mode
+        GLCD_Get_bus_stats(&stats);
+
+        ram_diff = GLCD_Host_diff_buffer();
+        printf("%02u  %-16s %8lu %8lu %8lu %8u  ", i, frames[i].name, stats.commands, stats.data_bytes,
+               stats.bus_time_us, ram_diff);
+        if (ram_diff)
+            failed = 1;
+
+        if (out_dir)
+        {
+            snprintf(path, sizeof(path), "%s/%02u_%s.pbm", out_dir, i, frames[i].name);
+            if (GLCD_Host_save_pbm(path) != 0)
+            {
+                fprintf(stderr, "cannot write %s\n", path);
+                failed = 1;
+            }
+        }
+        if (golden_dir)
+        {
+            snprintf(path, sizeof(path), "%s/%02u_%s.pbm", golden_dir, i, frames[i].name);
+            golden_diff = GLCD_Host_compare_pbm(path);
+            if (golden_diff < 0)
+                printf("missing");
+            else if (golden_diff > 0)
+                printf("DIFF %ld pixels", golden_diff);
+            else
+                printf("ok");
+            if (golden_diff != 0)
+                failed = 1;
+        }
+        printf("\n");
+    }
+
+    if (GLCD_Host_bad_commands())
+    {
+        printf("invalid KS0108 instructions: %lu\n", GLCD_Host_bad_commands());
+        failed = 1;
+    }
+    return failed;
+}
@@ -0,0 +1,18 @@
+#!/bin/sh
+# Host regression tests: build, check the expression engine and the SPSC
+# ring under interleaved producer/consumer steps, then compare
+# every GLCD frame with the golden PBM images in golden/. Exit status is
+# non-zero on any failure.
+cd "$(dirname "$0")"
+sh ./build_host.sh || exit 1
+
+echo Running calc_test...
+build/calc_test || { echo "calc_test failed"; exit 1; }
+
+echo Running spsc_test...
+build/spsc_test || { echo "spsc_test failed"; exit 1; }
+
+echo Comparing GLCD frames with golden/...
+build/glcd_frames -g golden || { echo "GLCD frames differ from golden/"; exit 1; }
+
+echo "All host tests passed."
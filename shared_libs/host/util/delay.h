@@ -0,0 +1,13 @@
+/*
+ * host/util/delay.h - avr-libc shim for the host build of the GLCD stack
+ * Busy-wait delays cost nothing on the host; bus time is counted by the
+ * core's bus statistics instead.
+ */
+
+#ifndef _HOST_UTIL_DELAY_H_
+#define _HOST_UTIL_DELAY_H_
+
+#define _delay_ms(ms) ((void)0)
+#define _delay_us(us) ((void)0)
+
+#endif // _HOST_UTIL_DELAY_H_
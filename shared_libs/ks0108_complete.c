@@ -6,21 +6,20 @@
  * AUTHOR: AI Assistant
  * PURPOSE: Robust KS0108 GLCD library built from detailed specifications
  *
- * This implementation provides comprehensive KS0108 support with:
- * - Proper timing and initialization sequences
- * - Dual controller management (left/right)
- * - Complete graphics primitives
- * - Text rendering with 5x7 font
- * - SimulIDE compatibility
- * - Hardware optimization
+ * The ks0108_* API on top of the shared GLCD core (_glcd.c):
+ * - Bus, timing and wiring come from the core's backend (_glcd_backend.h)
+ * - Pixels and shapes go through the core's ScreenBuffer and rasterizers
+ * - Text uses the core's PROGMEM 5x7 font (no font table in SRAM)
+ * - Dual controller management (left/right) and start line scrolling
  *
  * =============================================================================
  */
 
 #include "ks0108_complete.h"
+#include "_glcd.h"
+#include <util/delay.h>
 #include <stdarg.h>
 #include <stdio.h>
-#include <stdlib.h>
 
 /*
  * =============================================================================
@@ -35,105 +34,6 @@ static ks0108_state_t g_ks0108_state;
 static uint8_t g_text_line = 0;
 static uint8_t g_text_column = 0;
 
-/* 5x7 ASCII font table (characters 0x20-0x7E) */
-static const uint8_t ks0108_font[95][5] = {
-    {0x00, 0x00, 0x00, 0x00, 0x00}, // 0x20 (space)
-    {0x00, 0x00, 0x4F, 0x00, 0x00}, // 0x21 !
-    {0x00, 0x07, 0x00, 0x07, 0x00}, // 0x22 "
-    {0x14, 0x7F, 0x14, 0x7F, 0x14}, // 0x23 #
-    {0x24, 0x2A, 0x7F, 0x2A, 0x12}, // 0x24 $
-    {0x23, 0x13, 0x08, 0x64, 0x62}, // 0x25 %
-    {0x36, 0x49, 0x55, 0x22, 0x50}, // 0x26 &
-    {0x00, 0x05, 0x03, 0x00, 0x00}, // 0x27 '
-    {0x00, 0x1C, 0x22, 0x41, 0x00}, // 0x28 (
-    {0x00, 0x41, 0x22, 0x1C, 0x00}, // 0x29 )
-    {0x14, 0x08, 0x3E, 0x08, 0x14}, // 0x2A *
-    {0x08, 0x08, 0x3E, 0x08, 0x08}, // 0x2B +
-    {0x00, 0x50, 0x30, 0x00, 0x00}, // 0x2C ,
-    {0x08, 0x08, 0x08, 0x08, 0x08}, // 0x2D -
-    {0x00, 0x60, 0x60, 0x00, 0x00}, // 0x2E .
-    {0x20, 0x10, 0x08, 0x04, 0x02}, // 0x2F /
-    {0x3E, 0x51, 0x49, 0x45, 0x3E}, // 0x30 0
-    {0x00, 0x42, 0x7F, 0x40, 0x00}, // 0x31 1
-    {0x42, 0x61, 0x51, 0x49, 0x46}, // 0x32 2
-    {0x21, 0x41, 0x45, 0x4B, 0x31}, // 0x33 3
-    {0x18, 0x14, 0x12, 0x7F, 0x10}, // 0x34 4
-    {0x27, 0x45, 0x45, 0x45, 0x39}, // 0x35 5
-    {0x3C, 0x4A, 0x49, 0x49, 0x30}, // 0x36 6
-    {0x01, 0x71, 0x09, 0x05, 0x03}, // 0x37 7
-    {0x36, 0x49, 0x49, 0x49, 0x36}, // 0x38 8
-    {0x06, 0x49, 0x49, 0x29, 0x1E}, // 0x39 9
-    {0x00, 0x36, 0x36, 0x00, 0x00}, // 0x3A :
-    {0x00, 0x56, 0x36, 0x00, 0x00}, // 0x3B ;
-    {0x08, 0x14, 0x22, 0x41, 0x00}, // 0x3C <
-    {0x14, 0x14, 0x14, 0x14, 0x14}, // 0x3D =
-    {0x00, 0x41, 0x22, 0x14, 0x08}, // 0x3E >
-    {0x02, 0x01, 0x51, 0x09, 0x06}, // 0x3F ?
-    {0x32, 0x49, 0x79, 0x41, 0x3E}, // 0x40 @
-    {0x7E, 0x11, 0x11, 0x11, 0x7E}, // 0x41 A
-    {0x7F, 0x49, 0x49, 0x49, 0x36}, // 0x42 B
-    {0x3E, 0x41, 0x41, 0x41, 0x22}, // 0x43 C
-    {0x7F, 0x41, 0x41, 0x22, 0x1C}, // 0x44 D
-    {0x7F, 0x49, 0x49, 0x49, 0x41}, // 0x45 E
-    {0x7F, 0x09, 0x09, 0x09, 0x01}, // 0x46 F
-    {0x3E, 0x41, 0x49, 0x49, 0x7A}, // 0x47 G
-    {0x7F, 0x08, 0x08, 0x08, 0x7F}, // 0x48 H
-    {0x00, 0x41, 0x7F, 0x41, 0x00}, // 0x49 I
-    {0x20, 0x40, 0x41, 0x3F, 0x01}, // 0x4A J
-    {0x7F, 0x08, 0x14, 0x22, 0x41}, // 0x4B K
-    {0x7F, 0x40, 0x40, 0x40, 0x40}, // 0x4C L
-    {0x7F, 0x02, 0x0C, 0x02, 0x7F}, // 0x4D M
-    {0x7F, 0x04, 0x08, 0x10, 0x7F}, // 0x4E N
-    {0x3E, 0x41, 0x41, 0x41, 0x3E}, // 0x4F O
-    {0x7F, 0x09, 0x09, 0x09, 0x06}, // 0x50 P
-    {0x3E, 0x41, 0x51, 0x21, 0x5E}, // 0x51 Q
-    {0x7F, 0x09, 0x19, 0x29, 0x46}, // 0x52 R
-    {0x46, 0x49, 0x49, 0x49, 0x31}, // 0x53 S
-    {0x01, 0x01, 0x7F, 0x01, 0x01}, // 0x54 T
-    {0x3F, 0x40, 0x40, 0x40, 0x3F}, // 0x55 U
-    {0x1F, 0x20, 0x40, 0x20, 0x1F}, // 0x56 V
-    {0x3F, 0x40, 0x38, 0x40, 0x3F}, // 0x57 W
-    {0x63, 0x14, 0x08, 0x14, 0x63}, // 0x58 X
-    {0x07, 0x08, 0x70, 0x08, 0x07}, // 0x59 Y
-    {0x61, 0x51, 0x49, 0x45, 0x43}, // 0x5A Z
-    {0x00, 0x7F, 0x41, 0x41, 0x00}, // 0x5B [
-    {0x02, 0x04, 0x08, 0x10, 0x20}, // 0x5C backslash
-    {0x00, 0x41, 0x41, 0x7F, 0x00}, // 0x5D ]
-    {0x04, 0x02, 0x01, 0x02, 0x04}, // 0x5E ^
-    {0x40, 0x40, 0x40, 0x40, 0x40}, // 0x5F _
-    {0x00, 0x01, 0x02, 0x04, 0x00}, // 0x60 `
-    {0x20, 0x54, 0x54, 0x54, 0x78}, // 0x61 a
-    {0x7F, 0x48, 0x44, 0x44, 0x38}, // 0x62 b
-    {0x38, 0x44, 0x44, 0x44, 0x20}, // 0x63 c
-    {0x38, 0x44, 0x44, 0x48, 0x7F}, // 0x64 d
-    {0x38, 0x54, 0x54, 0x54, 0x18}, // 0x65 e
-    {0x08, 0x7E, 0x09, 0x01, 0x02}, // 0x66 f
-    {0x0C, 0x52, 0x52, 0x52, 0x3E}, // 0x67 g
-    {0x7F, 0x08, 0x04, 0x04, 0x78}, // 0x68 h
-    {0x00, 0x44, 0x7D, 0x40, 0x00}, // 0x69 i
-    {0x20, 0x40, 0x44, 0x3D, 0x00}, // 0x6A j
-    {0x7F, 0x10, 0x28, 0x44, 0x00}, // 0x6B k
-    {0x00, 0x41, 0x7F, 0x40, 0x00}, // 0x6C l
-    {0x7C, 0x04, 0x18, 0x04, 0x78}, // 0x6D m
-    {0x7C, 0x08, 0x04, 0x04, 0x78}, // 0x6E n
-    {0x38, 0x44, 0x44, 0x44, 0x38}, // 0x6F o
-    {0x7C, 0x14, 0x14, 0x14, 0x08}, // 0x70 p
-    {0x08, 0x14, 0x14, 0x18, 0x7C}, // 0x71 q
-    {0x7C, 0x08, 0x04, 0x04, 0x08}, // 0x72 r
-    {0x48, 0x54, 0x54, 0x54, 0x20}, // 0x73 s
-    {0x04, 0x3F, 0x44, 0x40, 0x20}, // 0x74 t
-    {0x3C, 0x40, 0x40, 0x20, 0x7C}, // 0x75 u
-    {0x1C, 0x20, 0x40, 0x20, 0x1C}, // 0x76 v
-    {0x3C, 0x40, 0x30, 0x40, 0x3C}, // 0x77 w
-    {0x44, 0x28, 0x10, 0x28, 0x44}, // 0x78 x
-    {0x0C, 0x50, 0x50, 0x50, 0x3C}, // 0x79 y
-    {0x44, 0x64, 0x54, 0x4C, 0x44}, // 0x7A z
-    {0x00, 0x08, 0x36, 0x41, 0x00}, // 0x7B {
-    {0x00, 0x00, 0x7F, 0x00, 0x00}, // 0x7C |
-    {0x00, 0x41, 0x36, 0x08, 0x00}, // 0x7D }
-    {0x08, 0x04, 0x08, 0x10, 0x08}  // 0x7E ~
-};
-
 /*
  * =============================================================================
  * PRIVATE HELPER FUNCTIONS
@@ -141,97 +41,21 @@ static const uint8_t ks0108_font[95][5] = {
  */
 
 /**
- * @brief Low-level hardware interface - send data/command to controllers
+ * @brief Remember page/column commands so ks0108_read() knows the address
  *
- * @param data Data or command byte to send
- * @param rs Register select (0=command, 1=data)
+ * @param reg Per-controller register array (current_page or current_column)
+ * @param value New register value
  * @param controller Controller selection bitmask
  */
-static void ks0108_write_byte(uint8_t data, uint8_t rs, uint8_t controller)
+static void ks0108_track(uint8_t *reg, uint8_t value, uint8_t controller)
 {
-    // Set data on bus
-    KS0108_DATA_PORT = data;
-
-    // Set register select
-    if (rs)
-    {
-        KS0108_CONTROL_PORT |= (1 << KS0108_RS_BIT); // RS = 1 (data)
-    }
-    else
-    {
-        KS0108_CONTROL_PORT &= ~(1 << KS0108_RS_BIT); // RS = 0 (command)
-    }
-
-    // Set controller selection
     if (controller & KS0108_LEFT_CONTROLLER)
     {
-        KS0108_CONTROL_PORT |= (1 << KS0108_CS1_BIT); // CS1 = 1 (left)
-    }
-    else
-    {
-        KS0108_CONTROL_PORT &= ~(1 << KS0108_CS1_BIT); // CS1 = 0
+        reg[0] = value;
     }
-
     if (controller & KS0108_RIGHT_CONTROLLER)
     {
-        KS0108_CONTROL_PORT |= (1 << KS0108_CS2_BIT); // CS2 = 1 (right)
-    }
-    else
-    {
-        KS0108_CONTROL_PORT &= ~(1 << KS0108_CS2_BIT); // CS2 = 0
-    }
-
-    // Timing: setup time
-    _delay_us(KS0108_DELAY_SETUP);
-
-    // Enable pulse (falling edge triggers operation)
-    KS0108_CONTROL_PORT |= (1 << KS0108_E_BIT);  // E = 1
-    _delay_us(KS0108_DELAY_ENABLE);              // Enable pulse width
-    KS0108_CONTROL_PORT &= ~(1 << KS0108_E_BIT); // E = 0 (trigger)
-
-    // Timing: hold time
-    _delay_us(KS0108_DELAY_HOLD);
-
-    // Disable all controllers
-    KS0108_CONTROL_PORT &= ~((1 << KS0108_CS1_BIT) | (1 << KS0108_CS2_BIT));
-
-    // Command execution delay
-    _delay_us(KS0108_DELAY_COMMAND);
-}
-
-/**
- * @brief Determine which controller handles the specified column
- *
- * @param column Global column (0-127)
- * @return Controller selection (LEFT or RIGHT)
- */
-static uint8_t ks0108_get_controller_for_column(uint8_t column)
-{
-    if (column < KS0108_CONTROLLER_WIDTH)
-    {
-        return KS0108_LEFT_CONTROLLER;
-    }
-    else
-    {
-        return KS0108_RIGHT_CONTROLLER;
-    }
-}
-
-/**
- * @brief Convert global column to local controller column
- *
- * @param column Global column (0-127)
- * @return Local column (0-63)
- */
-static uint8_t ks0108_get_local_column(uint8_t column)
-{
-    if (column < KS0108_CONTROLLER_WIDTH)
-    {
-        return column;
-    }
-    else
-    {
-        return column - KS0108_CONTROLLER_WIDTH;
+        reg[1] = value;
     }
 }
 
@@ -243,72 +67,58 @@ static uint8_t ks0108_get_local_column(uint8_t column)
 
 void ks0108_init(void)
 {
-    // Configure port directions
-    KS0108_DATA_DDR = 0xFF; // Data port as output
-    KS0108_CONTROL_DDR |= (1 << KS0108_RS_BIT) |
-                          (1 << KS0108_E_BIT) |
-                          (1 << KS0108_CS1_BIT) |
-                          (1 << KS0108_CS2_BIT);
-
-    // Initialize control signals
-    KS0108_CONTROL_PORT &= ~((1 << KS0108_RS_BIT) |  // RS = 0
-                             (1 << KS0108_E_BIT) |   // E = 0
-                             (1 << KS0108_CS1_BIT) | // CS1 = 0
-                             (1 << KS0108_CS2_BIT)); // CS2 = 0
-
-    // Power-up delay for display stabilization
-    _delay_ms(100);
+    // Ports, reset sequence and display on (shared core)
+    lcd_init();
 
     // Initialize display state
     memset(&g_ks0108_state, 0, sizeof(g_ks0108_state));
-
-    // Reset both controllers
-    ks0108_command(KS0108_CMD_DISPLAY_OFF, KS0108_BOTH_CONTROLLERS);
-    _delay_ms(10);
-
-    // Turn on both controllers
-    ks0108_command(KS0108_CMD_DISPLAY_ON, KS0108_BOTH_CONTROLLERS);
     g_ks0108_state.display_on = 1;
 
-    // Set start line to 0 for both controllers
-    ks0108_command(KS0108_CMD_SET_START_LINE | 0, KS0108_BOTH_CONTROLLERS);
-
-    // Set initial page and column addresses
-    ks0108_set_page(0, KS0108_BOTH_CONTROLLERS);
-    ks0108_set_column(0, KS0108_BOTH_CONTROLLERS);
-
-    // Clear display
+    // Clear display and frame buffer, cursor to 0,0
     ks0108_clear_screen();
-
-    // Initialize text cursor
-    g_text_line = 0;
-    g_text_column = 0;
-}
-
-/*
- * Compatibility wrapper for legacy code
- * This allows old code calling lcd_init() to work with new library
- */
-void lcd_init(void)
-{
-    ks0108_init();
 }
 
 void ks0108_command(uint8_t cmd, uint8_t controller)
 {
-    ks0108_write_byte(cmd, 0, controller); // RS = 0 for command
+    if (controller == KS0108_BOTH_CONTROLLERS)
+    {
+        cmnda(cmd);
+    }
+    else if (controller == KS0108_LEFT_CONTROLLER)
+    {
+        cmndl(cmd);
+    }
+    else if (controller == KS0108_RIGHT_CONTROLLER)
+    {
+        cmndr(cmd);
+    }
 }
 
 void ks0108_data(uint8_t data, uint8_t controller)
 {
-    ks0108_write_byte(data, 1, controller); // RS = 1 for data
+    // Raw write: bypasses the frame buffer (use the drawing functions for that)
+    if (controller == KS0108_BOTH_CONTROLLERS)
+    {
+        dataa(data);
+    }
+    else if (controller == KS0108_LEFT_CONTROLLER)
+    {
+        datal(data);
+    }
+    else if (controller == KS0108_RIGHT_CONTROLLER)
+    {
+        datar(data);
+    }
 }
 
 uint8_t ks0108_read(uint8_t controller)
 {
-    // Note: Reading not implemented as hardware is write-only (R/W tied to GND)
-    // This function is provided for API completeness
-    return 0;
+    // The frame buffer holds what the panel shows at the current address
+    uint8_t side = (controller == KS0108_RIGHT_CONTROLLER) ? 1 : 0;
+    uint8_t page = g_ks0108_state.current_page[side];
+    uint8_t column = g_ks0108_state.current_column[side] + side * KS0108_CONTROLLER_WIDTH;
+
+    return ScreenBuffer[page][column];
 }
 
 void ks0108_set_page(uint8_t page, uint8_t controller)
@@ -316,18 +126,8 @@ void ks0108_set_page(uint8_t page, uint8_t controller)
     if (page >= KS0108_PAGES)
         return;
 
-    uint8_t cmd = KS0108_CMD_SET_PAGE | page;
-    ks0108_command(cmd, controller);
-
-    // Update state
-    if (controller & KS0108_LEFT_CONTROLLER)
-    {
-        g_ks0108_state.current_page[0] = page;
-    }
-    if (controller & KS0108_RIGHT_CONTROLLER)
-    {
-        g_ks0108_state.current_page[1] = page;
-    }
+    ks0108_command(KS0108_CMD_SET_PAGE | page, controller);
+    ks0108_track(g_ks0108_state.current_page, page, controller);
 }
 
 void ks0108_set_column(uint8_t column, uint8_t controller)
@@ -335,18 +135,8 @@ void ks0108_set_column(uint8_t column, uint8_t controller)
     if (column >= KS0108_CONTROLLER_WIDTH)
         return;
 
-    uint8_t cmd = KS0108_CMD_SET_Y_ADDRESS | column;
-    ks0108_command(cmd, controller);
-
-    // Update state
-    if (controller & KS0108_LEFT_CONTROLLER)
-    {
-        g_ks0108_state.current_column[0] = column;
-    }
-    if (controller & KS0108_RIGHT_CONTROLLER)
-    {
-        g_ks0108_state.current_column[1] = column;
-    }
+    ks0108_command(KS0108_CMD_SET_Y_ADDRESS | column, controller);
+    ks0108_track(g_ks0108_state.current_column, column, controller);
 }
 
 void ks0108_goto_xy(uint8_t page, uint8_t column)
@@ -354,11 +144,16 @@ void ks0108_goto_xy(uint8_t page, uint8_t column)
     if (page >= KS0108_PAGES || column >= KS0108_WIDTH)
         return;
 
-    uint8_t controller = ks0108_get_controller_for_column(column);
-    uint8_t local_column = ks0108_get_local_column(column);
-
-    ks0108_set_page(page, controller);
-    ks0108_set_column(local_column, controller);
+    if (column < KS0108_CONTROLLER_WIDTH)
+    {
+        ks0108_set_page(page, KS0108_LEFT_CONTROLLER);
+        ks0108_set_column(column, KS0108_LEFT_CONTROLLER);
+    }
+    else
+    {
+        ks0108_set_page(page, KS0108_RIGHT_CONTROLLER);
+        ks0108_set_column(column - KS0108_CONTROLLER_WIDTH, KS0108_RIGHT_CONTROLLER);
+    }
 }
 
 /*
@@ -376,16 +171,8 @@ void ks0108_display_on_off(uint8_t on)
 
 void ks0108_clear_screen(void)
 {
-    for (uint8_t page = 0; page < KS0108_PAGES; page++)
-    {
-        ks0108_set_page(page, KS0108_BOTH_CONTROLLERS);
-        ks0108_set_column(0, KS0108_BOTH_CONTROLLERS);
-
-        for (uint8_t col = 0; col < KS0108_CONTROLLER_WIDTH; col++)
-        {
-            ks0108_data(0x00, KS0108_BOTH_CONTROLLERS);
-        }
-    }
+    // Clears the panel and the frame buffer with auto-increment writes
+    lcd_clear();
 
     // Reset cursor positions
     ks0108_goto_xy(0, 0);
@@ -395,16 +182,8 @@ void ks0108_clear_screen(void)
 
 void ks0108_fill_screen(void)
 {
-    for (uint8_t page = 0; page < KS0108_PAGES; page++)
-    {
-        ks0108_set_page(page, KS0108_BOTH_CONTROLLERS);
-        ks0108_set_column(0, KS0108_BOTH_CONTROLLERS);
-
-        for (uint8_t col = 0; col < KS0108_CONTROLLER_WIDTH; col++)
-        {
-            ks0108_data(0xFF, KS0108_BOTH_CONTROLLERS);
-        }
-    }
+    // Eight full-width page spans
+    Raster_fill_rect(&GLCD_raster, 0, 0, KS0108_WIDTH - 1, KS0108_HEIGHT - 1, KS0108_PIXEL_ON);
 }
 
 void ks0108_set_start_line(uint8_t line, uint8_t controller)
@@ -412,181 +191,102 @@ void ks0108_set_start_line(uint8_t line, uint8_t controller)
     if (line >= KS0108_HEIGHT)
         return;
 
-    uint8_t cmd = KS0108_CMD_SET_START_LINE | line;
-    ks0108_command(cmd, controller);
-
-    // Update state
-    if (controller & KS0108_LEFT_CONTROLLER)
-    {
-        g_ks0108_state.start_line[0] = line;
-    }
-    if (controller & KS0108_RIGHT_CONTROLLER)
-    {
-        g_ks0108_state.start_line[1] = line;
-    }
+    ks0108_command(KS0108_CMD_SET_START_LINE | line, controller);
+    ks0108_track(g_ks0108_state.start_line, line, controller);
 }
 
 /*
  * =============================================================================
  * PIXEL AND GRAPHICS FUNCTIONS
  * =============================================================================
+ * Same coordinates as the core's GLCD_raster target (x = column, y = row),
+ * and KS0108_PIXEL_OFF/ON/XOR == RASTER_CLEAR/SET/XOR.
  */
 
 void ks0108_set_pixel(uint8_t x, uint8_t y, uint8_t mode)
 {
-    if (x >= KS0108_WIDTH || y >= KS0108_HEIGHT)
-        return;
-
-    uint8_t page = y / 8;
-    uint8_t bit = y % 8;
-    uint8_t controller = ks0108_get_controller_for_column(x);
-    uint8_t local_x = ks0108_get_local_column(x);
-
-    // Position cursor
-    ks0108_goto_xy(page, x);
-
-    // For pixel operations, we would need to read-modify-write
-    // Since we can't read (R/W tied to GND), we'll use a simple approach
-    uint8_t pixel_data = 0;
-
-    if (mode == KS0108_PIXEL_ON)
-    {
-        pixel_data = (1 << bit);
-    }
-    else if (mode == KS0108_PIXEL_OFF)
-    {
-        pixel_data = 0;
-    }
-
-    ks0108_data(pixel_data, controller);
+    // Read-modify-write on the frame buffer keeps the other 7 pixels of the byte
+    Raster_pixel(&GLCD_raster, x, y, mode);
 }
 
 uint8_t ks0108_get_pixel(uint8_t x, uint8_t y)
 {
-    // Not implemented due to hardware limitation (R/W tied to GND)
-    return 0;
+    if (x >= KS0108_WIDTH || y >= KS0108_HEIGHT)
+        return 0;
+
+    return (ScreenBuffer[y >> 3][x] >> (y & 7)) & 1;
 }
 
 void ks0108_draw_hline(uint8_t x, uint8_t y, uint8_t length, uint8_t mode)
 {
-    for (uint8_t i = 0; i < length; i++)
-    {
-        if (x + i < KS0108_WIDTH)
-        {
-            ks0108_set_pixel(x + i, y, mode);
-        }
-    }
+    if (length == 0)
+        return;
+
+    // One span: a single page, one byte per column
+    Raster_hline(&GLCD_raster, x, x + length - 1, y, mode);
 }
 
 void ks0108_draw_vline(uint8_t x, uint8_t y, uint8_t length, uint8_t mode)
 {
-    for (uint8_t i = 0; i < length; i++)
-    {
-        if (y + i < KS0108_HEIGHT)
-        {
-            ks0108_set_pixel(x, y + i, mode);
-        }
-    }
+    if (length == 0)
+        return;
+
+    // One masked byte per page instead of one write per pixel
+    Raster_vline(&GLCD_raster, x, y, y + length - 1, mode);
 }
 
 void ks0108_draw_line(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, uint8_t mode)
 {
     // Bresenham's line algorithm
-    int dx = abs(x2 - x1);
-    int dy = abs(y2 - y1);
-    int sx = (x1 < x2) ? 1 : -1;
-    int sy = (y1 < y2) ? 1 : -1;
-    int err = dx - dy;
-
-    int x = x1, y = y1;
-
-    while (1)
-    {
-        ks0108_set_pixel(x, y, mode);
-
-        if (x == x2 && y == y2)
-            break;
-
-        int e2 = 2 * err;
-        if (e2 > -dy)
-        {
-            err -= dy;
-            x += sx;
-        }
-        if (e2 < dx)
-        {
-            err += dx;
-            y += sy;
-        }
-    }
+    Raster_line(&GLCD_raster, x1, y1, x2, y2, mode);
 }
 
 void ks0108_draw_rect(uint8_t x, uint8_t y, uint8_t width, uint8_t height, uint8_t mode)
 {
-    // Draw four sides
-    ks0108_draw_hline(x, y, width, mode);              // Top
-    ks0108_draw_hline(x, y + height - 1, width, mode); // Bottom
-    ks0108_draw_vline(x, y, height, mode);             // Left
-    ks0108_draw_vline(x + width - 1, y, height, mode); // Right
+    if (width == 0 || height == 0)
+        return;
+
+    // Four sides, corners drawn once (XOR safe)
+    Raster_rect(&GLCD_raster, x, y, x + width - 1, y + height - 1, mode);
 }
 
 void ks0108_fill_rect(uint8_t x, uint8_t y, uint8_t width, uint8_t height, uint8_t mode)
 {
-    for (uint8_t i = 0; i < height; i++)
-    {
-        ks0108_draw_hline(x, y + i, width, mode);
-    }
+    if (width == 0 || height == 0)
+        return;
+
+    // Page spans: at most 8 spans regardless of height
+    Raster_fill_rect(&GLCD_raster, x, y, x + width - 1, y + height - 1, mode);
 }
 
 void ks0108_draw_circle(uint8_t cx, uint8_t cy, uint8_t radius, uint8_t mode)
 {
     // Midpoint circle algorithm
-    int x = radius;
-    int y = 0;
-    int err = 0;
-
-    while (x >= y)
-    {
-        ks0108_set_pixel(cx + x, cy + y, mode);
-        ks0108_set_pixel(cx + y, cy + x, mode);
-        ks0108_set_pixel(cx - y, cy + x, mode);
-        ks0108_set_pixel(cx - x, cy + y, mode);
-        ks0108_set_pixel(cx - x, cy - y, mode);
-        ks0108_set_pixel(cx - y, cy - x, mode);
-        ks0108_set_pixel(cx + y, cy - x, mode);
-        ks0108_set_pixel(cx + x, cy - y, mode);
-
-        if (err <= 0)
-        {
-            y += 1;
-            err += 2 * y + 1;
-        }
-        if (err > 0)
-        {
-            x -= 1;
-            err -= 2 * x + 1;
-        }
-    }
+    Raster_circle(&GLCD_raster, cx, cy, radius, mode);
 }
 
 void ks0108_fill_circle(uint8_t cx, uint8_t cy, uint8_t radius, uint8_t mode)
 {
-    for (int y = -radius; y <= radius; y++)
-    {
-        for (int x = -radius; x <= radius; x++)
-        {
-            if (x * x + y * y <= radius * radius)
-            {
-                ks0108_set_pixel(cx + x, cy + y, mode);
-            }
-        }
-    }
+    // One vertical span per column, no per-pixel multiply
+    Raster_fill_circle(&GLCD_raster, cx, cy, radius, mode);
+}
+
+void ks0108_draw_ellipse(uint8_t cx, uint8_t cy, uint8_t rx, uint8_t ry, uint8_t mode)
+{
+    // Midpoint ellipse algorithm
+    Raster_ellipse(&GLCD_raster, cx, cy, rx, ry, mode);
+}
+
+void ks0108_fill_ellipse(uint8_t cx, uint8_t cy, uint8_t rx, uint8_t ry, uint8_t mode)
+{
+    Raster_fill_ellipse(&GLCD_raster, cx, cy, rx, ry, mode);
 }
 
 /*
  * =============================================================================
  * TEXT AND CHARACTER FUNCTIONS
  * =============================================================================
+ * The core's text grid: 10 characters per controller, 6 pixels each.
  */
 
 void ks0108_set_cursor(uint8_t line, uint8_t column)
@@ -598,47 +298,57 @@ void ks0108_set_cursor(uint8_t line, uint8_t column)
     g_text_column = column;
 }
 
-void ks0108_putchar(char c)
+// Advance the cursor; returns 1 when it wrapped to a new line
+static uint8_t ks0108_advance(void)
 {
-    if (c < 0x20 || c > 0x7E)
-        return; // Only printable ASCII
-
-    uint8_t char_index = c - 0x20;
-    uint8_t page = g_text_line;
-    uint8_t x_start = g_text_column * (KS0108_CHAR_WIDTH + KS0108_CHAR_SPACING);
-
-    // Position to character location
-    ks0108_goto_xy(page, x_start);
-
-    // Write character data
-    for (uint8_t i = 0; i < KS0108_CHAR_WIDTH; i++)
+    g_text_column++;
+    if (g_text_column < KS0108_CHARS_PER_LINE)
     {
-        uint8_t controller = ks0108_get_controller_for_column(x_start + i);
-        ks0108_data(ks0108_font[char_index][i], controller);
+        return 0;
     }
 
-    // Write spacing
-    uint8_t controller = ks0108_get_controller_for_column(x_start + KS0108_CHAR_WIDTH);
-    ks0108_data(0x00, controller);
-
-    // Advance cursor
-    g_text_column++;
-    if (g_text_column >= KS0108_CHARS_PER_LINE)
+    g_text_column = 0;
+    g_text_line++;
+    if (g_text_line >= KS0108_LINES_PER_SCREEN)
     {
-        g_text_column = 0;
-        g_text_line++;
-        if (g_text_line >= KS0108_LINES_PER_SCREEN)
-        {
-            g_text_line = 0;
-        }
+        g_text_line = 0;
     }
+    return 1;
+}
+
+void ks0108_putchar(char c)
+{
+    if (c < 0x20 || c > 0x7E)
+        return; // Only printable ASCII
+
+    lcd_xy(g_text_line, g_text_column);
+    lcd_char(c);
+    ks0108_advance();
 }
 
 void ks0108_puts(const char *str)
 {
+    uint8_t positioned = 0;
+
     while (*str)
     {
-        ks0108_putchar(*str++);
+        char c = *str++;
+
+        if (c < 0x20 || c > 0x7E)
+            continue; // Only printable ASCII
+
+        // Address commands only at the start, a new line or the CS2 half:
+        // within a run the column auto-increments
+        if (!positioned || g_text_column == KS0108_CHARS_PER_LINE / 2)
+        {
+            lcd_xy(g_text_line, g_text_column);
+            positioned = 1;
+        }
+        lcd_char(c);
+        if (ks0108_advance())
+        {
+            positioned = 0;
+        }
     }
 }
 
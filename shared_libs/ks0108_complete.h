@@ -12,13 +12,21 @@
  * - Interface: 8-bit parallel data bus + 5 control signals
  * - Memory: 8 pages × 64 columns per controller (page = 8 vertical pixels)
  *
- * PIN CONNECTIONS (ATmega128):
+ * PIN CONNECTIONS (ATmega128, board default of _glcd_parallel.h):
  * - D0-D7:  PORTA (8-bit data bus)
  * - RS:     PE4 (Register Select: 0=Command, 1=Data)
  * - R/W:    GND (Read/Write: tied to ground for write-only)
  * - E:      PE5 (Enable: falling edge triggers operation)
  * - CS1:    PE7 (Chip Select 1: left controller, columns 0-63)
  * - CS2:    PE6 (Chip Select 2: right controller, columns 64-127)
+ * With R/W on GND the busy flag cannot be read: do not build with
+ * GLCD_BUSY_POLL. -DGLCD_EXEC_US=3 gives datasheet timing on a real panel.
+ *
+ * SHARED CORE:
+ * This is an API layer over _glcd.c. Wiring and bus timing live in the
+ * core's backend (_glcd_parallel.h), pixels and shapes in its
+ * ScreenBuffer and rasterizers (_raster.c). Link with _glcd.c and
+ * _raster.c; lcd_init() is provided by the core.
  *
  * KS0108 COMMAND SET:
  * - 0x3E: Display OFF
@@ -27,20 +35,13 @@
  * - 0xB8-0xBF: Set X Address (page 0-7)
  * - 0xC0-0xFF: Set Z Address (start line 0-63)
  *
- * TIMING REQUIREMENTS:
- * - Enable pulse width: minimum 450ns
- * - Setup time: minimum 140ns
- * - Hold time: minimum 10ns
- * - Command execution: varies (2μs typical)
- *
  * =============================================================================
  */
 
 #ifndef KS0108_COMPLETE_H
 #define KS0108_COMPLETE_H
 
-#include <avr/io.h>
-#include <util/delay.h>
+#include <stdint.h>
 #include <string.h>
 
 /*
@@ -56,20 +57,6 @@
 #define KS0108_CONTROLLER_WIDTH 64 // Width per controller
 #define KS0108_CONTROLLERS 2       // Number of controllers (left/right)
 
-/* Hardware pin definitions (ATmega128) */
-#define KS0108_DATA_PORT PORTA // 8-bit data bus
-#define KS0108_DATA_DDR DDRA
-#define KS0108_DATA_PIN PINA
-
-#define KS0108_CONTROL_PORT PORTE // Control signals
-#define KS0108_CONTROL_DDR DDRE
-#define KS0108_CONTROL_PIN PINE
-
-#define KS0108_RS_BIT 4  // PE4 - Register Select
-#define KS0108_E_BIT 5   // PE5 - Enable
-#define KS0108_CS2_BIT 6 // PE6 - Chip Select 2 (right)
-#define KS0108_CS1_BIT 7 // PE7 - Chip Select 1 (left)
-
 /* KS0108 Commands */
 #define KS0108_CMD_DISPLAY_OFF 0x3E    // Turn display off
 #define KS0108_CMD_DISPLAY_ON 0x3F     // Turn display on
@@ -82,12 +69,6 @@
 #define KS0108_RIGHT_CONTROLLER 2 // Right controller (CS2)
 #define KS0108_BOTH_CONTROLLERS 3 // Both controllers
 
-/* Timing constants (microseconds) */
-#define KS0108_DELAY_SETUP 1    // Setup time before enable
-#define KS0108_DELAY_ENABLE 1   // Enable pulse width
-#define KS0108_DELAY_HOLD 2     // Hold time after enable
-#define KS0108_DELAY_COMMAND 10 // Command execution time
-
 /* Drawing modes */
 #define KS0108_PIXEL_OFF 0 // Clear pixel (white)
 #define KS0108_PIXEL_ON 1  // Set pixel (black)
@@ -97,7 +78,7 @@
 #define KS0108_CHAR_WIDTH 5       // Character width in pixels
 #define KS0108_CHAR_HEIGHT 7      // Character height in pixels
 #define KS0108_CHAR_SPACING 1     // Space between characters
-#define KS0108_CHARS_PER_LINE 21  // Characters per line (128/6)
+#define KS0108_CHARS_PER_LINE 20  // Characters per line (10 per controller)
 #define KS0108_LINES_PER_SCREEN 8 // Text lines per screen
 
 /*
@@ -145,12 +126,6 @@ typedef struct
  */
 void ks0108_init(void);
 
-/*
- * Compatibility function for legacy code
- * Provides backward compatibility with old lcd_init() calls
- */
-void lcd_init(void);
-
 /**
  * @brief Send command to specified controller(s)
  *
@@ -168,10 +143,12 @@ void ks0108_command(uint8_t cmd, uint8_t controller);
 void ks0108_data(uint8_t data, uint8_t controller);
 
 /**
- * @brief Read data byte from specified controller
+ * @brief Read data byte at the current address of the specified controller
+ *
+ * Served from the frame buffer, which mirrors the panel.
  *
  * @param controller Controller to read from (LEFT or RIGHT only)
- * @return Data byte read from controller
+ * @return Data byte at the controller's current page/column
  */
 uint8_t ks0108_read(uint8_t controller);
 
@@ -327,6 +304,28 @@ void ks0108_draw_circle(uint8_t cx, uint8_t cy, uint8_t radius, uint8_t mode);
  */
 void ks0108_fill_circle(uint8_t cx, uint8_t cy, uint8_t radius, uint8_t mode);
 
+/**
+ * @brief Draw ellipse outline using midpoint algorithm
+ *
+ * @param cx Center X coordinate
+ * @param cy Center Y coordinate
+ * @param rx Horizontal radius
+ * @param ry Vertical radius
+ * @param mode Pixel mode (ON, OFF, or XOR)
+ */
+void ks0108_draw_ellipse(uint8_t cx, uint8_t cy, uint8_t rx, uint8_t ry, uint8_t mode);
+
+/**
+ * @brief Draw filled ellipse
+ *
+ * @param cx Center X coordinate
+ * @param cy Center Y coordinate
+ * @param rx Horizontal radius
+ * @param ry Vertical radius
+ * @param mode Pixel mode (ON, OFF, or XOR)
+ */
+void ks0108_fill_ellipse(uint8_t cx, uint8_t cy, uint8_t rx, uint8_t ry, uint8_t mode);
+
 /*
  * =============================================================================
  * TEXT AND CHARACTER FUNCTIONS
@@ -337,7 +336,7 @@ void ks0108_fill_circle(uint8_t cx, uint8_t cy, uint8_t radius, uint8_t mode);
  * @brief Set text cursor position
  *
  * @param line Text line (0-7)
- * @param column Character column (0-20)
+ * @param column Character column (0-19)
  */
 void ks0108_set_cursor(uint8_t line, uint8_t column);
 
@@ -359,7 +358,7 @@ void ks0108_puts(const char *str);
  * @brief Print string at specified position
  *
  * @param line Text line (0-7)
- * @param column Character column (0-20)
+ * @param column Character column (0-19)
  * @param str Null-terminated string to print
  */
 void ks0108_puts_at(uint8_t line, uint8_t column, const char *str);
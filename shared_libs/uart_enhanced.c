@@ -18,6 +18,9 @@
 #include <string.h>
 #include <stdarg.h>
 #include "config.h"
+#include "_atomic.h"
+#include "_spsc.h"
+#include "_isr_priority.h"
 
 // Enhanced UART configuration
 #define UART_RX_BUFFER_SIZE 128
@@ -32,21 +35,14 @@
 #define UART_BUFFER_OVERFLOW 0x08
 #define UART_TIMEOUT_ERROR 0x10
 
+// Buffers: lock-free rings, ISR and main each own one index
+// RX: ISR produces, main consumes.  TX: main produces, ISR consumes.
+SPSC_RING_DEFINE(uart1_rx_ring, UART_RX_BUFFER_SIZE);
+SPSC_RING_DEFINE(uart1_tx_ring, UART_TX_BUFFER_SIZE);
+
 // Enhanced UART structure
 typedef struct
 {
-    // Receive buffer
-    volatile uint8_t rx_buffer[UART_RX_BUFFER_SIZE];
-    volatile uint8_t rx_head;
-    volatile uint8_t rx_tail;
-    volatile uint8_t rx_count;
-
-    // Transmit buffer
-    volatile uint8_t tx_buffer[UART_TX_BUFFER_SIZE];
-    volatile uint8_t tx_head;
-    volatile uint8_t tx_tail;
-    volatile uint8_t tx_count;
-
     // Status and statistics
     volatile uint8_t error_flags;
     volatile uint16_t bytes_received;
@@ -88,7 +84,10 @@ uint8_t uart_enhanced_init(uint32_t baud_rate, uint8_t data_bits, uint8_t parity
         return UART_FRAME_ERROR; // UBRR is 12-bit
 
     // Initialize structure
+    UCSR1B = 0; // Stop UART interrupts while buffers are reset
     memset((void *)&uart1_enhanced, 0, sizeof(uart_enhanced_t));
+    Spsc_reset(&uart1_rx_ring);
+    Spsc_reset(&uart1_tx_ring);
     uart1_enhanced.baud_rate = baud_rate;
     uart1_enhanced.data_bits = data_bits;
     uart1_enhanced.parity = parity;
@@ -151,8 +150,10 @@ uint8_t uart_enhanced_init(uint32_t baud_rate, uint8_t data_bits, uint8_t parity
 
 /*
  * Enhanced RX Interrupt Service Routine
+ * Low priority class: error checks and buffering run with interrupts
+ * enabled, so time-critical HIGH class ISRs are not delayed by them.
  */
-ISR(USART1_RX_vect)
+ISR_PRIORITY_LOW(USART1_RX_vect, UCSR1B, RXCIE1)
 {
     uint8_t status = UCSR1A;
     uint8_t data = UDR1;
@@ -180,11 +181,8 @@ ISR(USART1_RX_vect)
     }
 
     // Store data in circular buffer
-    if (uart1_enhanced.rx_count < UART_RX_BUFFER_SIZE)
+    if (Spsc_put(&uart1_rx_ring, data))
     {
-        uart1_enhanced.rx_buffer[uart1_enhanced.rx_head] = data;
-        uart1_enhanced.rx_head = (uart1_enhanced.rx_head + 1) % UART_RX_BUFFER_SIZE;
-        uart1_enhanced.rx_count++;
         uart1_enhanced.bytes_received++;
     }
     else
@@ -195,21 +193,19 @@ ISR(USART1_RX_vect)
 }
 
 /*
- * Enhanced TX Interrupt Service Routine
+ * Enhanced TX Interrupt Service Routine (low priority class)
  */
-ISR(USART1_UDRE_vect)
+ISR_PRIORITY_LOW(USART1_UDRE_vect, UCSR1B, UDRIE1)
 {
-    if (uart1_enhanced.tx_count > 0)
+    if (!Spsc_is_empty(&uart1_tx_ring))
     {
-        UDR1 = uart1_enhanced.tx_buffer[uart1_enhanced.tx_tail];
-        uart1_enhanced.tx_tail = (uart1_enhanced.tx_tail + 1) % UART_TX_BUFFER_SIZE;
-        uart1_enhanced.tx_count--;
+        UDR1 = Spsc_get(&uart1_tx_ring);
         uart1_enhanced.bytes_transmitted++;
     }
     else
     {
-        // Disable UDRE interrupt when buffer is empty
-        UCSR1B &= ~(1 << UDRIE1);
+        // Leave UDRE interrupt disabled when buffer is empty
+        ISR_PRIORITY_KEEP_DISABLED(USART1_UDRE_vect);
     }
 }
 
@@ -220,7 +216,7 @@ uint8_t uart_enhanced_receive(uint8_t *data, uint16_t timeout_ms)
 {
     uint16_t timeout_counter = 0;
 
-    while (uart1_enhanced.rx_count == 0)
+    while (Spsc_is_empty(&uart1_rx_ring))
     {
         _delay_ms(1);
         timeout_counter++;
@@ -232,14 +228,8 @@ uint8_t uart_enhanced_receive(uint8_t *data, uint16_t timeout_ms)
         }
     }
 
-    // Disable interrupts for atomic operation
-    cli();
-
-    *data = uart1_enhanced.rx_buffer[uart1_enhanced.rx_tail];
-    uart1_enhanced.rx_tail = (uart1_enhanced.rx_tail + 1) % UART_RX_BUFFER_SIZE;
-    uart1_enhanced.rx_count--;
-
-    sei();
+    // Main program owns the tail index - no need to disable interrupts
+    *data = Spsc_get(&uart1_rx_ring);
 
     return UART_NO_ERROR;
 }
@@ -249,23 +239,18 @@ uint8_t uart_enhanced_receive(uint8_t *data, uint16_t timeout_ms)
  */
 uint8_t uart_enhanced_transmit(uint8_t data)
 {
-    // Wait if buffer is full
-    while (uart1_enhanced.tx_count >= UART_TX_BUFFER_SIZE)
+    // Wait if buffer is full (main program owns the head index)
+    while (!Spsc_put(&uart1_tx_ring, data))
     {
         _delay_us(10);
     }
 
-    // Disable interrupts for atomic operation
-    cli();
-
-    uart1_enhanced.tx_buffer[uart1_enhanced.tx_head] = data;
-    uart1_enhanced.tx_head = (uart1_enhanced.tx_head + 1) % UART_TX_BUFFER_SIZE;
-    uart1_enhanced.tx_count++;
-
-    // Enable UDRE interrupt
-    UCSR1B |= (1 << UDRIE1);
-
-    sei();
+    // Enable UDRE interrupt - UCSR1B is also modified by the UDRE ISR, so
+    // the read-modify-write must not be interrupted
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        UCSR1B |= (1 << UDRIE1);
+    }
 
     return UART_NO_ERROR;
 }
@@ -311,12 +296,12 @@ int uart_enhanced_printf(const char *format, ...)
  */
 uint8_t uart_enhanced_rx_available(void)
 {
-    return uart1_enhanced.rx_count;
+    return Spsc_count(&uart1_rx_ring);
 }
 
 uint8_t uart_enhanced_tx_free(void)
 {
-    return UART_TX_BUFFER_SIZE - uart1_enhanced.tx_count;
+    return Spsc_free(&uart1_tx_ring);
 }
 
 /*
@@ -342,18 +327,18 @@ uint8_t uart_enhanced_get_last_error(void)
  */
 uint16_t uart_enhanced_get_bytes_received(void)
 {
-    return uart1_enhanced.bytes_received;
+    return Atomic_read_u16(&uart1_enhanced.bytes_received);
 }
 
 uint16_t uart_enhanced_get_bytes_transmitted(void)
 {
-    return uart1_enhanced.bytes_transmitted;
+    return Atomic_read_u16(&uart1_enhanced.bytes_transmitted);
 }
 
 void uart_enhanced_reset_statistics(void)
 {
-    uart1_enhanced.bytes_received = 0;
-    uart1_enhanced.bytes_transmitted = 0;
+    Atomic_write_u16(&uart1_enhanced.bytes_received, 0);
+    Atomic_write_u16(&uart1_enhanced.bytes_transmitted, 0);
 }
 
 /*
@@ -382,10 +367,10 @@ void uart_enhanced_print_status(void)
     uart_enhanced_printf("Data Bits: %u\\r\\n", uart1_enhanced.data_bits);
     uart_enhanced_printf("Parity: %u\\r\\n", uart1_enhanced.parity);
     uart_enhanced_printf("Stop Bits: %u\\r\\n", uart1_enhanced.stop_bits);
-    uart_enhanced_printf("RX Buffer: %u/%u\\r\\n", uart1_enhanced.rx_count, UART_RX_BUFFER_SIZE);
-    uart_enhanced_printf("TX Buffer: %u/%u\\r\\n", uart1_enhanced.tx_count, UART_TX_BUFFER_SIZE);
-    uart_enhanced_printf("Bytes RX: %u\\r\\n", uart1_enhanced.bytes_received);
-    uart_enhanced_printf("Bytes TX: %u\\r\\n", uart1_enhanced.bytes_transmitted);
+    uart_enhanced_printf("RX Buffer: %u/%u\\r\\n", Spsc_count(&uart1_rx_ring), UART_RX_BUFFER_SIZE);
+    uart_enhanced_printf("TX Buffer: %u/%u\\r\\n", Spsc_count(&uart1_tx_ring), UART_TX_BUFFER_SIZE);
+    uart_enhanced_printf("Bytes RX: %u\\r\\n", uart_enhanced_get_bytes_received());
+    uart_enhanced_printf("Bytes TX: %u\\r\\n", uart_enhanced_get_bytes_transmitted());
     uart_enhanced_printf("Error Flags: 0x%02X\\r\\n", uart1_enhanced.error_flags);
     uart_enhanced_printf("Last Error: 0x%02X\\r\\n", uart1_enhanced.last_error);
 }
@@ -430,7 +415,7 @@ void Uart1_init(void)
 
 uint8_t is_USART1_received(void)
 {
-    return (uart1_enhanced.rx_count > 0);
+    return !Spsc_is_empty(&uart1_rx_ring);
 }
 
 uint8_t get_USART1(void)
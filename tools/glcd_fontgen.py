@@ -0,0 +1,225 @@
+#!/usr/bin/env python3
+"""
+glcd_fontgen.py - PROGMEM font generator for the KS0108 text renderer (_text.c)
+
+Reads glyph source files (ASCII art) and writes one C file plus header with
+Text_font_t descriptors, glyph bitmaps, width and offset tables.
+
+GLYPH SOURCE FORMAT (*.glyphs):
+    # comment
+    name Text_font_digits_16   C identifier of the descriptor
+    height 16                  pixel rows per glyph
+    spacing 2                  blank columns after each glyph
+    proportional yes           yes: trim blank columns, no: fixed width
+    space 4                    width of blank glyphs (proportional fonts)
+    scale 1                    optional: enlarge every pixel N x N
+    glyph 0                    character (or 0x30), then `height` rows
+    ..####..
+    .#....#.
+    ...
+    '#' (or any character except '.' and ' ') is a set pixel.
+
+OUTPUT:
+    Glyph data is page-major like _bitmap.h images: rows 0-7 of every
+    column, then rows 8-15, ... bit 0 = top row of a byte. Fixed-width
+    fonts need no width/offset tables (2 bytes per glyph saved).
+
+USAGE:
+    python tools/glcd_fontgen.py -o shared_libs/_fonts shared_libs/fonts/*.glyphs
+"""
+
+import argparse
+import os
+import sys
+
+
+def parse_char(token):
+    if token.lower().startswith("0x") and len(token) > 2:
+        return int(token, 16)
+    if len(token) == 1:
+        return ord(token)
+    raise ValueError("bad glyph character: %r" % token)
+
+
+def read_glyphs(path):
+    font = {"name": None, "height": None, "spacing": 1, "proportional": False,
+            "space": None, "scale": 1, "glyphs": {}}
+    with open(path) as f:
+        lines = [line.rstrip("\n") for line in f]
+
+    i = 0
+    while i < len(lines):
+        line = lines[i].strip()
+        i += 1
+        if not line or line.startswith("#"):
+            continue
+        key, _, value = line.partition(" ")
+        value = value.strip()
+        if key == "glyph":
+            code = parse_char(value)
+            rows = lines[i:i + font["height"]]
+            if len(rows) != font["height"]:
+                raise ValueError("%s: glyph %r is cut short" % (path, value))
+            i += font["height"]
+            font["glyphs"][code] = [[c not in ". " for c in row] for row in rows]
+        elif key == "name":
+            font["name"] = value
+        elif key in ("height", "spacing", "space", "scale"):
+            font[key] = int(value)
+        elif key == "proportional":
+            font["proportional"] = value.lower() in ("yes", "1", "true")
+        else:
+            raise ValueError("%s: unknown keyword %r" % (path, key))
+
+    if not font["name"] or not font["height"] or not font["glyphs"]:
+        raise ValueError("%s: name, height and at least one glyph are required" % path)
+    return font
+
+
+def scaled(rows, scale):
+    out = []
+    for row in rows:
+        wide = [px for px in row for _ in range(scale)]
+        out.extend([list(wide) for _ in range(scale)])
+    return out
+
+
+def columns(rows):
+    width = max(len(r) for r in rows)
+    return [[c < len(r) and r[c] for r in rows] for c in range(width)]
+
+
+def trim(cols):
+    used = [i for i, col in enumerate(cols) if any(col)]
+    if not used:
+        return []
+    return cols[used[0]:used[-1] + 1]
+
+
+def pack(cols, height):
+    data = []
+    for page in range((height + 7) // 8):
+        for col in cols:
+            byte = 0
+            for bit in range(8):
+                row = page * 8 + bit
+                if row < height and col[row]:
+                    byte |= 1 << bit
+            data.append(byte)
+    return data
+
+
+def build(font):
+    scale = font["scale"]
+    height = font["height"] * scale
+    codes = sorted(font["glyphs"])
+    first, last = codes[0], codes[-1]
+
+    glyph_cols = {}
+    for code in codes:
+        glyph_cols[code] = columns(scaled(font["glyphs"][code], scale))
+
+    if font["proportional"]:
+        space = font["space"] if font["space"] is not None else max(1, height // 3)
+        for code in codes:
+            cols = trim(glyph_cols[code])
+            glyph_cols[code] = cols if cols else [[False] * height for _ in range(space)]
+        width = max(len(c) for c in glyph_cols.values())
+    else:
+        width = max(len(c) for c in glyph_cols.values())
+        for code in codes:
+            cols = glyph_cols[code]
+            glyph_cols[code] = cols + [[False] * height for _ in range(width - len(cols))]
+
+    bitmaps, widths, offsets = [], [], []
+    for code in range(first, last + 1):
+        cols = glyph_cols.get(code, [])
+        if not font["proportional"] and not cols:
+            cols = [[False] * height for _ in range(width)]
+        offsets.append(len(bitmaps))
+        widths.append(len(cols))
+        bitmaps.extend(pack(cols, height))
+
+    return {"name": font["name"], "first": first, "last": last, "width": width,
+            "height": height, "spacing": font["spacing"],
+            "proportional": font["proportional"], "bitmaps": bitmaps,
+            "widths": widths, "offsets": offsets}
+
+
+def c_array(ctype, name, values, fmt, per_line):
+    out = ["static const %s %s[] PROGMEM = {" % (ctype, name)]
+    for i in range(0, len(values), per_line):
+        out.append("    " + ", ".join(fmt % v for v in values[i:i + per_line]) + ",")
+    out[-1] = out[-1].rstrip(",")
+    out.append("};")
+    return out
+
+
+def emit(fonts, base, sources):
+    stem = os.path.basename(base)
+    guard = "_%s_H_" % stem.strip("_").upper()
+    src = ["/*",
+           " * %s.c - Generated PROGMEM Fonts (do not edit)" % stem,
+           " * Generated by tools/glcd_fontgen.py from: %s" % ", ".join(sources),
+           " */",
+           "",
+           '#include "%s.h"' % stem,
+           ""]
+    hdr = ["/*",
+           " * %s.h - Generated PROGMEM Fonts (do not edit)" % stem,
+           " * Generated by tools/glcd_fontgen.py, see _text.h for the format",
+           " *",
+           " * FONT                          SIZE     CHARS      FLASH"]
+    for f in fonts:
+        flash = len(f["bitmaps"]) + 11
+        if f["proportional"]:
+            flash += 3 * len(f["widths"])
+        kind = "prop" if f["proportional"] else "fixed"
+        hdr.append(" * %-29s %2dx%-2d %-5s %-10s %4d bytes" % (
+            f["name"], f["width"], f["height"], kind,
+            "%r-%r" % (chr(f["first"]), chr(f["last"])), flash))
+    hdr += [" */", "", "#ifndef %s" % guard, "#define %s" % guard, "",
+            '#include "_text.h"', ""]
+
+    for f in fonts:
+        n = f["name"]
+        src += c_array("uint8_t", n + "_bitmaps", f["bitmaps"], "0x%02X", 16)
+        src.append("")
+        widths = offsets = "0"
+        if f["proportional"]:
+            src += c_array("uint8_t", n + "_widths", f["widths"], "%d", 16)
+            src.append("")
+            src += c_array("uint16_t", n + "_offsets", f["offsets"], "%d", 12)
+            src.append("")
+            widths, offsets = n + "_widths", n + "_offsets"
+        src.append("const Text_font_t %s PROGMEM = {0x%02X, 0x%02X, %d, %d, %d, %s, %s, %s};" % (
+            n, f["first"], f["last"], f["width"], f["height"], f["spacing"],
+            widths, offsets, n + "_bitmaps"))
+        src.append("")
+        hdr.append("extern const Text_font_t %s;" % n)
+
+    hdr += ["", "#endif // %s" % guard, ""]
+    with open(base + ".c", "w", newline="\n") as f:
+        f.write("\n".join(src))
+    with open(base + ".h", "w", newline="\n") as f:
+        f.write("\n".join(hdr))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Generate PROGMEM fonts for _text.c")
+    parser.add_argument("-o", "--output", required=True,
+                        help="output path without extension, e.g. shared_libs/_fonts")
+    parser.add_argument("sources", nargs="+", help="*.glyphs files")
+    args = parser.parse_args()
+
+    try:
+        fonts = [build(read_glyphs(path)) for path in args.sources]
+    except ValueError as err:
+        sys.exit("glcd_fontgen: %s" % err)
+    emit(fonts, args.output, [os.path.basename(p) for p in args.sources])
+    for f in fonts:
+        print("%s: %d glyphs, %d bitmap bytes" % (f["name"], f["last"] - f["first"] + 1, len(f["bitmaps"])))
+
+
+if __name__ == "__main__":
+    main()